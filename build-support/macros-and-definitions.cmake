@@ -560,6 +560,22 @@ macro(process_options)
     endif()
   endif()
 
+  set(ENABLE_BLAS False)
+  if(${NS3_BLAS})
+    disable_cmake_warnings()
+    find_package(BLAS QUIET)
+    find_path(CBLAS_INCLUDE_DIR NAMES cblas.h PATH_SUFFIXES openblas)
+    enable_cmake_warnings()
+
+    if(${BLAS_FOUND} AND CBLAS_INCLUDE_DIR)
+      set(ENABLE_BLAS True)
+      add_definitions(-DHAVE_BLAS)
+      include_directories(${CBLAS_INCLUDE_DIR})
+    else()
+      set(ENABLE_BLAS_REASON "BLAS or cblas.h was not found")
+    endif()
+  endif()
+
   # GTK3 Don't search for it if you don't have it installed, as it take an
   # insane amount of time
   set(GTK3_FOUND FALSE)
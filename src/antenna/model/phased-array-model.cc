@@ -18,6 +18,7 @@ namespace ns3
 {
 
 uint32_t PhasedArrayModel::m_idCounter = 0;
+uint64_t PhasedArrayModel::m_codebookIdCounter = 0;
 
 NS_LOG_COMPONENT_DEFINE("PhasedArrayModel");
 
@@ -56,6 +57,83 @@ PhasedArrayModel::SetBeamformingVector(const ComplexVector& beamformingVector)
                   beamformingVector.GetSize() << " != " << GetNumElems());
     m_beamformingVector = beamformingVector;
     m_isBfVectorValid = true;
+    m_beamId.reset();
+}
+
+void
+PhasedArrayModel::SetCodebook(const std::vector<ComplexVector>& codebook)
+{
+    NS_LOG_FUNCTION(this << codebook.size());
+    for (const auto& beamformingVector : codebook)
+    {
+        NS_ASSERT_MSG(beamformingVector.GetSize() == GetNumElems(),
+                      beamformingVector.GetSize() << " != " << GetNumElems());
+    }
+    m_codebook = codebook;
+    m_codebookId = ++m_codebookIdCounter;
+    m_beamId.reset();
+}
+
+void
+PhasedArrayModel::SetCodebook(const std::vector<Angles>& directions)
+{
+    NS_LOG_FUNCTION(this << directions.size());
+    std::vector<ComplexVector> codebook;
+    codebook.reserve(directions.size());
+    for (const auto& direction : directions)
+    {
+        codebook.push_back(GetBeamformingVector(direction));
+    }
+    SetCodebook(codebook);
+}
+
+size_t
+PhasedArrayModel::GetCodebookSize() const
+{
+    return m_codebook.size();
+}
+
+const PhasedArrayModel::ComplexVector&
+PhasedArrayModel::GetCodebookEntry(uint32_t beamId) const
+{
+    NS_ASSERT_MSG(beamId < m_codebook.size(), "Beam ID " << beamId << " not in the codebook");
+    return m_codebook[beamId];
+}
+
+void
+PhasedArrayModel::SetBeamformingVectorFromCodebook(uint32_t beamId)
+{
+    NS_LOG_FUNCTION(this << beamId);
+    NS_ASSERT_MSG(beamId < m_codebook.size(), "Beam ID " << beamId << " not in the codebook");
+    if (m_beamId == beamId)
+    {
+        return;
+    }
+    m_beamformingVector = m_codebook[beamId];
+    m_isBfVectorValid = true;
+    m_beamId = beamId;
+}
+
+std::optional<uint32_t>
+PhasedArrayModel::GetBeamId() const
+{
+    return m_beamId;
+}
+
+uint64_t
+PhasedArrayModel::GetCodebookId() const
+{
+    return m_codebookId;
+}
+
+void
+PhasedArrayModel::InvalidateBeamforming()
+{
+    NS_LOG_FUNCTION(this);
+    m_isBfVectorValid = false;
+    m_codebook.clear();
+    m_codebookId = ++m_codebookIdCounter;
+    m_beamId.reset();
 }
 
 PhasedArrayModel::ComplexVector
@@ -14,6 +14,8 @@
 #include <ns3/object.h>
 
 #include <complex>
+#include <optional>
+#include <vector>
 
 namespace ns3
 {
@@ -225,6 +227,56 @@ class PhasedArrayModel : public Object
      */
     ComplexVector GetSteeringVector(Angles a) const;
 
+    /**
+     * Sets the codebook, i.e., the set of beamforming vectors that can be selected
+     * through SetBeamformingVectorFromCodebook. The index of each vector in the codebook
+     * is used as its beam ID, so that users of the array (e.g., the spectrum propagation
+     * loss models) can reuse the computations associated with a given beam.
+     * \param codebook the beamforming vectors of the codebook
+     */
+    void SetCodebook(const std::vector<ComplexVector>& codebook);
+
+    /**
+     * Sets the codebook by computing the beamforming vectors pointing towards the
+     * specified directions
+     * \param directions the directions of the beams of the codebook
+     */
+    void SetCodebook(const std::vector<Angles>& directions);
+
+    /**
+     * Returns the number of beams in the codebook
+     * \return the number of beams in the codebook
+     */
+    size_t GetCodebookSize() const;
+
+    /**
+     * Returns the beamforming vector of the codebook with the specified beam ID
+     * \param beamId the beam ID
+     * \return the const reference of the beamforming vector
+     */
+    const ComplexVector& GetCodebookEntry(uint32_t beamId) const;
+
+    /**
+     * Sets the beamforming vector of the codebook with the specified beam ID
+     * \param beamId the beam ID
+     */
+    void SetBeamformingVectorFromCodebook(uint32_t beamId);
+
+    /**
+     * Returns the ID of the codebook beam currently in use
+     * \return the beam ID, or std::nullopt if the beamforming vector in use was not
+     * selected from the codebook
+     */
+    std::optional<uint32_t> GetBeamId() const;
+
+    /**
+     * Returns the ID of the codebook in use. A new ID, unique among all the antenna
+     * arrays, is assigned every time the codebook is set, so that the computations
+     * cached for a beam ID can be told apart from those of a previous codebook
+     * \return the ID of the codebook in use
+     */
+    uint64_t GetCodebookId() const;
+
     /**
      * Sets the antenna model to be used
      * \param antennaElement the antenna model
@@ -244,12 +296,22 @@ class PhasedArrayModel : public Object
     uint32_t GetId() const;
 
   protected:
-    ComplexVector m_beamformingVector;  //!< the beamforming vector in use
-    Ptr<AntennaModel> m_antennaElement; //!< the model of the antenna element in use
-    bool m_isBfVectorValid;             //!< ensures the validity of the beamforming vector
+    /**
+     * Invalidates the beamforming vector and the codebook, which have to be set again
+     * because they do not refer to the current array configuration
+     */
+    void InvalidateBeamforming();
+
+    ComplexVector m_beamformingVector;     //!< the beamforming vector in use
+    std::vector<ComplexVector> m_codebook; //!< the codebook
+    std::optional<uint32_t> m_beamId;      //!< the ID of the codebook beam in use, if any
+    uint64_t m_codebookId{0};              //!< the ID of the codebook in use
+    Ptr<AntennaModel> m_antennaElement;    //!< the model of the antenna element in use
+    bool m_isBfVectorValid;                //!< ensures the validity of the beamforming vector
     static uint32_t
         m_idCounter;  //!< the ID counter that is used to determine the unique antenna array ID
     uint32_t m_id{0}; //!< the ID of this antenna array instance
+    static uint64_t m_codebookIdCounter; //!< the counter used to assign unique codebook IDs
 };
 
 } /* namespace ns3 */
@@ -103,7 +103,7 @@ UniformPlanarArray::SetNumColumns(uint32_t n)
     NS_LOG_FUNCTION(this << n);
     if (n != m_numColumns)
     {
-        m_isBfVectorValid = false;
+        InvalidateBeamforming();
     }
     m_numColumns = n;
 }
@@ -120,7 +120,7 @@ UniformPlanarArray::SetNumRows(uint32_t n)
     NS_LOG_FUNCTION(this << n);
     if (n != m_numRows)
     {
-        m_isBfVectorValid = false;
+        InvalidateBeamforming();
     }
     m_numRows = n;
 }
@@ -163,7 +163,7 @@ UniformPlanarArray::SetAntennaHorizontalSpacing(double s)
 
     if (s != m_disH)
     {
-        m_isBfVectorValid = false;
+        InvalidateBeamforming();
     }
     m_disH = s;
 }
@@ -182,7 +182,7 @@ UniformPlanarArray::SetAntennaVerticalSpacing(double s)
 
     if (s != m_disV)
     {
-        m_isBfVectorValid = false;
+        InvalidateBeamforming();
     }
     m_disV = s;
 }
@@ -12,6 +12,10 @@
 #include <Eigen/Dense>
 #endif
 
+#ifdef HAVE_BLAS
+#include <cblas.h>
+#endif
+
 namespace ns3
 {
 
@@ -22,6 +26,229 @@ template <class T>
 using ConstEigenMatrix = Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>>;
 #endif
 
+namespace
+{
+
+/**
+ * Minimum number of multiply-accumulate operations per page for which BLAS is used.
+ * For smaller matrices, the overhead of the BLAS call dominates.
+ */
+[[maybe_unused]] constexpr size_t BLAS_MIN_OPS = 4096;
+
+/**
+ * \ingroup Matrices
+ * Multiply two column-major matrices, i.e., res = op(lhs) * rhs, where op(lhs) is either
+ * lhs or its conjugate transpose.
+ *
+ * The columns of lhs scaled by the elements of rhs are accumulated, so that the
+ * innermost loop runs over contiguous memory and can be vectorized by the compiler.
+ *
+ * \tparam T the type of the elements
+ * \param lhs pointer to the left matrix
+ * \param rhs pointer to the right matrix
+ * \param res pointer to the result matrix, which must be zero-initialized
+ * \param m the number of rows of op(lhs) and res
+ * \param k the number of columns of op(lhs) and the number of rows of rhs
+ * \param n the number of columns of rhs and res
+ * \param conjTransLhs whether lhs has to be conjugate transposed
+ */
+template <class T>
+void
+LoopPageMultiply(const T* lhs,
+                 const T* rhs,
+                 T* res,
+                 size_t m,
+                 size_t k,
+                 size_t n,
+                 bool conjTransLhs)
+{
+    if (!conjTransLhs)
+    {
+        for (size_t j = 0; j < n; ++j)
+        {
+            T* resCol = res + j * m;
+            for (size_t l = 0; l < k; ++l)
+            {
+                const T rhsElem = rhs[j * k + l];
+                const T* lhsCol = lhs + l * m;
+                for (size_t i = 0; i < m; ++i)
+                {
+                    resCol[i] += lhsCol[i] * rhsElem;
+                }
+            }
+        }
+        return;
+    }
+    // lhs is k x m, each element of the result is the inner product of two columns
+    for (size_t j = 0; j < n; ++j)
+    {
+        const T* rhsCol = rhs + j * k;
+        for (size_t i = 0; i < m; ++i)
+        {
+            const T* lhsCol = lhs + i * k;
+            T sum{0};
+            for (size_t l = 0; l < k; ++l)
+            {
+                if constexpr (std::is_same_v<T, std::complex<double>>)
+                {
+                    sum += std::conj(lhsCol[l]) * rhsCol[l];
+                }
+                else
+                {
+                    sum += lhsCol[l] * rhsCol[l];
+                }
+            }
+            res[j * m + i] = sum;
+        }
+    }
+}
+
+/**
+ * \ingroup Matrices
+ * Multiply two column-major matrices, i.e., res = op(lhs) * rhs, where op(lhs) is either
+ * lhs or its conjugate transpose, using Eigen, if available.
+ *
+ * \tparam T the type of the elements
+ * \param lhs pointer to the left matrix
+ * \param rhs pointer to the right matrix
+ * \param res pointer to the result matrix, which must be zero-initialized
+ * \param m the number of rows of op(lhs) and res
+ * \param k the number of columns of op(lhs) and the number of rows of rhs
+ * \param n the number of columns of rhs and res
+ * \param conjTransLhs whether lhs has to be conjugate transposed
+ */
+template <class T>
+void
+SmallPageMultiply(const T* lhs,
+                  const T* rhs,
+                  T* res,
+                  size_t m,
+                  size_t k,
+                  size_t n,
+                  bool conjTransLhs)
+{
+#ifdef HAVE_EIGEN3 // Eigen found and Eigen optimizations enabled
+
+    ConstEigenMatrix<T> rhsEigenMatrix(rhs, k, n);
+    EigenMatrix<T> resEigenMatrix(res, m, n);
+    if (conjTransLhs)
+    {
+        ConstEigenMatrix<T> lhsEigenMatrix(lhs, k, m);
+        resEigenMatrix = lhsEigenMatrix.adjoint() * rhsEigenMatrix;
+    }
+    else
+    {
+        ConstEigenMatrix<T> lhsEigenMatrix(lhs, m, k);
+        resEigenMatrix = lhsEigenMatrix * rhsEigenMatrix;
+    }
+
+#else // Eigen not found or Eigen optimizations not enabled
+
+    LoopPageMultiply(lhs, rhs, res, m, k, n, conjTransLhs);
+
+#endif
+}
+
+/**
+ * \ingroup Matrices
+ * Multiply two column-major matrices, i.e., res = op(lhs) * rhs, where op(lhs) is either
+ * lhs or its conjugate transpose. BLAS is used for large matrices, if available, and
+ * SmallPageMultiply otherwise.
+ *
+ * \tparam T the type of the elements
+ * \param lhs pointer to the left matrix
+ * \param rhs pointer to the right matrix
+ * \param res pointer to the result matrix, which must be zero-initialized
+ * \param m the number of rows of op(lhs) and res
+ * \param k the number of columns of op(lhs) and the number of rows of rhs
+ * \param n the number of columns of rhs and res
+ * \param conjTransLhs whether lhs has to be conjugate transposed
+ */
+template <class T>
+void
+PageMultiply(const T* lhs, const T* rhs, T* res, size_t m, size_t k, size_t n, bool conjTransLhs)
+{
+    SmallPageMultiply(lhs, rhs, res, m, k, n, conjTransLhs);
+}
+
+#ifdef HAVE_BLAS
+/**
+ * \ingroup Matrices
+ * Specialization of PageMultiply for complex matrices
+ * \copydetails PageMultiply
+ */
+template <>
+void
+PageMultiply(const std::complex<double>* lhs,
+             const std::complex<double>* rhs,
+             std::complex<double>* res,
+             size_t m,
+             size_t k,
+             size_t n,
+             bool conjTransLhs)
+{
+    if (m * k * n < BLAS_MIN_OPS)
+    {
+        SmallPageMultiply(lhs, rhs, res, m, k, n, conjTransLhs);
+        return;
+    }
+    const std::complex<double> alpha{1.0};
+    const std::complex<double> beta{0.0};
+    cblas_zgemm(CblasColMajor,
+                conjTransLhs ? CblasConjTrans : CblasNoTrans,
+                CblasNoTrans,
+                m,
+                n,
+                k,
+                &alpha,
+                lhs,
+                conjTransLhs ? k : m,
+                rhs,
+                k,
+                &beta,
+                res,
+                m);
+}
+
+/**
+ * \ingroup Matrices
+ * Specialization of PageMultiply for real matrices
+ * \copydetails PageMultiply
+ */
+template <>
+void
+PageMultiply(const double* lhs,
+             const double* rhs,
+             double* res,
+             size_t m,
+             size_t k,
+             size_t n,
+             bool conjTransLhs)
+{
+    if (m * k * n < BLAS_MIN_OPS)
+    {
+        SmallPageMultiply(lhs, rhs, res, m, k, n, conjTransLhs);
+        return;
+    }
+    cblas_dgemm(CblasColMajor,
+                conjTransLhs ? CblasTrans : CblasNoTrans,
+                CblasNoTrans,
+                m,
+                n,
+                k,
+                1.0,
+                lhs,
+                conjTransLhs ? k : m,
+                rhs,
+                k,
+                0.0,
+                res,
+                m);
+}
+#endif
+
+} // namespace
+
 template <class T>
 MatrixArray<T>::MatrixArray(size_t numRows, size_t numCols, size_t numPages)
     : ValArray<T>(numRows, numCols, numPages)
@@ -87,30 +314,14 @@ MatrixArray<T>::operator*(const MatrixArray<T>& rhs) const
 
     for (size_t page = 0; page < res.m_numPages; ++page)
     {
-#ifdef HAVE_EIGEN3 // Eigen found and enabled Eigen optimizations
-
-        ConstEigenMatrix<T> lhsEigenMatrix(GetPagePtr(page), m_numRows, m_numCols);
-        ConstEigenMatrix<T> rhsEigenMatrix(rhs.GetPagePtr(page), rhs.m_numRows, rhs.m_numCols);
-        EigenMatrix<T> resEigenMatrix(res.GetPagePtr(page), res.m_numRows, res.m_numCols);
-        resEigenMatrix = lhsEigenMatrix * rhsEigenMatrix;
-
-#else // Eigen not found or Eigen optimizations not enabled
-
-        size_t matrixOffset = page * m_numRows * m_numCols;
-        size_t rhsMatrixOffset = page * rhs.m_numRows * rhs.m_numCols;
-        for (size_t i = 0; i < res.m_numRows; ++i)
-        {
-            for (size_t j = 0; j < res.m_numCols; ++j)
-            {
-                res(i, j, page) = (m_values[std::slice(matrixOffset + i, m_numCols, m_numRows)] *
-                                   rhs.m_values[std::slice(rhsMatrixOffset + j * rhs.m_numRows,
-                                                           rhs.m_numRows,
-                                                           1)])
-                                      .sum();
-            }
-        }
-
-#endif
+        // Eigen or the generic loop for small pages, BLAS for large pages if available
+        PageMultiply(GetPagePtr(page),
+                     rhs.GetPagePtr(page),
+                     res.GetPagePtr(page),
+                     m_numRows,
+                     m_numCols,
+                     rhs.m_numCols,
+                     false);
     }
     return res;
 }
@@ -168,23 +379,48 @@ MatrixArray<T>::Determinant() const
             res(0, 0, page) = pageValues[0] * pageValues[3] - pageValues[1] * pageValues[2];
             continue;
         }
-        for (size_t detN = 0; detN < m_numRows; detN++)
+        // Fraction-free Gaussian elimination (Bareiss algorithm) on a copy of the page: all
+        // the divisions are exact, hence the determinant of integer matrices is exact, too
+        const size_t n = m_numRows;
+        std::vector<T> a(pageValues, pageValues + n * n);
+        T sign{1};
+        T prevPivot{1};
+        bool singular = false;
+        for (size_t k = 0; k + 1 < n; ++k)
         {
-            auto partDetP = T{0} + 1.0;
-            auto partDetN = T{0} + 1.0;
-            for (size_t row = 0; row < m_numRows; row++)
+            size_t pivot = k;
+            for (size_t row = k + 1; row < n; ++row)
+            {
+                if (std::abs(a[k * n + row]) > std::abs(a[k * n + pivot]))
+                {
+                    pivot = row;
+                }
+            }
+            if (a[k * n + pivot] == T{0})
+            {
+                singular = true;
+                break;
+            }
+            if (pivot != k)
             {
-                // Wraparound not to have to extend the matrix
-                // Positive determinant
-                size_t col = (row + detN) % m_numCols;
-                partDetP *= pageValues[row * m_numCols + col];
-
-                // Negative determinant
-                col = m_numCols - 1 - (row + detN) % m_numCols;
-                partDetN *= pageValues[row * m_numCols + col];
+                for (size_t col = k; col < n; ++col)
+                {
+                    std::swap(a[col * n + k], a[col * n + pivot]);
+                }
+                sign = -sign;
+            }
+            for (size_t col = k + 1; col < n; ++col)
+            {
+                for (size_t row = k + 1; row < n; ++row)
+                {
+                    a[col * n + row] =
+                        (a[col * n + row] * a[k * n + k] - a[k * n + row] * a[col * n + k]) /
+                        prevPivot;
+                }
             }
-            res(0, 0, page) += partDetP - partDetN;
+            prevPivot = a[k * n + k];
         }
+        res(0, 0, page) = singular ? T{0} : sign * a[n * n - 1];
     }
     return res;
 }
@@ -282,6 +518,121 @@ MatrixArray<T>::HermitianTranspose() const
     return retMatrix;
 }
 
+template <class T>
+template <bool EnableBool, typename>
+MatrixArray<T>
+MatrixArray<T>::HermitianTransposeMultiply(const MatrixArray<T>& rhs) const
+{
+    NS_ASSERT_MSG(m_numPages == rhs.m_numPages, "MatrixArrays have different numbers of matrices.");
+    NS_ASSERT_MSG(m_numRows == rhs.m_numRows, "Inner dimensions of matrices mismatch.");
+
+    MatrixArray<T> res{m_numCols, rhs.m_numCols, m_numPages};
+
+    for (size_t page = 0; page < res.m_numPages; ++page)
+    {
+        PageMultiply(GetPagePtr(page),
+                     rhs.GetPagePtr(page),
+                     res.GetPagePtr(page),
+                     m_numCols,
+                     m_numRows,
+                     rhs.m_numCols,
+                     true);
+    }
+    return res;
+}
+
+template <class T>
+template <bool EnableBool, typename>
+MatrixArray<T>
+MatrixArray<T>::Inverse() const
+{
+    NS_ASSERT_MSG(m_numRows == m_numCols, "Matrix is not square");
+    MatrixArray<T> res{m_numRows, m_numCols, m_numPages};
+
+    for (size_t page = 0; page < m_numPages; ++page)
+    {
+        const T* a = GetPagePtr(page);
+        T* inv = res.GetPagePtr(page);
+
+        // Fast paths for 1x1 and 2x2 matrices
+        if (m_numRows == 1)
+        {
+            NS_ASSERT_MSG(std::abs(a[0]) > 0, "Matrix " << page << " is singular");
+            inv[0] = T{1.0} / a[0];
+            continue;
+        }
+        if (m_numRows == 2)
+        {
+            T det = a[0] * a[3] - a[1] * a[2];
+            NS_ASSERT_MSG(std::abs(det) > 0, "Matrix " << page << " is singular");
+            inv[0] = a[3] / det;
+            inv[1] = -a[1] / det;
+            inv[2] = -a[2] / det;
+            inv[3] = a[0] / det;
+            continue;
+        }
+
+#ifdef HAVE_EIGEN3 // Eigen found and Eigen optimizations enabled
+
+        ConstEigenMatrix<T> thisMatrix(a, m_numRows, m_numCols);
+        EigenMatrix<T> resEigenMatrix(inv, res.m_numRows, res.m_numCols);
+        resEigenMatrix = thisMatrix.partialPivLu().inverse();
+
+#else // Eigen not found or Eigen optimizations not enabled
+
+        // Gauss-Jordan elimination with partial pivoting on a copy of the page,
+        // applying the same row operations to the identity matrix
+        const size_t n = m_numRows;
+        std::vector<T> lu(a, a + n * n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            inv[i * n + i] = T{1.0};
+        }
+        for (size_t col = 0; col < n; ++col)
+        {
+            size_t pivot = col;
+            for (size_t row = col + 1; row < n; ++row)
+            {
+                if (std::abs(lu[col * n + row]) > std::abs(lu[col * n + pivot]))
+                {
+                    pivot = row;
+                }
+            }
+            NS_ASSERT_MSG(std::abs(lu[col * n + pivot]) > 0, "Matrix " << page << " is singular");
+            if (pivot != col)
+            {
+                for (size_t c = 0; c < n; ++c)
+                {
+                    std::swap(lu[c * n + col], lu[c * n + pivot]);
+                    std::swap(inv[c * n + col], inv[c * n + pivot]);
+                }
+            }
+            const T pivotInv = T{1.0} / lu[col * n + col];
+            for (size_t c = 0; c < n; ++c)
+            {
+                lu[c * n + col] *= pivotInv;
+                inv[c * n + col] *= pivotInv;
+            }
+            for (size_t row = 0; row < n; ++row)
+            {
+                if (row == col)
+                {
+                    continue;
+                }
+                const T factor = lu[col * n + row];
+                for (size_t c = 0; c < n; ++c)
+                {
+                    lu[c * n + row] -= factor * lu[c * n + col];
+                    inv[c * n + row] -= factor * inv[c * n + col];
+                }
+            }
+        }
+
+#endif
+    }
+    return res;
+}
+
 template <class T>
 MatrixArray<T>
 MatrixArray<T>::MakeNCopies(size_t nCopies) const
@@ -362,6 +713,11 @@ MatrixArray<T>::IdentityMatrix(const MatrixArray& likeme)
 
 template MatrixArray<std::complex<double>> MatrixArray<std::complex<double>>::HermitianTranspose()
     const;
+template MatrixArray<std::complex<double>>
+MatrixArray<std::complex<double>>::HermitianTransposeMultiply(
+    const MatrixArray<std::complex<double>>& rhs) const;
+template MatrixArray<std::complex<double>> MatrixArray<std::complex<double>>::Inverse() const;
+template MatrixArray<double> MatrixArray<double>::Inverse() const;
 template class MatrixArray<std::complex<double>>;
 template class MatrixArray<double>;
 template class MatrixArray<int>;
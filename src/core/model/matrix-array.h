@@ -228,6 +228,34 @@ class MatrixArray : public ValArray<T>
               typename = std::enable_if_t<(std::is_same_v<T, std::complex<double>> && EnableBool)>>
     MatrixArray<T> HermitianTranspose() const;
 
+    /**
+     * \brief Page-wise multiplication of the Hermitian transpose of this MatrixArray
+     * by rhs, i.e., for each page the operation performed is matrix(pageIndex)^H *
+     * rhs(pageIndex). The Hermitian transpose is not explicitly computed, hence this
+     * function is faster than HermitianTranspose() followed by operator*.
+     * The number of rows of this MatrixArray must be equal to the number of rows
+     * in rhs, and rhs must have the same number of pages as this MatrixArray.
+     * This function is only available for the <std::complex<double>> specialization
+     * of MatrixArray.
+     * \param rhs is another MatrixArray instance
+     * \return The array of results of the matrix multiplications.
+     */
+    template <bool EnableBool = true,
+              typename = std::enable_if_t<(std::is_same_v<T, std::complex<double>> && EnableBool)>>
+    MatrixArray<T> HermitianTransposeMultiply(const MatrixArray<T>& rhs) const;
+
+    /**
+     * \brief Page-wise matrix inversion. Each page must be a square, non-singular matrix.
+     * Closed-form expressions are used for 1x1 and 2x2 matrices, which are the most common
+     * in MIMO computations, while larger matrices are inverted through an LU decomposition
+     * with partial pivoting.
+     * This function is only available for floating point MatrixArray specializations.
+     * \return The resulting MatrixArray composed of the array of inverted matrices.
+     */
+    template <bool EnableBool = true,
+              typename = std::enable_if_t<(!std::is_integral_v<T> && EnableBool)>>
+    MatrixArray<T> Inverse() const;
+
     /**
      * \brief Function that copies the current 1-page matrix into a new matrix with n copies of the
      * original matrix
@@ -10,6 +10,8 @@
 #include "ns3/matrix-array.h"
 #include "ns3/test.h"
 
+#include <cmath>
+
 /**
  * \defgroup matrixArray-tests MatrixArray tests
  * \ingroup core-tests
@@ -465,8 +467,14 @@ MatrixArrayTestCase<T>::DoRun()
             {{1, 0, 0, 0, 1, 0, 0, 0, 1}, 1},
             // identity rank 4
             {{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1}, 1},
-            // permutation matrix rank 4
-            {{0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0}, -1},
+            // permutation matrix rank 4 (two swaps)
+            {{0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0}, 1},
+            // random matrix rank 4
+            {{2, 0, 1, 3, 1, 4, 0, 2, 0, 3, 1, 1, 1, 0, 2, 5}, 31},
+            // random matrix rank 5, with a zero in the first pivot position
+            {{0, 2, 1, 0, 3, 1, 0, 4, 2, 0, 3, 1, 0, 0, 2, 0, 5, 1, 3, 1, 2, 0, 0, 1, 4}, 480},
+            // singular matrix rank 4
+            {{1, 2, 3, 4, 2, 4, 6, 8, 0, 1, 0, 1, 1, 0, 1, 0}, 0},
             // positive det matrix rank 2
             {{36, -5, -5, 43}, 1523},
             // single value matrix rank 1
@@ -678,6 +686,83 @@ ComplexMatrixArrayTestCase::DoRun()
     NS_LOG_INFO("m2 (2, 3, 2):" << m2);
     NS_LOG_INFO("m3 (2, 3, 2):" << m3);
     NS_TEST_ASSERT_MSG_EQ(m2, m3, "m2 and m3 matrices should be equal");
+
+    // The product by the Hermitian transpose must match the explicit computation
+    ComplexMatrixArray m4 = m1.HermitianTransposeMultiply(m1);
+    ComplexMatrixArray m5 = m3 * m1;
+    NS_LOG_INFO("m4 (2, 2, 2):" << m4);
+    NS_TEST_ASSERT_MSG_EQ(m4.GetNumRows(), 2, "The number of rows should be 2");
+    NS_TEST_ASSERT_MSG_EQ(m4.GetNumCols(), 2, "The number of cols should be 2");
+    NS_TEST_ASSERT_MSG_EQ(m4.IsAlmostEqual(m5, 1e-12),
+                          true,
+                          "HermitianTransposeMultiply should be equal to HermitianTranspose "
+                          "followed by the matrix product");
+
+    // Large matrices exercise the BLAS kernels, if enabled
+    const size_t size = 32;
+    ComplexMatrixArray a{size, size, 2};
+    ComplexMatrixArray b{size, size, 2};
+    for (size_t page = 0; page < 2; ++page)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            for (size_t j = 0; j < size; ++j)
+            {
+                a(i, j, page) = std::complex<double>(std::sin(i + 2.0 * j + page), std::cos(i * j));
+                b(i, j, page) = std::complex<double>(std::cos(3.0 * i + j), std::sin(i - j + page));
+            }
+        }
+    }
+    ComplexMatrixArray ab = a * b;
+    ComplexMatrixArray ahb = a.HermitianTransposeMultiply(b);
+    ComplexMatrixArray ah = a.HermitianTranspose();
+    bool mulOk = true;
+    bool hmulOk = true;
+    for (size_t page = 0; page < 2; ++page)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            for (size_t j = 0; j < size; ++j)
+            {
+                std::complex<double> expected{0};
+                std::complex<double> expectedH{0};
+                for (size_t k = 0; k < size; ++k)
+                {
+                    expected += a(i, k, page) * b(k, j, page);
+                    expectedH += ah(i, k, page) * b(k, j, page);
+                }
+                mulOk = mulOk && std::abs(ab(i, j, page) - expected) < 1e-9;
+                hmulOk = hmulOk && std::abs(ahb(i, j, page) - expectedH) < 1e-9;
+            }
+        }
+    }
+    NS_TEST_ASSERT_MSG_EQ(mulOk, true, "Wrong product of large complex matrices");
+    NS_TEST_ASSERT_MSG_EQ(hmulOk, true, "Wrong Hermitian transpose product of large matrices");
+
+    // The inverse multiplied by the matrix itself must be the identity,
+    // for the closed-form (1x1, 2x2) and generic cases
+    for (size_t n : {1, 2, 3, 5})
+    {
+        ComplexMatrixArray c{n, n, 2};
+        ComplexMatrixArray identity{n, n, 2};
+        for (size_t page = 0; page < 2; ++page)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                identity(i, i, page) = 1;
+                for (size_t j = 0; j < n; ++j)
+                {
+                    // Diagonally dominant, hence non-singular
+                    c(i, j, page) = std::complex<double>((i == j) ? 2.0 * n + page : 0.5,
+                                                         std::sin(i + 3.0 * j + page));
+                }
+            }
+        }
+        ComplexMatrixArray product = c * c.Inverse();
+        NS_TEST_ASSERT_MSG_EQ(product.IsAlmostEqual(identity, 1e-12),
+                              true,
+                              "The product of a matrix and its inverse should be the identity");
+    }
 }
 
 /**
@@ -21,6 +21,7 @@
 #include "ns3/queue.h"
 #include "ns3/simulator.h"
 #include "ns3/trace-source-accessor.h"
+#include "ns3/tso-tag.h"
 #include "ns3/uinteger.h"
 
 namespace ns3
@@ -517,7 +518,12 @@ CsmaNetDevice::TransmitStart()
             m_backoff.ResetBackoffTime();
             m_txMachineState = BUSY;
 
-            Time tEvent = m_bps.CalculateBytesTxTime(m_currentPkt->GetSize());
+            // a packet carrying several segments takes the time needed to transmit all of them
+            TsoTag tsoTag;
+            uint32_t size = m_currentPkt->PeekPacketTag(tsoTag)
+                                ? tsoTag.GetWireSize(m_currentPkt->GetSize())
+                                : m_currentPkt->GetSize();
+            Time tEvent = m_bps.CalculateBytesTxTime(size);
             NS_LOG_LOGIC("Schedule TransmitCompleteEvent in " << tEvent.As(Time::S));
             Simulator::Schedule(tEvent, &CsmaNetDevice::TransmitCompleteEvent, this);
         }
@@ -11,6 +11,7 @@
 #include "ns3/ipv4-global-routing.h"
 #include "ns3/ipv4-list-routing.h"
 #include "ns3/log.h"
+#include "ns3/node-list.h"
 
 namespace ns3
 {
@@ -61,4 +62,37 @@ Ipv4GlobalRoutingHelper::RecomputeRoutingTables()
     GlobalRouteManager::InitializeRoutes();
 }
 
+void
+Ipv4GlobalRoutingHelper::PrintRoutesMemoryUsage(Ptr<OutputStreamWrapper> stream)
+{
+    std::ostream* os = stream->GetStream();
+    Ptr<const Ipv4GlobalRoutingDestinations> destinations;
+    std::size_t total = 0;
+    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    {
+        Ptr<GlobalRouter> router = (*i)->GetObject<GlobalRouter>();
+        if (!router)
+        {
+            continue;
+        }
+        Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
+        auto bytes = gr->GetRoutesMemoryUsage();
+        *os << "Node: " << (*i)->GetId() << ", routes: " << gr->GetNRoutes()
+            << ", compact routes: " << gr->GetNCompactRoutes() << ", memory: " << bytes
+            << " bytes" << std::endl;
+        total += bytes;
+        if (!destinations)
+        {
+            destinations = gr->GetCompactRouteDestinations();
+        }
+    }
+    if (destinations)
+    {
+        *os << "Compact route destinations: " << destinations->GetN()
+            << ", memory: " << destinations->GetMemoryUsage() << " bytes" << std::endl;
+        total += destinations->GetMemoryUsage();
+    }
+    *os << "Total memory: " << total << " bytes" << std::endl;
+}
+
 } // namespace ns3
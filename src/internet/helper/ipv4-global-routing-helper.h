@@ -78,6 +78,18 @@ class Ipv4GlobalRoutingHelper : public Ipv4RoutingHelper
      *
      */
     static void RecomputeRoutingTables();
+
+    /**
+     * \brief Print an estimate of the memory used by the global routes of every node.
+     *
+     * For every node having a GlobalRouter interface, the number of routing table entries,
+     * the number of compact routes and the estimated memory used by the routes are
+     * printed, followed by the memory used by the destinations of the compact routes,
+     * which are shared by all the nodes.
+     *
+     * \param stream The output stream object to use
+     */
+    static void PrintRoutesMemoryUsage(Ptr<OutputStreamWrapper> stream);
 };
 
 } // namespace ns3
@@ -19,6 +19,8 @@
 #include "ns3/trace-source-accessor.h"
 #include "ns3/uinteger.h"
 
+#include <vector>
+
 namespace ns3
 {
 
@@ -188,9 +190,13 @@ ArpCache::HandleWaitReplyTimeout()
     NS_LOG_FUNCTION(this);
     ArpCache::Entry* entry;
     bool restartWaitReplyTimer = false;
-    for (auto i = m_arpCache.begin(); i != m_arpCache.end(); i++)
+    // Only visit the entries waiting for a reply, in the order of their address. The
+    // entries leave the set when they are marked dead, hence iterate on a copy
+    std::vector<Ipv4Address> waitReplyEntries(m_waitReplyEntries.begin(),
+                                              m_waitReplyEntries.end());
+    for (const auto& address : waitReplyEntries)
     {
-        entry = (*i).second;
+        entry = Lookup(address);
         if (entry != nullptr && entry->IsWaitReply())
         {
             if (entry->GetRetries() < m_maxRetries)
@@ -238,7 +244,9 @@ ArpCache::Flush()
     {
         delete (*i).second;
     }
-    m_arpCache.erase(m_arpCache.begin(), m_arpCache.end());
+    m_arpCache.clear();
+    m_macIndex.clear();
+    m_waitReplyEntries.clear();
     if (m_waitReplyTimer.IsPending())
     {
         NS_LOG_LOGIC("Stopping WaitReplyTimer at " << Simulator::Now().GetSeconds()
@@ -253,7 +261,9 @@ ArpCache::PrintArpCache(Ptr<OutputStreamWrapper> stream)
     NS_LOG_FUNCTION(this << stream);
     std::ostream* os = stream->GetStream();
 
-    for (auto i = m_arpCache.begin(); i != m_arpCache.end(); i++)
+    // print the entries in the order of their address
+    std::map<Ipv4Address, ArpCache::Entry*> entries(m_arpCache.begin(), m_arpCache.end());
+    for (auto i = entries.begin(); i != entries.end(); i++)
     {
         *os << i->first << " dev ";
         std::string found = Names::FindName(m_device);
@@ -300,8 +310,9 @@ ArpCache::RemoveAutoGeneratedEntries()
         if (i->second->IsAutoGenerated())
         {
             i->second->ClearPendingPacket(); // clear the pending packets for entry's ipaddress
+            RemoveFromIndexes(i->second);
             delete i->second;
-            m_arpCache.erase(i++);
+            i = m_arpCache.erase(i);
             continue;
         }
         i++;
@@ -314,13 +325,10 @@ ArpCache::LookupInverse(Address to)
     NS_LOG_FUNCTION(this << to);
 
     std::list<ArpCache::Entry*> entryList;
-    for (auto i = m_arpCache.begin(); i != m_arpCache.end(); i++)
+    auto [first, last] = m_macIndex.equal_range(to);
+    for (auto i = first; i != last; i++)
     {
-        ArpCache::Entry* entry = (*i).second;
-        if (entry->GetMacAddress() == to)
-        {
-            entryList.push_back(entry);
-        }
+        entryList.push_back(i->second);
     }
     return entryList;
 }
@@ -345,6 +353,7 @@ ArpCache::Add(Ipv4Address to)
 
     auto entry = new ArpCache::Entry(this);
     m_arpCache[to] = entry;
+    m_macIndex.emplace(entry->GetMacAddress(), entry);
     entry->SetIpv4Address(to);
     return entry;
 }
@@ -354,17 +363,57 @@ ArpCache::Remove(ArpCache::Entry* entry)
 {
     NS_LOG_FUNCTION(this << entry);
 
-    for (auto i = m_arpCache.begin(); i != m_arpCache.end(); i++)
+    auto it = m_arpCache.find(entry->GetIpv4Address());
+    if (it != m_arpCache.end() && it->second == entry)
+    {
+        m_arpCache.erase(it);
+        RemoveFromIndexes(entry);
+        entry->ClearPendingPacket(); // clear the pending packets for entry's ipaddress
+        delete entry;
+        return;
+    }
+    NS_LOG_WARN("Entry not found in this ARP Cache");
+}
+
+void
+ArpCache::UpdateMacIndex(ArpCache::Entry* entry,
+                         const Address& oldMacAddress,
+                         const Address& newMacAddress)
+{
+    NS_LOG_FUNCTION(this << entry << oldMacAddress << newMacAddress);
+    if (oldMacAddress == newMacAddress)
     {
-        if ((*i).second == entry)
+        return;
+    }
+    auto [first, last] = m_macIndex.equal_range(oldMacAddress);
+    for (auto i = first; i != last; i++)
+    {
+        if (i->second == entry)
         {
-            m_arpCache.erase(i);
-            entry->ClearPendingPacket(); // clear the pending packets for entry's ipaddress
-            delete entry;
-            return;
+            m_macIndex.erase(i);
+            break;
         }
     }
-    NS_LOG_WARN("Entry not found in this ARP Cache");
+    m_macIndex.emplace(newMacAddress, entry);
+}
+
+void
+ArpCache::RemoveFromIndexes(ArpCache::Entry* entry)
+{
+    NS_LOG_FUNCTION(this << entry);
+    auto [first, last] = m_macIndex.equal_range(entry->GetMacAddress());
+    for (auto i = first; i != last; i++)
+    {
+        if (i->second == entry)
+        {
+            m_macIndex.erase(i);
+            break;
+        }
+    }
+    if (entry->IsWaitReply())
+    {
+        m_waitReplyEntries.erase(entry->GetIpv4Address());
+    }
 }
 
 ArpCache::Entry::Entry(ArpCache* arp)
@@ -415,7 +464,7 @@ ArpCache::Entry::MarkDead()
 {
     NS_LOG_FUNCTION(this);
     NS_ASSERT(m_state == ALIVE || m_state == WAIT_REPLY || m_state == DEAD);
-    m_state = DEAD;
+    SetState(DEAD);
     ClearRetries();
     UpdateSeen();
 }
@@ -425,8 +474,9 @@ ArpCache::Entry::MarkAlive(Address macAddress)
 {
     NS_LOG_FUNCTION(this << macAddress);
     NS_ASSERT(m_state == WAIT_REPLY);
+    m_arp->UpdateMacIndex(this, m_macAddress, macAddress);
     m_macAddress = macAddress;
-    m_state = ALIVE;
+    SetState(ALIVE);
     ClearRetries();
     UpdateSeen();
 }
@@ -437,7 +487,7 @@ ArpCache::Entry::MarkPermanent()
     NS_LOG_FUNCTION(this << m_macAddress);
     NS_ASSERT(!m_macAddress.IsInvalid());
 
-    m_state = PERMANENT;
+    SetState(PERMANENT);
     ClearRetries();
     UpdateSeen();
 }
@@ -448,7 +498,7 @@ ArpCache::Entry::MarkAutoGenerated()
     NS_LOG_FUNCTION(this << m_macAddress);
     NS_ASSERT(!m_macAddress.IsInvalid());
 
-    m_state = STATIC_AUTOGENERATED;
+    SetState(STATIC_AUTOGENERATED);
     ClearRetries();
     UpdateSeen();
 }
@@ -478,7 +528,7 @@ ArpCache::Entry::MarkWaitReply(Ipv4PayloadHeaderPair waiting)
     NS_ASSERT(m_pending.empty());
     NS_ASSERT_MSG(waiting.first, "Can not add a null packet to the ARP queue");
 
-    m_state = WAIT_REPLY;
+    SetState(WAIT_REPLY);
     m_pending.push_back(waiting);
     UpdateSeen();
     m_arp->StartWaitReplyTimer();
@@ -495,6 +545,7 @@ void
 ArpCache::Entry::SetMacAddress(Address macAddress)
 {
     NS_LOG_FUNCTION(this);
+    m_arp->UpdateMacIndex(this, m_macAddress, macAddress);
     m_macAddress = macAddress;
 }
 
@@ -512,6 +563,21 @@ ArpCache::Entry::SetIpv4Address(Ipv4Address destination)
     m_ipv4Address = destination;
 }
 
+void
+ArpCache::Entry::SetState(ArpCacheEntryState_e state)
+{
+    NS_LOG_FUNCTION(this << state);
+    if (state == WAIT_REPLY)
+    {
+        m_arp->m_waitReplyEntries.insert(m_ipv4Address);
+    }
+    else if (m_state == WAIT_REPLY)
+    {
+        m_arp->m_waitReplyEntries.erase(m_ipv4Address);
+    }
+    m_state = state;
+}
+
 Time
 ArpCache::Entry::GetTimeout() const
 {
@@ -22,7 +22,9 @@
 
 #include <list>
 #include <map>
+#include <set>
 #include <stdint.h>
+#include <unordered_map>
 
 namespace ns3
 {
@@ -297,6 +299,12 @@ class ArpCache : public Object
          */
         Time GetTimeout() const;
 
+        /**
+         * \brief Set the state of the entry, and update the entries waiting for a reply.
+         * \param state the new state
+         */
+        void SetState(ArpCacheEntryState_e state);
+
         ArpCache* m_arp;              //!< pointer to the ARP cache owning the entry
         ArpCacheEntryState_e m_state; //!< state of the entry
         Time m_lastSeen;              //!< last moment a packet from that address has been seen
@@ -310,14 +318,31 @@ class ArpCache : public Object
     /**
      * \brief ARP Cache container
      */
-    typedef std::map<Ipv4Address, ArpCache::Entry*> Cache;
+    typedef std::unordered_map<Ipv4Address, ArpCache::Entry*, Ipv4AddressHash> Cache;
     /**
      * \brief ARP Cache container iterator
      */
-    typedef std::map<Ipv4Address, ArpCache::Entry*>::iterator CacheI;
+    typedef Cache::iterator CacheI;
 
     void DoDispose() override;
 
+    /**
+     * \brief Update the index of the entries by MAC address.
+     * \param entry the entry
+     * \param oldMacAddress the previous MAC address of the entry
+     * \param newMacAddress the new MAC address of the entry
+     */
+    void UpdateMacIndex(ArpCache::Entry* entry,
+                        const Address& oldMacAddress,
+                        const Address& newMacAddress);
+
+    /**
+     * \brief Remove an entry from the index by MAC address and from the entries
+     * waiting for a reply.
+     * \param entry the entry
+     */
+    void RemoveFromIndexes(ArpCache::Entry* entry);
+
     Ptr<NetDevice> m_device;        //!< NetDevice associated with the cache
     Ptr<Ipv4Interface> m_interface; //!< Ipv4Interface associated with the cache
     Time m_aliveTimeout;            //!< cache alive state timeout
@@ -338,6 +363,9 @@ class ArpCache : public Object
     Cache m_arpCache;            //!< the ARP cache
     TracedCallback<Ptr<const Packet>>
         m_dropTrace; //!< trace for packets dropped by the ARP cache queue
+
+    std::multimap<Address, ArpCache::Entry*> m_macIndex; //!< entries indexed by MAC address
+    std::set<Ipv4Address> m_waitReplyEntries;            //!< addresses of the WAIT_REPLY entries
 };
 
 } // namespace ns3
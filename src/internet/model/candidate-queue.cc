@@ -47,13 +47,14 @@ operator<<(std::ostream& os, const SPFVertex::VertexType& t)
 std::ostream&
 operator<<(std::ostream& os, const CandidateQueue& q)
 {
-    const CandidateQueue::CandidateList_t& list = q.m_candidates;
+    CandidateQueue::CandidateList_t list = q.m_candidates;
+    std::sort(list.begin(), list.end(), &CandidateQueue::CompareCandidate);
 
     os << "*** CandidateQueue Begin (<id, distance, LSA-type>) ***" << std::endl;
     for (auto iter = list.begin(); iter != list.end(); iter++)
     {
-        os << "<" << (*iter)->GetVertexId() << ", " << (*iter)->GetDistanceFromRoot() << ", "
-           << (*iter)->GetVertexType() << ">" << std::endl;
+        os << "<" << iter->vertex->GetVertexId() << ", " << iter->vertex->GetDistanceFromRoot()
+           << ", " << iter->vertex->GetVertexType() << ">" << std::endl;
     }
     os << "*** CandidateQueue End ***";
     return os;
@@ -88,11 +89,11 @@ CandidateQueue::Push(SPFVertex* vNew)
 {
     NS_LOG_FUNCTION(this << vNew);
 
-    auto i = std::upper_bound(m_candidates.begin(),
-                              m_candidates.end(),
-                              vNew,
-                              &CandidateQueue::CompareSPFVertex);
-    m_candidates.insert(i, vNew);
+    NS_ASSERT_MSG(!m_positions.contains(vNew), "Vertex already in the queue");
+    m_vertexIds.emplace(vNew->GetVertexId(), vNew);
+    m_candidates.emplace_back();
+    Place(m_candidates.size() - 1, {vNew, m_nextOrder++});
+    SiftUp(m_candidates.size() - 1);
 }
 
 SPFVertex*
@@ -104,8 +105,20 @@ CandidateQueue::Pop()
         return nullptr;
     }
 
-    SPFVertex* v = m_candidates.front();
-    m_candidates.pop_front();
+    SPFVertex* v = m_candidates.front().vertex;
+    m_positions.erase(v);
+    auto [first, last] = m_vertexIds.equal_range(v->GetVertexId());
+    m_vertexIds.erase(std::find_if(first, last, [v](const auto& item) {
+        return item.second == v;
+    }));
+
+    auto back = m_candidates.back();
+    m_candidates.pop_back();
+    if (!m_candidates.empty())
+    {
+        Place(0, back);
+        SiftDown(0);
+    }
     return v;
 }
 
@@ -118,7 +131,7 @@ CandidateQueue::Top() const
         return nullptr;
     }
 
-    return m_candidates.front();
+    return m_candidates.front().vertex;
 }
 
 bool
@@ -139,18 +152,32 @@ SPFVertex*
 CandidateQueue::Find(const Ipv4Address addr) const
 {
     NS_LOG_FUNCTION(this);
-    auto i = m_candidates.begin();
+    auto [first, last] = m_vertexIds.equal_range(addr);
 
-    for (; i != m_candidates.end(); i++)
+    // if several vertices have the given address, return the first one to be popped
+    SPFVertex* found = nullptr;
+    for (auto it = first; it != last; ++it)
     {
-        SPFVertex* v = *i;
-        if (v->GetVertexId() == addr)
+        if (!found || CompareCandidate(m_candidates[m_positions.at(it->second)],
+                                       m_candidates[m_positions.at(found)]))
         {
-            return v;
+            found = it->second;
         }
     }
+    return found;
+}
+
+void
+CandidateQueue::Update(SPFVertex* v)
+{
+    NS_LOG_FUNCTION(this << v);
 
-    return nullptr;
+    auto it = m_positions.find(v);
+    NS_ASSERT_MSG(it != m_positions.end(), "Vertex not in the queue");
+    // the distance of the vertex has been reduced, hence it can only move towards the top
+    auto pos = it->second;
+    m_candidates[pos].order = m_nextOrder++;
+    SiftUp(pos);
 }
 
 void
@@ -158,11 +185,79 @@ CandidateQueue::Reorder()
 {
     NS_LOG_FUNCTION(this);
 
-    m_candidates.sort(&CandidateQueue::CompareSPFVertex);
+    std::make_heap(m_candidates.begin(),
+                   m_candidates.end(),
+                   [](const Candidate& c1, const Candidate& c2) {
+                       return CompareCandidate(c2, c1);
+                   });
+    for (std::size_t pos = 0; pos < m_candidates.size(); ++pos)
+    {
+        m_positions[m_candidates[pos].vertex] = pos;
+    }
     NS_LOG_LOGIC("After reordering the CandidateQueue");
     NS_LOG_LOGIC(*this);
 }
 
+void
+CandidateQueue::Place(std::size_t pos, const Candidate& candidate)
+{
+    m_candidates[pos] = candidate;
+    m_positions[candidate.vertex] = pos;
+}
+
+void
+CandidateQueue::SiftUp(std::size_t pos)
+{
+    auto candidate = m_candidates[pos];
+    while (pos > 0)
+    {
+        auto parent = (pos - 1) / 2;
+        if (!CompareCandidate(candidate, m_candidates[parent]))
+        {
+            break;
+        }
+        Place(pos, m_candidates[parent]);
+        pos = parent;
+    }
+    Place(pos, candidate);
+}
+
+void
+CandidateQueue::SiftDown(std::size_t pos)
+{
+    auto candidate = m_candidates[pos];
+    auto size = m_candidates.size();
+    while (2 * pos + 1 < size)
+    {
+        auto child = 2 * pos + 1;
+        if (child + 1 < size && CompareCandidate(m_candidates[child + 1], m_candidates[child]))
+        {
+            ++child;
+        }
+        if (!CompareCandidate(m_candidates[child], candidate))
+        {
+            break;
+        }
+        Place(pos, m_candidates[child]);
+        pos = child;
+    }
+    Place(pos, candidate);
+}
+
+bool
+CandidateQueue::CompareCandidate(const Candidate& c1, const Candidate& c2)
+{
+    if (CompareSPFVertex(c1.vertex, c2.vertex))
+    {
+        return true;
+    }
+    if (CompareSPFVertex(c2.vertex, c1.vertex))
+    {
+        return false;
+    }
+    return c1.order < c2.order;
+}
+
 /*
  * In this implementation, SPFVertex follows the ordering where
  * a vertex is ranked first if its GetDistanceFromRoot () is smaller;
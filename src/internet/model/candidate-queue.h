@@ -11,8 +11,9 @@
 
 #include "ns3/ipv4-address.h"
 
-#include <list>
 #include <stdint.h>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -35,8 +36,14 @@ class SPFVertex;
  *
  * Although a STL priority_queue almost does what we want, the requirement
  * for a Find () operation, the dynamic nature of the data and the derived
- * requirement for a Reorder () operation led us to implement this simple
- * enhanced priority queue.
+ * requirement for an Update () operation led us to implement this
+ * enhanced priority queue: a binary heap, together with an index of the
+ * position of every vertex in the heap and an index of the vertices by
+ * vertex ID, so that Push (), Pop (), Find () and Update () do not need to
+ * walk the whole queue.
+ *
+ * Vertices with the same priority are popped in the order in which they
+ * were pushed (or updated, for the vertices whose distance was reduced).
  */
 class CandidateQueue
 {
@@ -133,6 +140,18 @@ class CandidateQueue
      */
     SPFVertex* Find(const Ipv4Address addr) const;
 
+    /**
+     * @brief Move a vertex in the Candidate Queue after its distance from the
+     * root has been reduced.
+     *
+     * The vertex is moved according to the priority scheme, behind the
+     * vertices having the same priority.
+     *
+     * @see SPFVertex
+     * @param v The Shortest Path First Vertex, which must be in the queue.
+     */
+    void Update(SPFVertex* v);
+
     /**
      * @brief Reorders the Candidate Queue according to the priority scheme.
      *
@@ -142,7 +161,8 @@ class CandidateQueue
      * increasing distance.
      *
      * This method is provided in case the values of m_distanceFromRoot change
-     * during the routing calculations.
+     * during the routing calculations.  When the vertex whose distance changed
+     * is known, Update () is more efficient.
      *
      * @see SPFVertex
      */
@@ -162,8 +182,56 @@ class CandidateQueue
      */
     static bool CompareSPFVertex(const SPFVertex* v1, const SPFVertex* v2);
 
-    typedef std::list<SPFVertex*> CandidateList_t; //!< container of SPFVertex pointers
-    CandidateList_t m_candidates;                  //!< SPFVertex candidates
+    /**
+     * \brief An entry of the heap.
+     */
+    struct Candidate
+    {
+        SPFVertex* vertex; //!< the vertex
+        uint64_t order;    //!< the order of the vertex among the vertices with the same priority
+    };
+
+    /**
+     * \brief return true if c1 should be popped before c2
+     *
+     * \param c1 first operand
+     * \param c2 second operand
+     * \return True if c1 should be popped before c2; false otherwise
+     */
+    static bool CompareCandidate(const Candidate& c1, const Candidate& c2);
+
+    /**
+     * \brief Move the entry at the given position of the heap towards the top
+     * until the heap property is restored.
+     *
+     * \param pos the position of the entry
+     */
+    void SiftUp(std::size_t pos);
+
+    /**
+     * \brief Move the entry at the given position of the heap towards the bottom
+     * until the heap property is restored.
+     *
+     * \param pos the position of the entry
+     */
+    void SiftDown(std::size_t pos);
+
+    /**
+     * \brief Store an entry at the given position of the heap.
+     *
+     * \param pos the position
+     * \param candidate the entry
+     */
+    void Place(std::size_t pos, const Candidate& candidate);
+
+    typedef std::vector<Candidate> CandidateList_t; //!< container of SPFVertex pointers
+    CandidateList_t m_candidates;                   //!< SPFVertex candidates, as a binary heap
+
+    /// position of every vertex in the heap
+    std::unordered_map<const SPFVertex*, std::size_t> m_positions;
+    /// vertices in the queue, by vertex ID
+    std::unordered_multimap<Ipv4Address, SPFVertex*, Ipv4AddressHash> m_vertexIds;
+    uint64_t m_nextOrder{0}; //!< order of the next vertex pushed or updated
 
     /**
      * \brief Stream insertion operator.
@@ -458,9 +458,25 @@ GlobalRouteManagerLSDB::Insert(Ipv4Address addr, GlobalRoutingLSA* lsa)
     {
         m_extdatabase.push_back(lsa);
     }
-    else
+    else if (m_database.insert(LSDBPair_t(addr, lsa)).second)
     {
-        m_database.insert(LSDBPair_t(addr, lsa));
+        //
+        // Index the TransitNetwork link records by link data.  If several LSAs have
+        // the same link data, the first one in database order is kept.
+        //
+        for (uint32_t j = 0; j < lsa->GetNLinkRecords(); j++)
+        {
+            GlobalRoutingLinkRecord* lr = lsa->GetLinkRecord(j);
+            if (lr->GetLinkType() != GlobalRoutingLinkRecord::TransitNetwork)
+            {
+                continue;
+            }
+            auto [it, inserted] = m_linkDataIndex.emplace(lr->GetLinkData(), LSDBPair_t(addr, lsa));
+            if (!inserted && addr < it->second.first)
+            {
+                it->second = LSDBPair_t(addr, lsa);
+            }
+        }
     }
 }
 
@@ -485,14 +501,8 @@ GlobalRouteManagerLSDB::GetLSA(Ipv4Address addr) const
     //
     // Look up an LSA by its address.
     //
-    for (auto i = m_database.begin(); i != m_database.end(); i++)
-    {
-        if (i->first == addr)
-        {
-            return i->second;
-        }
-    }
-    return nullptr;
+    auto it = m_database.find(addr);
+    return it != m_database.end() ? it->second : nullptr;
 }
 
 GlobalRoutingLSA*
@@ -500,23 +510,10 @@ GlobalRouteManagerLSDB::GetLSAByLinkData(Ipv4Address addr) const
 {
     NS_LOG_FUNCTION(this << addr);
     //
-    // Look up an LSA by its address.
+    // Look up an LSA by the link data of its TransitNetwork link records.
     //
-    for (auto i = m_database.begin(); i != m_database.end(); i++)
-    {
-        GlobalRoutingLSA* temp = i->second;
-        // Iterate among temp's Link Records
-        for (uint32_t j = 0; j < temp->GetNLinkRecords(); j++)
-        {
-            GlobalRoutingLinkRecord* lr = temp->GetLinkRecord(j);
-            if (lr->GetLinkType() == GlobalRoutingLinkRecord::TransitNetwork &&
-                lr->GetLinkData() == addr)
-            {
-                return temp;
-            }
-        }
-    }
-    return nullptr;
+    auto it = m_linkDataIndex.find(addr);
+    return it != m_linkDataIndex.end() ? it->second.second : nullptr;
 }
 
 // ---------------------------------------------------------------------------
@@ -530,6 +527,7 @@ GlobalRouteManagerImpl::GlobalRouteManagerImpl()
 {
     NS_LOG_FUNCTION(this);
     m_lsdb = new GlobalRouteManagerLSDB();
+    m_destinations = Create<Ipv4GlobalRoutingDestinations>();
 }
 
 GlobalRouteManagerImpl::~GlobalRouteManagerImpl()
@@ -565,19 +563,11 @@ GlobalRouteManagerImpl::DeleteGlobalRoutes()
             continue;
         }
         Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
-        uint32_t j = 0;
-        uint32_t nRoutes = gr->GetNRoutes();
         NS_LOG_LOGIC("Deleting " << gr->GetNRoutes() << " routes from node " << node->GetId());
-        // Each time we delete route 0, the route index shifts downward
-        // We can delete all routes if we delete the route numbered 0
-        // nRoutes times
-        for (j = 0; j < nRoutes; j++)
-        {
-            NS_LOG_LOGIC("Deleting global route " << j << " from node " << node->GetId());
-            gr->RemoveRoute(0);
-        }
-        NS_LOG_LOGIC("Deleted " << j << " global routes from node " << node->GetId());
+        gr->RemoveAllRoutes();
+        gr->ClearCompactRoutes();
     }
+    m_destinations = Create<Ipv4GlobalRoutingDestinations>();
     if (m_lsdb)
     {
         NS_LOG_LOGIC("Deleting LSDB, creating new one");
@@ -685,6 +675,7 @@ GlobalRouteManagerImpl::InitializeRoutes()
     // Walk the list of nodes in the system.
     //
     NS_LOG_INFO("About to start SPF calculation");
+    IndexRouterNodes();
     for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
     {
         Ptr<Node> node = *i;
@@ -710,9 +701,31 @@ GlobalRouteManagerImpl::InitializeRoutes()
             SPFCalculate(rtr->GetRouterId());
         }
     }
+    m_routerNodes.clear();
     NS_LOG_INFO("Finished SPF calculation");
 }
 
+void
+GlobalRouteManagerImpl::IndexRouterNodes()
+{
+    NS_LOG_FUNCTION(this);
+    m_routerNodes.clear();
+    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    {
+        Ptr<Node> node = *i;
+        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
+        //
+        // If the node doesn't have a GlobalRouter interface it can't be the root
+        // of an SPF calculation.  If several nodes have the same router ID, the
+        // first one is used.
+        //
+        if (rtr)
+        {
+            m_routerNodes.emplace(rtr->GetRouterId(), node);
+        }
+    }
+}
+
 //
 // This method is derived from quagga ospf_spf_next ().  See RFC2328 Section
 // 16.1 (2) for further details.
@@ -941,7 +954,7 @@ GlobalRouteManagerImpl::SPFNext(SPFVertex* v, CandidateQueue& candidate)
                     // If we've changed the cost to get to the vertex represented by <w>, we
                     // must reorder the priority queue keyed to that cost.
                     //
-                    candidate.Reorder();
+                    candidate.Update(cw);
                 }
             } // new lower cost path found
         }     // end W is already on the candidate list
@@ -1223,7 +1236,9 @@ void
 GlobalRouteManagerImpl::DebugSPFCalculate(Ipv4Address root)
 {
     NS_LOG_FUNCTION(this << root);
+    IndexRouterNodes();
     SPFCalculate(root);
+    m_routerNodes.clear();
 }
 
 //
@@ -1341,6 +1356,8 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
     // We also mark this vertex as being in the SPF tree.
     //
     m_spfroot = v;
+    auto rootNode = m_routerNodes.find(root);
+    m_spfrootNode = (rootNode != m_routerNodes.end()) ? rootNode->second : nullptr;
     v->SetDistanceFromRoot(0);
     v->GetLSA()->SetStatus(GlobalRoutingLSA::LSA_SPF_IN_SPFTREE);
     NS_LOG_LOGIC("Starting SPFCalculate for node " << root);
@@ -1356,6 +1373,8 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
     {
         NS_LOG_LOGIC("SPFCalculate truncated for stub node " << root);
         delete m_spfroot;
+        m_spfroot = nullptr;
+        m_spfrootNode = nullptr;
         return;
     }
 
@@ -1477,6 +1496,7 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
     //
     delete m_spfroot;
     m_spfroot = nullptr;
+    m_spfrootNode = nullptr;
 }
 
 void
@@ -1533,103 +1553,81 @@ GlobalRouteManagerImpl::SPFAddASExternal(GlobalRoutingLSA* extlsa, SPFVertex* v)
 
     NS_LOG_LOGIC("Vertex ID = " << routerId);
     //
-    // We need to walk the list of nodes looking for the one that has the router
-    // ID corresponding to the root vertex.  This is the one we're going to write
-    // the routing information to.
+    // The node at the root of the SPF tree is the one we are going to write the
+    // routing information to.
     //
-    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    Ptr<Node> node = m_spfrootNode;
+    if (!node)
     {
-        Ptr<Node> node = *i;
-        //
-        // The router ID is accessible through the GlobalRouter interface, so we need
-        // to QI for that interface.  If there's no GlobalRouter interface, the node
-        // in question cannot be the router we want, so we continue.
-        //
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
+        NS_LOG_LOGIC("Can't find root node " << routerId);
+        return;
+    }
+    NS_LOG_LOGIC("Setting routes for node " << node->GetId());
+    //
+    // Routing information is updated using the Ipv4 interface.  We need to QI
+    // for that interface.  If the node is acting as an IP version 4 router, it
+    // should absolutely have an Ipv4 interface.
+    //
+    Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+    NS_ASSERT_MSG(ipv4,
+                  "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                  "QI for <Ipv4> interface failed");
+    //
+    // Get the Global Router Link State Advertisement from the vertex we're
+    // adding the routes to.  The LSA will have a number of attached Global Router
+    // Link Records corresponding to links off of that vertex / node.  We're going
+    // to be interested in the records corresponding to point-to-point links.
+    //
+    NS_ASSERT_MSG(v->GetLSA(),
+                  "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                  "Expected valid LSA in SPFVertex* v");
+    Ipv4Mask tempmask = extlsa->GetNetworkLSANetworkMask();
+    Ipv4Address tempip = extlsa->GetLinkStateId();
+    tempip = tempip.CombineMask(tempmask);
 
-        if (!rtr)
+    //
+    // Here's why we did all of that work.  We're going to add a host route to the
+    // host address found in the m_linkData field of the point-to-point link
+    // record.  In the case of a point-to-point link, this is the local IP address
+    // of the node connected to the link.  Each of these point-to-point links
+    // will correspond to a local interface that has an IP address to which
+    // the node at the root of the SPF tree can send packets.  The vertex <v>
+    // (corresponding to the node that has these links and interfaces) has
+    // an m_nextHop address precalculated for us that is the address to which the
+    // root node should send packets to be forwarded to these IP addresses.
+    // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
+    // which the packets should be send for forwarding.
+    //
+    Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
+    if (!router)
+    {
+        return;
+    }
+    Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
+    NS_ASSERT(gr);
+    // walk through all next-hop-IPs and out-going-interfaces for reaching
+    // the stub network gateway 'v' from the root node
+    for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
+    {
+        SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
+        Ipv4Address nextHop = exit.first;
+        int32_t outIf = exit.second;
+        if (outIf >= 0)
         {
-            NS_LOG_LOGIC("No GlobalRouter interface on node " << node->GetId());
-            continue;
+            gr->AddASExternalRouteTo(tempip, tempmask, nextHop, outIf);
+            NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                   << " add external network route to " << tempip
+                                   << " using next hop " << nextHop << " via interface "
+                                   << outIf);
         }
-        //
-        // If the router ID of the current node is equal to the router ID of the
-        // root of the SPF tree, then this node is the one for which we need to
-        // write the routing tables.
-        //
-        NS_LOG_LOGIC("Considering router " << rtr->GetRouterId());
-
-        if (rtr->GetRouterId() == routerId)
+        else
         {
-            NS_LOG_LOGIC("Setting routes for node " << node->GetId());
-            //
-            // Routing information is updated using the Ipv4 interface.  We need to QI
-            // for that interface.  If the node is acting as an IP version 4 router, it
-            // should absolutely have an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "QI for <Ipv4> interface failed");
-            //
-            // Get the Global Router Link State Advertisement from the vertex we're
-            // adding the routes to.  The LSA will have a number of attached Global Router
-            // Link Records corresponding to links off of that vertex / node.  We're going
-            // to be interested in the records corresponding to point-to-point links.
-            //
-            NS_ASSERT_MSG(v->GetLSA(),
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "Expected valid LSA in SPFVertex* v");
-            Ipv4Mask tempmask = extlsa->GetNetworkLSANetworkMask();
-            Ipv4Address tempip = extlsa->GetLinkStateId();
-            tempip = tempip.CombineMask(tempmask);
-
-            //
-            // Here's why we did all of that work.  We're going to add a host route to the
-            // host address found in the m_linkData field of the point-to-point link
-            // record.  In the case of a point-to-point link, this is the local IP address
-            // of the node connected to the link.  Each of these point-to-point links
-            // will correspond to a local interface that has an IP address to which
-            // the node at the root of the SPF tree can send packets.  The vertex <v>
-            // (corresponding to the node that has these links and interfaces) has
-            // an m_nextHop address precalculated for us that is the address to which the
-            // root node should send packets to be forwarded to these IP addresses.
-            // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
-            // which the packets should be send for forwarding.
-            //
-            Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
-            if (!router)
-            {
-                continue;
-            }
-            Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
-            NS_ASSERT(gr);
-            // walk through all next-hop-IPs and out-going-interfaces for reaching
-            // the stub network gateway 'v' from the root node
-            for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
-            {
-                SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
-                Ipv4Address nextHop = exit.first;
-                int32_t outIf = exit.second;
-                if (outIf >= 0)
-                {
-                    gr->AddASExternalRouteTo(tempip, tempmask, nextHop, outIf);
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " add external network route to " << tempip
-                                           << " using next hop " << nextHop << " via interface "
-                                           << outIf);
-                }
-                else
-                {
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " NOT able to add network route to " << tempip
-                                           << " using next hop " << nextHop
-                                           << " since outgoing interface id is negative");
-                }
-            }
-            return;
-        } // if
-    }     // for
+            NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                   << " NOT able to add network route to " << tempip
+                                   << " using next hop " << nextHop
+                                   << " since outgoing interface id is negative");
+        }
+    }
 }
 
 // Processing logic from RFC 2328, page 166 and quagga ospf_spf_process_stubs ()
@@ -1697,103 +1695,105 @@ GlobalRouteManagerImpl::SPFIntraAddStub(GlobalRoutingLinkRecord* l, SPFVertex* v
 
     NS_LOG_LOGIC("Vertex ID = " << routerId);
     //
-    // We need to walk the list of nodes looking for the one that has the router
-    // ID corresponding to the root vertex.  This is the one we're going to write
-    // the routing information to.
+    // The node at the root of the SPF tree is the one we are going to write the
+    // routing information to.
     //
-    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    Ptr<Node> node = m_spfrootNode;
+    if (!node)
     {
-        Ptr<Node> node = *i;
-        //
-        // The router ID is accessible through the GlobalRouter interface, so we need
-        // to QI for that interface.  If there's no GlobalRouter interface, the node
-        // in question cannot be the router we want, so we continue.
-        //
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
+        NS_LOG_LOGIC("Can't find root node " << routerId);
+        return;
+    }
+    NS_LOG_LOGIC("Setting routes for node " << node->GetId());
+    //
+    // Routing information is updated using the Ipv4 interface.  We need to QI
+    // for that interface.  If the node is acting as an IP version 4 router, it
+    // should absolutely have an Ipv4 interface.
+    //
+    Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+    NS_ASSERT_MSG(ipv4,
+                  "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                  "QI for <Ipv4> interface failed");
+    //
+    // Get the Global Router Link State Advertisement from the vertex we're
+    // adding the routes to.  The LSA will have a number of attached Global Router
+    // Link Records corresponding to links off of that vertex / node.  We're going
+    // to be interested in the records corresponding to point-to-point links.
+    //
+    NS_ASSERT_MSG(v->GetLSA(),
+                  "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                  "Expected valid LSA in SPFVertex* v");
+    Ipv4Mask tempmask(l->GetLinkData().Get());
+    Ipv4Address tempip = l->GetLinkId();
+    tempip = tempip.CombineMask(tempmask);
+    //
+    // Here's why we did all of that work.  We're going to add a host route to the
+    // host address found in the m_linkData field of the point-to-point link
+    // record.  In the case of a point-to-point link, this is the local IP address
+    // of the node connected to the link.  Each of these point-to-point links
+    // will correspond to a local interface that has an IP address to which
+    // the node at the root of the SPF tree can send packets.  The vertex <v>
+    // (corresponding to the node that has these links and interfaces) has
+    // an m_nextHop address precalculated for us that is the address to which the
+    // root node should send packets to be forwarded to these IP addresses.
+    // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
+    // which the packets should be send for forwarding.
+    //
 
-        if (!rtr)
+    Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
+    if (!router)
+    {
+        return;
+    }
+    Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
+    NS_ASSERT(gr);
+    // walk through all next-hop-IPs and out-going-interfaces for reaching
+    // the stub network gateway 'v' from the root node
+    for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
+    {
+        SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
+        Ipv4Address nextHop = exit.first;
+        int32_t outIf = exit.second;
+        if (outIf >= 0)
         {
-            NS_LOG_LOGIC("No GlobalRouter interface on node " << node->GetId());
-            continue;
+            AddIntraAreaRoute(gr, tempip, tempmask, false, nextHop, outIf);
+            NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                   << " add network route to " << tempip
+                                   << " using next hop " << nextHop << " via interface "
+                                   << outIf);
         }
-        //
-        // If the router ID of the current node is equal to the router ID of the
-        // root of the SPF tree, then this node is the one for which we need to
-        // write the routing tables.
-        //
-        NS_LOG_LOGIC("Considering router " << rtr->GetRouterId());
-
-        if (rtr->GetRouterId() == routerId)
+        else
         {
-            NS_LOG_LOGIC("Setting routes for node " << node->GetId());
-            //
-            // Routing information is updated using the Ipv4 interface.  We need to QI
-            // for that interface.  If the node is acting as an IP version 4 router, it
-            // should absolutely have an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "QI for <Ipv4> interface failed");
-            //
-            // Get the Global Router Link State Advertisement from the vertex we're
-            // adding the routes to.  The LSA will have a number of attached Global Router
-            // Link Records corresponding to links off of that vertex / node.  We're going
-            // to be interested in the records corresponding to point-to-point links.
-            //
-            NS_ASSERT_MSG(v->GetLSA(),
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "Expected valid LSA in SPFVertex* v");
-            Ipv4Mask tempmask(l->GetLinkData().Get());
-            Ipv4Address tempip = l->GetLinkId();
-            tempip = tempip.CombineMask(tempmask);
-            //
-            // Here's why we did all of that work.  We're going to add a host route to the
-            // host address found in the m_linkData field of the point-to-point link
-            // record.  In the case of a point-to-point link, this is the local IP address
-            // of the node connected to the link.  Each of these point-to-point links
-            // will correspond to a local interface that has an IP address to which
-            // the node at the root of the SPF tree can send packets.  The vertex <v>
-            // (corresponding to the node that has these links and interfaces) has
-            // an m_nextHop address precalculated for us that is the address to which the
-            // root node should send packets to be forwarded to these IP addresses.
-            // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
-            // which the packets should be send for forwarding.
-            //
+            NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                   << " NOT able to add network route to " << tempip
+                                   << " using next hop " << nextHop
+                                   << " since outgoing interface id is negative");
+        }
+    }
+}
 
-            Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
-            if (!router)
-            {
-                continue;
-            }
-            Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
-            NS_ASSERT(gr);
-            // walk through all next-hop-IPs and out-going-interfaces for reaching
-            // the stub network gateway 'v' from the root node
-            for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
-            {
-                SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
-                Ipv4Address nextHop = exit.first;
-                int32_t outIf = exit.second;
-                if (outIf >= 0)
-                {
-                    gr->AddNetworkRouteTo(tempip, tempmask, nextHop, outIf);
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " add network route to " << tempip
-                                           << " using next hop " << nextHop << " via interface "
-                                           << outIf);
-                }
-                else
-                {
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " NOT able to add network route to " << tempip
-                                           << " using next hop " << nextHop
-                                           << " since outgoing interface id is negative");
-                }
-            }
-            return;
-        } // if
-    }     // for
+void
+GlobalRouteManagerImpl::AddIntraAreaRoute(Ptr<Ipv4GlobalRouting> gr,
+                                          Ipv4Address dest,
+                                          Ipv4Mask mask,
+                                          bool host,
+                                          Ipv4Address nextHop,
+                                          uint32_t outIf)
+{
+    NS_LOG_FUNCTION(this << gr << dest << mask << host << nextHop << outIf);
+    if (gr->UsesCompactRoutes())
+    {
+        auto destination = m_destinations->Add(dest, mask, host);
+        gr->AddCompactRouteTo(m_destinations, destination, nextHop, outIf);
+    }
+    else if (host)
+    {
+        gr->AddHostRouteTo(dest, nextHop, outIf);
+    }
+    else
+    {
+        gr->AddNetworkRouteTo(dest, mask, nextHop, outIf);
+    }
 }
 
 //
@@ -1817,58 +1817,40 @@ GlobalRouteManagerImpl::FindOutgoingInterfaceId(Ipv4Address a, Ipv4Mask amask)
     //
     Ipv4Address routerId = m_spfroot->GetVertexId();
     //
-    // Walk the list of nodes in the system looking for the one corresponding to
-    // the node at the root of the SPF tree.  This is the node for which we are
-    // building the routing table.
+    // The node at the root of the SPF tree has been found when starting the SPF
+    // calculation.
     //
-    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    Ptr<Node> node = m_spfrootNode;
+    if (!node)
     {
-        Ptr<Node> node = *i;
-
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
-        //
-        // If the node doesn't have a GlobalRouter interface it can't be the one
-        // we're interested in.
-        //
-        if (!rtr)
-        {
-            continue;
-        }
-
-        if (rtr->GetRouterId() == routerId)
-        {
-            //
-            // This is the node we're building the routing table for.  We're going to need
-            // the Ipv4 interface to look for the ipv4 interface index.  Since this node
-            // is participating in routing IP version 4 packets, it certainly must have
-            // an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::FindOutgoingInterfaceId (): "
-                          "GetObject for <Ipv4> interface failed");
-            //
-            // Look through the interfaces on this node for one that has the IP address
-            // we're looking for.  If we find one, return the corresponding interface
-            // index, or -1 if not found.
-            //
-            int32_t interface = ipv4->GetInterfaceForPrefix(a, amask);
-
-#if 0
-          if (interface < 0)
-            {
-              NS_FATAL_ERROR ("GlobalRouteManagerImpl::FindOutgoingInterfaceId(): "
-                              "Expected an interface associated with address a:" << a);
-            }
-#endif
-            return interface;
-        }
+        NS_LOG_LOGIC("FindOutgoingInterfaceId():Can't find root node " << routerId);
+        return -1;
     }
     //
-    // Couldn't find it.
+    // This is the node we're building the routing table for.  We're going to need
+    // the Ipv4 interface to look for the ipv4 interface index.  Since this node
+    // is participating in routing IP version 4 packets, it certainly must have
+    // an Ipv4 interface.
+    //
+    Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+    NS_ASSERT_MSG(ipv4,
+                  "GlobalRouteManagerImpl::FindOutgoingInterfaceId (): "
+                  "GetObject for <Ipv4> interface failed");
     //
-    NS_LOG_LOGIC("FindOutgoingInterfaceId():Can't find root node " << routerId);
-    return -1;
+    // Look through the interfaces on this node for one that has the IP address
+    // we're looking for.  If we find one, return the corresponding interface
+    // index, or -1 if not found.
+    //
+    int32_t interface = ipv4->GetInterfaceForPrefix(a, amask);
+
+#if 0
+  if (interface < 0)
+    {
+      NS_FATAL_ERROR ("GlobalRouteManagerImpl::FindOutgoingInterfaceId(): "
+                      "Expected an interface associated with address a:" << a);
+    }
+#endif
+    return interface;
 }
 
 //
@@ -1904,128 +1886,103 @@ GlobalRouteManagerImpl::SPFIntraAddRouter(SPFVertex* v)
 
     NS_LOG_LOGIC("Vertex ID = " << routerId);
     //
-    // We need to walk the list of nodes looking for the one that has the router
-    // ID corresponding to the root vertex.  This is the one we're going to write
-    // the routing information to.
+    // The node at the root of the SPF tree is the one we are going to write the
+    // routing information to.
     //
-    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    Ptr<Node> node = m_spfrootNode;
+    if (!node)
+    {
+        NS_LOG_LOGIC("Can't find root node " << routerId);
+        return;
+    }
+    NS_LOG_LOGIC("Setting routes for node " << node->GetId());
+    //
+    // Routing information is updated using the Ipv4 interface.  We need to
+    // GetObject for that interface.  If the node is acting as an IP version 4
+    // router, it should absolutely have an Ipv4 interface.
+    //
+    Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+    NS_ASSERT_MSG(ipv4,
+                  "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                  "GetObject for <Ipv4> interface failed");
+    //
+    // Get the Global Router Link State Advertisement from the vertex we're
+    // adding the routes to.  The LSA will have a number of attached Global Router
+    // Link Records corresponding to links off of that vertex / node.  We're going
+    // to be interested in the records corresponding to point-to-point links.
+    //
+    GlobalRoutingLSA* lsa = v->GetLSA();
+    NS_ASSERT_MSG(lsa,
+                  "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                  "Expected valid LSA in SPFVertex* v");
+
+    uint32_t nLinkRecords = lsa->GetNLinkRecords();
+    //
+    // Iterate through the link records on the vertex to which we're going to add
+    // routes.  To make sure we're being clear, we're going to add routing table
+    // entries to the tables on the node corresponding to the root of the SPF tree.
+    // These entries will have routes to the IP addresses we find from looking at
+    // the local side of the point-to-point links found on the node described by
+    // the vertex <v>.
+    //
+    NS_LOG_LOGIC(" Node " << node->GetId() << " found " << nLinkRecords
+                          << " link records in LSA " << lsa << "with LinkStateId "
+                          << lsa->GetLinkStateId());
+    for (uint32_t j = 0; j < nLinkRecords; ++j)
     {
-        Ptr<Node> node = *i;
         //
-        // The router ID is accessible through the GlobalRouter interface, so we need
-        // to GetObject for that interface.  If there's no GlobalRouter interface,
-        // the node in question cannot be the router we want, so we continue.
+        // We are only concerned about point-to-point links
         //
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
-
-        if (!rtr)
+        GlobalRoutingLinkRecord* lr = lsa->GetLinkRecord(j);
+        if (lr->GetLinkType() != GlobalRoutingLinkRecord::PointToPoint)
         {
-            NS_LOG_LOGIC("No GlobalRouter interface on node " << node->GetId());
             continue;
         }
         //
-        // If the router ID of the current node is equal to the router ID of the
-        // root of the SPF tree, then this node is the one for which we need to
-        // write the routing tables.
+        // Here's why we did all of that work.  We're going to add a host route to the
+        // host address found in the m_linkData field of the point-to-point link
+        // record.  In the case of a point-to-point link, this is the local IP address
+        // of the node connected to the link.  Each of these point-to-point links
+        // will correspond to a local interface that has an IP address to which
+        // the node at the root of the SPF tree can send packets.  The vertex <v>
+        // (corresponding to the node that has these links and interfaces) has
+        // an m_nextHop address precalculated for us that is the address to which the
+        // root node should send packets to be forwarded to these IP addresses.
+        // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
+        // which the packets should be send for forwarding.
         //
-        NS_LOG_LOGIC("Considering router " << rtr->GetRouterId());
-
-        if (rtr->GetRouterId() == routerId)
+        Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
+        if (!router)
         {
-            NS_LOG_LOGIC("Setting routes for node " << node->GetId());
-            //
-            // Routing information is updated using the Ipv4 interface.  We need to
-            // GetObject for that interface.  If the node is acting as an IP version 4
-            // router, it should absolutely have an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "GetObject for <Ipv4> interface failed");
-            //
-            // Get the Global Router Link State Advertisement from the vertex we're
-            // adding the routes to.  The LSA will have a number of attached Global Router
-            // Link Records corresponding to links off of that vertex / node.  We're going
-            // to be interested in the records corresponding to point-to-point links.
-            //
-            GlobalRoutingLSA* lsa = v->GetLSA();
-            NS_ASSERT_MSG(lsa,
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "Expected valid LSA in SPFVertex* v");
-
-            uint32_t nLinkRecords = lsa->GetNLinkRecords();
-            //
-            // Iterate through the link records on the vertex to which we're going to add
-            // routes.  To make sure we're being clear, we're going to add routing table
-            // entries to the tables on the node corresponding to the root of the SPF tree.
-            // These entries will have routes to the IP addresses we find from looking at
-            // the local side of the point-to-point links found on the node described by
-            // the vertex <v>.
-            //
-            NS_LOG_LOGIC(" Node " << node->GetId() << " found " << nLinkRecords
-                                  << " link records in LSA " << lsa << "with LinkStateId "
-                                  << lsa->GetLinkStateId());
-            for (uint32_t j = 0; j < nLinkRecords; ++j)
+            continue;
+        }
+        Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
+        NS_ASSERT(gr);
+        // walk through all available exit directions due to ECMP,
+        // and add host route for each of the exit direction toward
+        // the vertex 'v'
+        for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
+        {
+            SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
+            Ipv4Address nextHop = exit.first;
+            int32_t outIf = exit.second;
+            if (outIf >= 0)
             {
-                //
-                // We are only concerned about point-to-point links
-                //
-                GlobalRoutingLinkRecord* lr = lsa->GetLinkRecord(j);
-                if (lr->GetLinkType() != GlobalRoutingLinkRecord::PointToPoint)
-                {
-                    continue;
-                }
-                //
-                // Here's why we did all of that work.  We're going to add a host route to the
-                // host address found in the m_linkData field of the point-to-point link
-                // record.  In the case of a point-to-point link, this is the local IP address
-                // of the node connected to the link.  Each of these point-to-point links
-                // will correspond to a local interface that has an IP address to which
-                // the node at the root of the SPF tree can send packets.  The vertex <v>
-                // (corresponding to the node that has these links and interfaces) has
-                // an m_nextHop address precalculated for us that is the address to which the
-                // root node should send packets to be forwarded to these IP addresses.
-                // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
-                // which the packets should be send for forwarding.
-                //
-                Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
-                if (!router)
-                {
-                    continue;
-                }
-                Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
-                NS_ASSERT(gr);
-                // walk through all available exit directions due to ECMP,
-                // and add host route for each of the exit direction toward
-                // the vertex 'v'
-                for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
-                {
-                    SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
-                    Ipv4Address nextHop = exit.first;
-                    int32_t outIf = exit.second;
-                    if (outIf >= 0)
-                    {
-                        gr->AddHostRouteTo(lr->GetLinkData(), nextHop, outIf);
-                        NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                               << " adding host route to " << lr->GetLinkData()
-                                               << " using next hop " << nextHop
-                                               << " and outgoing interface " << outIf);
-                    }
-                    else
-                    {
-                        NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                               << " NOT able to add host route to "
-                                               << lr->GetLinkData() << " using next hop " << nextHop
-                                               << " since outgoing interface id is negative "
-                                               << outIf);
-                    }
-                } // for all routes from the root the vertex 'v'
+                AddIntraAreaRoute(gr, lr->GetLinkData(), Ipv4Mask(), true, nextHop, outIf);
+                NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                       << " adding host route to " << lr->GetLinkData()
+                                       << " using next hop " << nextHop
+                                       << " and outgoing interface " << outIf);
             }
-            //
-            // Done adding the routes for the selected node.
-            //
-            return;
-        }
+            else
+            {
+                NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                       << " NOT able to add host route to "
+                                       << lr->GetLinkData() << " using next hop " << nextHop
+                                       << " since outgoing interface id is negative "
+                                       << outIf);
+            }
+        } // for all routes from the root the vertex 'v'
     }
 }
 
@@ -2046,89 +2003,68 @@ GlobalRouteManagerImpl::SPFIntraAddTransit(SPFVertex* v)
 
     NS_LOG_LOGIC("Vertex ID = " << routerId);
     //
-    // We need to walk the list of nodes looking for the one that has the router
-    // ID corresponding to the root vertex.  This is the one we're going to write
-    // the routing information to.
+    // The node at the root of the SPF tree is the one we are going to write the
+    // routing information to.
     //
-    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    Ptr<Node> node = m_spfrootNode;
+    if (!node)
     {
-        Ptr<Node> node = *i;
-        //
-        // The router ID is accessible through the GlobalRouter interface, so we need
-        // to GetObject for that interface.  If there's no GlobalRouter interface,
-        // the node in question cannot be the router we want, so we continue.
-        //
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
+        NS_LOG_LOGIC("Can't find root node " << routerId);
+        return;
+    }
+    NS_LOG_LOGIC("setting routes for node " << node->GetId());
+    //
+    // Routing information is updated using the Ipv4 interface.  We need to
+    // GetObject for that interface.  If the node is acting as an IP version 4
+    // router, it should absolutely have an Ipv4 interface.
+    //
+    Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+    NS_ASSERT_MSG(ipv4,
+                  "GlobalRouteManagerImpl::SPFIntraAddTransit (): "
+                  "GetObject for <Ipv4> interface failed");
+    //
+    // Get the Global Router Link State Advertisement from the vertex we're
+    // adding the routes to.  The LSA will have a number of attached Global Router
+    // Link Records corresponding to links off of that vertex / node.  We're going
+    // to be interested in the records corresponding to point-to-point links.
+    //
+    GlobalRoutingLSA* lsa = v->GetLSA();
+    NS_ASSERT_MSG(lsa,
+                  "GlobalRouteManagerImpl::SPFIntraAddTransit (): "
+                  "Expected valid LSA in SPFVertex* v");
+    Ipv4Mask tempmask = lsa->GetNetworkLSANetworkMask();
+    Ipv4Address tempip = lsa->GetLinkStateId();
+    tempip = tempip.CombineMask(tempmask);
+    Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
+    if (!router)
+    {
+        return;
+    }
+    Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
+    NS_ASSERT(gr);
+    // walk through all available exit directions due to ECMP,
+    // and add host route for each of the exit direction toward
+    // the vertex 'v'
+    for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
+    {
+        SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
+        Ipv4Address nextHop = exit.first;
+        int32_t outIf = exit.second;
 
-        if (!rtr)
+        if (outIf >= 0)
         {
-            NS_LOG_LOGIC("No GlobalRouter interface on node " << node->GetId());
-            continue;
+            AddIntraAreaRoute(gr, tempip, tempmask, false, nextHop, outIf);
+            NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                   << " add network route to " << tempip
+                                   << " using next hop " << nextHop << " via interface "
+                                   << outIf);
         }
-        //
-        // If the router ID of the current node is equal to the router ID of the
-        // root of the SPF tree, then this node is the one for which we need to
-        // write the routing tables.
-        //
-        NS_LOG_LOGIC("Considering router " << rtr->GetRouterId());
-
-        if (rtr->GetRouterId() == routerId)
+        else
         {
-            NS_LOG_LOGIC("setting routes for node " << node->GetId());
-            //
-            // Routing information is updated using the Ipv4 interface.  We need to
-            // GetObject for that interface.  If the node is acting as an IP version 4
-            // router, it should absolutely have an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::SPFIntraAddTransit (): "
-                          "GetObject for <Ipv4> interface failed");
-            //
-            // Get the Global Router Link State Advertisement from the vertex we're
-            // adding the routes to.  The LSA will have a number of attached Global Router
-            // Link Records corresponding to links off of that vertex / node.  We're going
-            // to be interested in the records corresponding to point-to-point links.
-            //
-            GlobalRoutingLSA* lsa = v->GetLSA();
-            NS_ASSERT_MSG(lsa,
-                          "GlobalRouteManagerImpl::SPFIntraAddTransit (): "
-                          "Expected valid LSA in SPFVertex* v");
-            Ipv4Mask tempmask = lsa->GetNetworkLSANetworkMask();
-            Ipv4Address tempip = lsa->GetLinkStateId();
-            tempip = tempip.CombineMask(tempmask);
-            Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
-            if (!router)
-            {
-                continue;
-            }
-            Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
-            NS_ASSERT(gr);
-            // walk through all available exit directions due to ECMP,
-            // and add host route for each of the exit direction toward
-            // the vertex 'v'
-            for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
-            {
-                SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
-                Ipv4Address nextHop = exit.first;
-                int32_t outIf = exit.second;
-
-                if (outIf >= 0)
-                {
-                    gr->AddNetworkRouteTo(tempip, tempmask, nextHop, outIf);
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " add network route to " << tempip
-                                           << " using next hop " << nextHop << " via interface "
-                                           << outIf);
-                }
-                else
-                {
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " NOT able to add network route to " << tempip
-                                           << " using next hop " << nextHop
-                                           << " since outgoing interface id is negative " << outIf);
-                }
-            }
+            NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                   << " NOT able to add network route to " << tempip
+                                   << " using next hop " << nextHop
+                                   << " since outgoing interface id is negative " << outIf);
         }
     }
 }
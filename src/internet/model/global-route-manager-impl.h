@@ -20,6 +20,7 @@
 #include <map>
 #include <queue>
 #include <stdint.h>
+#include <unordered_map>
 #include <vector>
 
 namespace ns3
@@ -29,6 +30,7 @@ const uint32_t SPF_INFINITY = 0xffffffff; //!< "infinite" distance between nodes
 
 class CandidateQueue;
 class Ipv4GlobalRouting;
+class Ipv4GlobalRoutingDestinations;
 
 /**
  * \ingroup globalrouting
@@ -668,6 +670,9 @@ class GlobalRouteManagerLSDB
         LSDBPair_t; //!< pair of IPv4 addresses / Link State Advertisements
 
     LSDBMap_t m_database; //!< database of IPv4 addresses / Link State Advertisements
+    /// the first LSA (in database order) having a TransitNetwork link record with the
+    /// given link data, by link data; the key of the LSA in the database is also stored
+    std::unordered_map<Ipv4Address, LSDBPair_t, Ipv4AddressHash> m_linkDataIndex;
     std::vector<GlobalRoutingLSA*>
         m_extdatabase; //!< database of External Link State Advertisements
 };
@@ -728,7 +733,37 @@ class GlobalRouteManagerImpl
 
   private:
     SPFVertex* m_spfroot;           //!< the root node
+    Ptr<Node> m_spfrootNode;        //!< the node at the root of the SPF tree (if found)
     GlobalRouteManagerLSDB* m_lsdb; //!< the Link State DataBase (LSDB) of the Global Route Manager
+    /// the destinations of the compact routes of all the nodes
+    Ptr<Ipv4GlobalRoutingDestinations> m_destinations;
+
+    /// the nodes having a GlobalRouter interface, by router ID (only during route computation)
+    std::unordered_map<Ipv4Address, Ptr<Node>, Ipv4AddressHash> m_routerNodes;
+
+    /**
+     * \brief Fill the map of the nodes having a GlobalRouter interface, so that the
+     * node at the root of each SPF calculation is found without walking the list of nodes.
+     */
+    void IndexRouterNodes();
+
+    /**
+     * \brief Add an intra-area route to the forwarding table of the root of the SPF tree,
+     * as a compact route if the routing protocol of the root stores them so.
+     *
+     * \param gr the global routing protocol of the root node
+     * \param dest the host address or the network address
+     * \param mask the network mask (ignored for a host)
+     * \param host true for a host route, false for a network route
+     * \param nextHop the next hop
+     * \param outIf the output interface
+     */
+    void AddIntraAreaRoute(Ptr<Ipv4GlobalRouting> gr,
+                           Ipv4Address dest,
+                           Ipv4Mask mask,
+                           bool host,
+                           Ipv4Address nextHop,
+                           uint32_t outIf);
 
     /**
      * \brief Test if a node is a stub, from an OSPF sense.
@@ -0,0 +1,474 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef IP_PREFIX_TRIE_H
+#define IP_PREFIX_TRIE_H
+
+#include "ns3/assert.h"
+#include "ns3/ipv4-address.h"
+#include "ns3/ipv6-address.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup internet
+ *
+ * \brief Path-compressed binary trie indexing values by IP prefix, for longest prefix match.
+ *
+ * A prefix is made of the N bytes of an address, in network order, and of a length in
+ * bits (the bits of the address beyond the length are ignored). Every node of the trie
+ * stores a prefix and the values inserted for that prefix, in insertion order. Nodes only
+ * exist for the inserted prefixes and for the branching points between them, hence the
+ * trie has less than two nodes per prefix and looking up an address visits at most one
+ * node per prefix matching the address, i.e., the cost of a lookup depends on the length
+ * of the addresses and not on the number of prefixes.
+ *
+ * Values can be inserted and removed incrementally; removing the last value of a prefix
+ * removes the nodes that are not needed anymore.
+ *
+ * \tparam N the number of bytes of the addresses (4 for IPv4, 16 for IPv6)
+ * \tparam T the type of the values
+ */
+template <std::size_t N, typename T>
+class IpPrefixTrie
+{
+  public:
+    /// The bytes of an address, in network order
+    using Key = std::array<uint8_t, N>;
+
+    IpPrefixTrie();
+
+    /**
+     * Insert a value for the given prefix. The value is added after the values already
+     * inserted for the same prefix.
+     *
+     * \param prefix the address of the prefix
+     * \param length the length of the prefix in bits
+     * \param value the value
+     */
+    void Insert(const Key& prefix, uint8_t length, const T& value);
+
+    /**
+     * Remove the first value of the given prefix that satisfies the given predicate.
+     *
+     * \tparam F the type of the predicate
+     * \param prefix the address of the prefix
+     * \param length the length of the prefix in bits
+     * \param pred the predicate, taking a const reference to a value
+     * \return true if a value has been removed
+     */
+    template <typename F>
+    bool Remove(const Key& prefix, uint8_t length, F&& pred);
+
+    /**
+     * \param prefix the address of the prefix
+     * \param length the length of the prefix in bits
+     * \return a pointer to the values inserted for the given prefix, or a null pointer if
+     *         there is none
+     */
+    const std::vector<T>* Find(const Key& prefix, uint8_t length) const;
+
+    /**
+     * Call the given function for every prefix matching the given address that has values,
+     * from the shortest to the longest prefix.
+     *
+     * \tparam F the type of the function
+     * \param address the address
+     * \param f the function, taking the length of the prefix and a const reference to
+     *          the vector of its values
+     */
+    template <typename F>
+    void ForEachMatch(const Key& address, F&& f) const;
+
+    /**
+     * \param address the address
+     * \return a pointer to the values of the longest prefix matching the given address,
+     *         or a null pointer if no prefix matches
+     */
+    const std::vector<T>* LongestMatch(const Key& address) const;
+
+    /// Remove all the values
+    void Clear();
+
+    /// \return the number of nodes of the trie, including the root
+    std::size_t GetNNodes() const;
+
+    /// \return an estimate of the heap memory used by the trie, in bytes
+    std::size_t GetMemoryUsage() const;
+
+  private:
+    /// Maximum prefix length
+    static constexpr uint8_t MAX_LENGTH = 8 * N;
+    /// Index of a missing node
+    static constexpr uint32_t NO_NODE = std::numeric_limits<uint32_t>::max();
+
+    /// A node of the trie
+    struct Node
+    {
+        Key prefix;     //!< the prefix (masked)
+        uint8_t length; //!< the length of the prefix
+        std::array<uint32_t, 2> children{NO_NODE, NO_NODE}; //!< the children, by next bit
+        std::vector<T> values;                              //!< the values of the prefix
+    };
+
+    /**
+     * \param key the key
+     * \param pos the position of the bit (zero is the most significant bit)
+     * \return the bit at the given position of the given key
+     */
+    static uint8_t GetBit(const Key& key, uint8_t pos);
+
+    /**
+     * \param key the key
+     * \param length the number of bits to keep
+     * \return the given key with the bits beyond the given length cleared
+     */
+    static Key Mask(const Key& key, uint8_t length);
+
+    /**
+     * \param a the first key
+     * \param b the second key
+     * \param maxLength the maximum number of bits to compare
+     * \return the number of leading bits (up to maxLength) that are equal in the given keys
+     */
+    static uint8_t CommonLength(const Key& a, const Key& b, uint8_t maxLength);
+
+    /**
+     * Allocate a node, reusing a free slot if any.
+     *
+     * \param prefix the (masked) prefix of the node
+     * \param length the length of the prefix
+     * \return the index of the node
+     */
+    uint32_t NewNode(const Key& prefix, uint8_t length);
+
+    /**
+     * \param prefix the (masked) prefix
+     * \param length the length of the prefix
+     * \param path if not null, filled with the indices of the nodes from the root to the
+     *             returned node (excluded)
+     * \return the index of the node storing the given prefix, or NO_NODE
+     */
+    uint32_t FindNode(const Key& prefix, uint8_t length, std::vector<uint32_t>* path) const;
+
+    std::vector<Node> m_nodes;         //!< the nodes; the root (length zero) has index 0
+    std::vector<uint32_t> m_freeNodes; //!< the indices of the unused nodes
+};
+
+/**
+ * \ingroup internet
+ * \param address an IPv4 address
+ * \return the key of the given address in an IpPrefixTrie
+ */
+inline std::array<uint8_t, 4>
+GetIpPrefixTrieKey(Ipv4Address address)
+{
+    std::array<uint8_t, 4> key;
+    address.Serialize(key.data());
+    return key;
+}
+
+/**
+ * \ingroup internet
+ * \param address an IPv6 address
+ * \return the key of the given address in an IpPrefixTrie
+ */
+inline std::array<uint8_t, 16>
+GetIpPrefixTrieKey(Ipv6Address address)
+{
+    std::array<uint8_t, 16> key;
+    address.GetBytes(key.data());
+    return key;
+}
+
+/***************************************************************
+ *  Implementation of the templates declared above.
+ ***************************************************************/
+
+template <std::size_t N, typename T>
+IpPrefixTrie<N, T>::IpPrefixTrie()
+{
+    Clear();
+}
+
+template <std::size_t N, typename T>
+uint8_t
+IpPrefixTrie<N, T>::GetBit(const Key& key, uint8_t pos)
+{
+    return (key[pos / 8] >> (7 - pos % 8)) & 1;
+}
+
+template <std::size_t N, typename T>
+typename IpPrefixTrie<N, T>::Key
+IpPrefixTrie<N, T>::Mask(const Key& key, uint8_t length)
+{
+    Key masked{};
+    for (uint8_t i = 0; i < length / 8; ++i)
+    {
+        masked[i] = key[i];
+    }
+    if (length % 8 != 0)
+    {
+        masked[length / 8] = key[length / 8] & static_cast<uint8_t>(0xff << (8 - length % 8));
+    }
+    return masked;
+}
+
+template <std::size_t N, typename T>
+uint8_t
+IpPrefixTrie<N, T>::CommonLength(const Key& a, const Key& b, uint8_t maxLength)
+{
+    for (uint8_t i = 0; i * 8 < maxLength; ++i)
+    {
+        if (uint8_t diff = a[i] ^ b[i]; diff != 0)
+        {
+            return std::min<uint8_t>(maxLength, i * 8 + std::countl_zero(diff));
+        }
+    }
+    return maxLength;
+}
+
+template <std::size_t N, typename T>
+uint32_t
+IpPrefixTrie<N, T>::NewNode(const Key& prefix, uint8_t length)
+{
+    uint32_t index;
+    if (!m_freeNodes.empty())
+    {
+        index = m_freeNodes.back();
+        m_freeNodes.pop_back();
+    }
+    else
+    {
+        index = m_nodes.size();
+        m_nodes.emplace_back();
+    }
+    auto& node = m_nodes[index];
+    node.prefix = prefix;
+    node.length = length;
+    node.children = {NO_NODE, NO_NODE};
+    return index;
+}
+
+template <std::size_t N, typename T>
+void
+IpPrefixTrie<N, T>::Insert(const Key& prefix, uint8_t length, const T& value)
+{
+    NS_ASSERT(length <= MAX_LENGTH);
+    const auto key = Mask(prefix, length);
+    uint32_t current = 0;
+
+    while (m_nodes[current].length < length)
+    {
+        // the prefix of the current node is a prefix of the key
+        const auto bit = GetBit(key, m_nodes[current].length);
+        const auto child = m_nodes[current].children[bit];
+
+        if (child == NO_NODE)
+        {
+            const auto leaf = NewNode(key, length);
+            m_nodes[leaf].values.push_back(value);
+            m_nodes[current].children[bit] = leaf;
+            return;
+        }
+
+        const auto childLength = m_nodes[child].length;
+        const auto common =
+            CommonLength(m_nodes[child].prefix, key, std::min(childLength, length));
+
+        if (common == childLength)
+        {
+            current = child;
+            continue;
+        }
+
+        if (common == length)
+        {
+            // the key is a prefix of the prefix of the child
+            const auto node = NewNode(key, length);
+            m_nodes[node].values.push_back(value);
+            m_nodes[node].children[GetBit(m_nodes[child].prefix, length)] = child;
+            m_nodes[current].children[bit] = node;
+            return;
+        }
+
+        // the key and the prefix of the child diverge: add a branching node
+        const auto branch = NewNode(Mask(key, common), common);
+        const auto leaf = NewNode(key, length);
+        m_nodes[leaf].values.push_back(value);
+        m_nodes[branch].children[GetBit(m_nodes[child].prefix, common)] = child;
+        m_nodes[branch].children[GetBit(key, common)] = leaf;
+        m_nodes[current].children[bit] = branch;
+        return;
+    }
+
+    NS_ASSERT(m_nodes[current].length == length);
+    m_nodes[current].values.push_back(value);
+}
+
+template <std::size_t N, typename T>
+uint32_t
+IpPrefixTrie<N, T>::FindNode(const Key& prefix, uint8_t length, std::vector<uint32_t>* path) const
+{
+    uint32_t current = 0;
+
+    while (current != NO_NODE)
+    {
+        const auto& node = m_nodes[current];
+        if (node.length > length || CommonLength(node.prefix, prefix, node.length) < node.length)
+        {
+            return NO_NODE;
+        }
+        if (node.length == length)
+        {
+            return current;
+        }
+        if (path)
+        {
+            path->push_back(current);
+        }
+        current = node.children[GetBit(prefix, node.length)];
+    }
+    return NO_NODE;
+}
+
+template <std::size_t N, typename T>
+template <typename F>
+bool
+IpPrefixTrie<N, T>::Remove(const Key& prefix, uint8_t length, F&& pred)
+{
+    NS_ASSERT(length <= MAX_LENGTH);
+    std::vector<uint32_t> path;
+    const auto index = FindNode(Mask(prefix, length), length, &path);
+
+    if (index == NO_NODE)
+    {
+        return false;
+    }
+
+    auto& values = m_nodes[index].values;
+    auto it = std::find_if(values.begin(), values.end(), pred);
+    if (it == values.end())
+    {
+        return false;
+    }
+    values.erase(it);
+
+    // remove the nodes that are neither storing values nor branching, bottom up
+    auto current = index;
+    while (current != 0 && m_nodes[current].values.empty())
+    {
+        auto& node = m_nodes[current];
+        const auto nChildren = (node.children[0] != NO_NODE) + (node.children[1] != NO_NODE);
+        if (nChildren == 2)
+        {
+            break;
+        }
+        NS_ASSERT(!path.empty());
+        const auto parent = path.back();
+        path.pop_back();
+        auto& slot = m_nodes[parent].children[GetBit(node.prefix, m_nodes[parent].length)];
+        NS_ASSERT(slot == current);
+        slot = (nChildren == 0) ? NO_NODE
+                                : node.children[node.children[0] != NO_NODE ? 0 : 1];
+        node.values.clear();
+        m_freeNodes.push_back(current);
+        if (nChildren == 1)
+        {
+            // the parent keeps the same number of children
+            break;
+        }
+        current = parent;
+    }
+    return true;
+}
+
+template <std::size_t N, typename T>
+const std::vector<T>*
+IpPrefixTrie<N, T>::Find(const Key& prefix, uint8_t length) const
+{
+    NS_ASSERT(length <= MAX_LENGTH);
+    const auto index = FindNode(Mask(prefix, length), length, nullptr);
+    if (index == NO_NODE || m_nodes[index].values.empty())
+    {
+        return nullptr;
+    }
+    return &m_nodes[index].values;
+}
+
+template <std::size_t N, typename T>
+template <typename F>
+void
+IpPrefixTrie<N, T>::ForEachMatch(const Key& address, F&& f) const
+{
+    uint32_t current = 0;
+
+    while (current != NO_NODE)
+    {
+        const auto& node = m_nodes[current];
+        if (CommonLength(node.prefix, address, node.length) < node.length)
+        {
+            return;
+        }
+        if (!node.values.empty())
+        {
+            f(node.length, node.values);
+        }
+        if (node.length == MAX_LENGTH)
+        {
+            return;
+        }
+        current = node.children[GetBit(address, node.length)];
+    }
+}
+
+template <std::size_t N, typename T>
+const std::vector<T>*
+IpPrefixTrie<N, T>::LongestMatch(const Key& address) const
+{
+    const std::vector<T>* values = nullptr;
+    ForEachMatch(address, [&values](uint8_t, const std::vector<T>& v) { values = &v; });
+    return values;
+}
+
+template <std::size_t N, typename T>
+void
+IpPrefixTrie<N, T>::Clear()
+{
+    m_nodes.clear();
+    m_freeNodes.clear();
+    NewNode(Key{}, 0);
+}
+
+template <std::size_t N, typename T>
+std::size_t
+IpPrefixTrie<N, T>::GetNNodes() const
+{
+    return m_nodes.size() - m_freeNodes.size();
+}
+
+template <std::size_t N, typename T>
+std::size_t
+IpPrefixTrie<N, T>::GetMemoryUsage() const
+{
+    std::size_t bytes = m_nodes.capacity() * sizeof(Node);
+    bytes += m_freeNodes.capacity() * sizeof(uint32_t);
+    for (const auto& node : m_nodes)
+    {
+        bytes += node.values.capacity() * sizeof(T);
+    }
+    return bytes;
+}
+
+} // namespace ns3
+
+#endif /* IP_PREFIX_TRIE_H */
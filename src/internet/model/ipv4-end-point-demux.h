@@ -15,6 +15,8 @@
 
 #include <list>
 #include <stdint.h>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -160,6 +162,70 @@ class Ipv4EndPointDemux
     void DeAllocate(Ipv4EndPoint* endPoint);
 
   private:
+    /// Allow the end points to notify changes of their peer
+    friend class Ipv4EndPoint;
+
+    /**
+     * \brief Key of the index of the end points by local port and peer.
+     */
+    struct PeerKey
+    {
+        Ipv4Address peerAddress; //!< the peer address
+        uint16_t localPort;      //!< the local port
+        uint16_t peerPort;       //!< the peer port
+
+        /**
+         * \param other the key to compare with
+         * \return true if the keys are equal
+         */
+        bool operator==(const PeerKey& other) const = default;
+    };
+
+    /**
+     * \brief Hash function for PeerKey.
+     */
+    struct PeerKeyHash
+    {
+        /**
+         * \param key the key
+         * \return the hash of the key
+         */
+        std::size_t operator()(const PeerKey& key) const;
+    };
+
+    /**
+     * \brief Add a new end point to the list of end points and to the indices.
+     * \param endPoint the end point
+     */
+    void AddEndPoint(Ipv4EndPoint* endPoint);
+
+    /**
+     * \brief Add an end point to the indices, according to its current ports and peer.
+     * \param endPoint the end point
+     */
+    void AddToIndex(Ipv4EndPoint* endPoint);
+
+    /**
+     * \brief Remove an end point from the indices, according to its current ports and peer.
+     * \param endPoint the end point
+     */
+    void RemoveFromIndex(Ipv4EndPoint* endPoint);
+
+    /**
+     * \brief Get the end points that have the given local port and peer.
+     *
+     * End points accepting packets from any peer (i.e., whose peer address and port are
+     * wildcards) are indexed by local port only.
+     *
+     * \param localPort the local port
+     * \param peerAddress the peer address
+     * \param peerPort the peer port
+     * \return the end points (could be null if there are none)
+     */
+    const std::vector<Ipv4EndPoint*>* GetIndexedEndPoints(uint16_t localPort,
+                                                          Ipv4Address peerAddress,
+                                                          uint16_t peerPort) const;
+
     /**
      * \brief Allocate an ephemeral port.
      * \returns the ephemeral port
@@ -185,6 +251,26 @@ class Ipv4EndPointDemux
      * \brief A list of IPv4 end points.
      */
     EndPoints m_endPoints;
+
+    /**
+     * \brief The position of every end point in the list of end points.
+     */
+    std::unordered_map<Ipv4EndPoint*, EndPointsI> m_endPointPositions;
+
+    /**
+     * \brief The number of end points using every local port.
+     */
+    std::unordered_map<uint16_t, uint32_t> m_nEndPointsPerPort;
+
+    /**
+     * \brief The end points accepting packets from any peer, by local port.
+     */
+    std::unordered_map<uint16_t, std::vector<Ipv4EndPoint*>> m_listeners;
+
+    /**
+     * \brief The other end points, by local port and peer.
+     */
+    std::unordered_map<PeerKey, std::vector<Ipv4EndPoint*>, PeerKeyHash> m_connected;
 };
 
 } // namespace ns3
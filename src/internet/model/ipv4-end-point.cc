@@ -8,6 +8,8 @@
 
 #include "ipv4-end-point.h"
 
+#include "ipv4-end-point-demux.h"
+
 #include "ns3/log.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
@@ -78,8 +80,16 @@ void
 Ipv4EndPoint::SetPeer(Ipv4Address address, uint16_t port)
 {
     NS_LOG_FUNCTION(this << address << port);
+    if (m_demux)
+    {
+        m_demux->RemoveFromIndex(this);
+    }
     m_peerAddr = address;
     m_peerPort = port;
+    if (m_demux)
+    {
+        m_demux->AddToIndex(this);
+    }
 }
 
 void
@@ -22,6 +22,7 @@ namespace ns3
 {
 
 class Header;
+class Ipv4EndPointDemux;
 class Packet;
 
 /**
@@ -180,6 +181,15 @@ class Ipv4EndPoint
     bool IsRxEnabled() const;
 
   private:
+    /// Allow the demultiplexer to track the end points it indexes
+    friend class Ipv4EndPointDemux;
+
+    /**
+     * \brief The demultiplexer that allocated this end point (if any), which is
+     * notified when the ports or the peer address change.
+     */
+    Ipv4EndPointDemux* m_demux{nullptr};
+
     /**
      * \brief The local address.
      */
@@ -10,6 +10,7 @@
 #include "ipv4-route.h"
 #include "ipv4-routing-table-entry.h"
 
+#include "ns3/abort.h"
 #include "ns3/boolean.h"
 #include "ns3/log.h"
 #include "ns3/names.h"
@@ -19,7 +20,9 @@
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
 
+#include <algorithm>
 #include <iomanip>
+#include <limits>
 #include <vector>
 
 namespace ns3
@@ -29,6 +32,57 @@ NS_LOG_COMPONENT_DEFINE("Ipv4GlobalRouting");
 
 NS_OBJECT_ENSURE_REGISTERED(Ipv4GlobalRouting);
 
+uint32_t
+Ipv4GlobalRoutingDestinations::Add(Ipv4Address address, Ipv4Mask mask, bool host)
+{
+    NS_LOG_FUNCTION(this << address << mask << host);
+    if (host)
+    {
+        mask = Ipv4Mask::GetOnes();
+    }
+    auto& index = host ? m_hostIndex : m_networkIndex;
+    const auto key = GetIpPrefixTrieKey(address.CombineMask(mask));
+    const auto length = mask.GetPrefixLength();
+    if (const auto indices = index.Find(key, length))
+    {
+        return indices->front();
+    }
+    uint32_t destination = m_destinations.size();
+    m_destinations.push_back({address, mask, host});
+    index.Insert(key, length, destination);
+    return destination;
+}
+
+uint32_t
+Ipv4GlobalRoutingDestinations::GetN() const
+{
+    return m_destinations.size();
+}
+
+const Ipv4GlobalRoutingDestinations::Destination&
+Ipv4GlobalRoutingDestinations::Get(uint32_t index) const
+{
+    NS_ASSERT(index < m_destinations.size());
+    return m_destinations[index];
+}
+
+std::optional<uint32_t>
+Ipv4GlobalRoutingDestinations::FindHost(Ipv4Address address) const
+{
+    if (const auto indices = m_hostIndex.Find(GetIpPrefixTrieKey(address), 32))
+    {
+        return indices->front();
+    }
+    return std::nullopt;
+}
+
+std::size_t
+Ipv4GlobalRoutingDestinations::GetMemoryUsage() const
+{
+    return m_destinations.capacity() * sizeof(Destination) + m_hostIndex.GetMemoryUsage() +
+           m_networkIndex.GetMemoryUsage();
+}
+
 TypeId
 Ipv4GlobalRouting::GetTypeId()
 {
@@ -47,13 +101,21 @@ Ipv4GlobalRouting::GetTypeId()
                           "Interface notification events (up/down, or add/remove address)",
                           BooleanValue(false),
                           MakeBooleanAccessor(&Ipv4GlobalRouting::m_respondToInterfaceEvents),
+                          MakeBooleanChecker())
+            .AddAttribute("CompactRoutes",
+                          "Set to true if the GlobalRouteManager should store the intra-area "
+                          "routes of this node as compact routes, whose destinations are shared "
+                          "with the other nodes, rather than as routing table entries",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&Ipv4GlobalRouting::m_useCompactRoutes),
                           MakeBooleanChecker());
     return tid;
 }
 
 Ipv4GlobalRouting::Ipv4GlobalRouting()
     : m_randomEcmpRouting(false),
-      m_respondToInterfaceEvents(false)
+      m_respondToInterfaceEvents(false),
+      m_useCompactRoutes(false)
 {
     NS_LOG_FUNCTION(this);
 
@@ -71,7 +133,7 @@ Ipv4GlobalRouting::AddHostRouteTo(Ipv4Address dest, Ipv4Address nextHop, uint32_
     NS_LOG_FUNCTION(this << dest << nextHop << interface);
     auto route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateHostRouteTo(dest, nextHop, interface);
-    m_hostRoutes.push_back(route);
+    InsertHostRoute(route);
 }
 
 void
@@ -80,7 +142,7 @@ Ipv4GlobalRouting::AddHostRouteTo(Ipv4Address dest, uint32_t interface)
     NS_LOG_FUNCTION(this << dest << interface);
     auto route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateHostRouteTo(dest, interface);
-    m_hostRoutes.push_back(route);
+    InsertHostRoute(route);
 }
 
 void
@@ -92,7 +154,7 @@ Ipv4GlobalRouting::AddNetworkRouteTo(Ipv4Address network,
     NS_LOG_FUNCTION(this << network << networkMask << nextHop << interface);
     auto route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, nextHop, interface);
-    m_networkRoutes.push_back(route);
+    InsertNetworkRoute(route);
 }
 
 void
@@ -101,7 +163,7 @@ Ipv4GlobalRouting::AddNetworkRouteTo(Ipv4Address network, Ipv4Mask networkMask,
     NS_LOG_FUNCTION(this << network << networkMask << interface);
     auto route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, interface);
-    m_networkRoutes.push_back(route);
+    InsertNetworkRoute(route);
 }
 
 void
@@ -116,6 +178,105 @@ Ipv4GlobalRouting::AddASExternalRouteTo(Ipv4Address network,
     m_ASexternalRoutes.push_back(route);
 }
 
+void
+Ipv4GlobalRouting::InsertHostRoute(Ipv4RoutingTableEntry* route)
+{
+    m_hostRoutes.push_back(route);
+    m_hostRouteIndex.Insert(GetIpPrefixTrieKey(route->GetDest()), 32, route);
+}
+
+void
+Ipv4GlobalRouting::InsertNetworkRoute(Ipv4RoutingTableEntry* route)
+{
+    m_networkRoutes.push_back(route);
+    m_networkRouteIndex.Insert(GetIpPrefixTrieKey(route->GetDestNetwork()),
+                               route->GetDestNetworkMask().GetPrefixLength(),
+                               {m_nNetworkRoutesAdded++, route});
+}
+
+bool
+Ipv4GlobalRouting::UsesCompactRoutes() const
+{
+    return m_useCompactRoutes;
+}
+
+void
+Ipv4GlobalRouting::AddCompactRouteTo(Ptr<const Ipv4GlobalRoutingDestinations> destinations,
+                                     uint32_t destination,
+                                     Ipv4Address nextHop,
+                                     uint32_t interface)
+{
+    NS_LOG_FUNCTION(this << destinations << destination << nextHop << interface);
+    NS_ASSERT_MSG(!m_compactDestinations || m_compactDestinations == destinations,
+                  "All the compact routes of a node must use the same destination table");
+    NS_ASSERT(destination < destinations->GetN());
+    m_compactDestinations = destinations;
+    if (destination >= m_compactRoutes.size())
+    {
+        m_compactRoutes.resize(destinations->GetN(), 0);
+    }
+    // the next hop set of the destination is replaced by the set including the new next hop
+    CompactNextHops nextHops;
+    if (m_compactRoutes[destination] != 0)
+    {
+        nextHops = *m_nextHopSets[m_compactRoutes[destination] - 1];
+    }
+    nextHops.push_back({nextHop, interface});
+    auto [it, inserted] =
+        m_nextHopSetIndex.try_emplace(std::move(nextHops), m_nextHopSets.size() + 1);
+    if (inserted)
+    {
+        NS_ABORT_MSG_IF(m_nextHopSets.size() >= std::numeric_limits<uint16_t>::max(),
+                        "Too many distinct next hop sets in the compact routes");
+        m_nextHopSets.push_back(&it->first);
+    }
+    m_compactRoutes[destination] = it->second;
+    m_nCompactRoutes++;
+}
+
+void
+Ipv4GlobalRouting::ClearCompactRoutes()
+{
+    NS_LOG_FUNCTION(this);
+    m_compactDestinations = nullptr;
+    m_compactRoutes.clear();
+    m_compactRoutes.shrink_to_fit();
+    m_nextHopSets.clear();
+    m_nextHopSets.shrink_to_fit();
+    m_nextHopSetIndex.clear();
+    m_nCompactRoutes = 0;
+}
+
+uint32_t
+Ipv4GlobalRouting::GetNCompactRoutes() const
+{
+    return m_nCompactRoutes;
+}
+
+std::size_t
+Ipv4GlobalRouting::GetRoutesMemoryUsage() const
+{
+    // a list node holds two links and the pointer to the entry
+    std::size_t bytes = GetNRoutes() * (sizeof(Ipv4RoutingTableEntry) + 3 * sizeof(void*));
+    bytes += m_hostRouteIndex.GetMemoryUsage() + m_networkRouteIndex.GetMemoryUsage();
+    bytes += m_compactRoutes.capacity() * sizeof(uint16_t);
+    bytes += m_nextHopSets.capacity() * sizeof(const CompactNextHops*);
+    // a map node holds the color, three links and the value
+    const std::size_t mapNodeSize =
+        sizeof(decltype(m_nextHopSetIndex)::value_type) + 4 * sizeof(void*);
+    for (const auto& [nextHops, index] : m_nextHopSetIndex)
+    {
+        bytes += mapNodeSize + nextHops.capacity() * sizeof(CompactNextHop);
+    }
+    return bytes;
+}
+
+Ptr<const Ipv4GlobalRoutingDestinations>
+Ipv4GlobalRouting::GetCompactRouteDestinations() const
+{
+    return m_compactDestinations;
+}
+
 Ptr<Ipv4Route>
 Ipv4GlobalRouting::LookupGlobal(Ipv4Address dest, Ptr<NetDevice> oif)
 {
@@ -125,48 +286,108 @@ Ipv4GlobalRouting::LookupGlobal(Ipv4Address dest, Ptr<NetDevice> oif)
     // store all available routes that bring packets to their destination
     typedef std::vector<Ipv4RoutingTableEntry*> RouteVec_t;
     RouteVec_t allRoutes;
+    // and the available compact routes (destination index and next hop), considered after
+    // the routing table entries of the same kind
+    std::vector<std::pair<uint32_t, const CompactNextHop*>> compactRoutes;
+    auto addCompactRoutes = [&](uint32_t destination) {
+        if (destination >= m_compactRoutes.size() || m_compactRoutes[destination] == 0)
+        {
+            return;
+        }
+        for (const auto& nextHop : *m_nextHopSets[m_compactRoutes[destination] - 1])
+        {
+            if (oif && oif != m_ipv4->GetNetDevice(nextHop.interface))
+            {
+                NS_LOG_LOGIC("Not on requested interface, skipping");
+                continue;
+            }
+            compactRoutes.emplace_back(destination, &nextHop);
+            NS_LOG_LOGIC(compactRoutes.size() << " compact routes found");
+        }
+    };
 
     NS_LOG_LOGIC("Number of m_hostRoutes = " << m_hostRoutes.size());
-    for (auto i = m_hostRoutes.begin(); i != m_hostRoutes.end(); i++)
+    const auto key = GetIpPrefixTrieKey(dest);
+    if (!oif)
     {
-        NS_ASSERT((*i)->IsHost());
-        if ((*i)->GetDest() == dest)
+        if (const auto routes = m_hostRouteIndex.Find(key, 32))
         {
-            if (oif)
+            allRoutes = *routes;
+            NS_LOG_LOGIC(allRoutes.size() << " global host routes found");
+        }
+    }
+    else
+    {
+        for (auto i = m_hostRoutes.begin(); i != m_hostRoutes.end(); i++)
+        {
+            NS_ASSERT((*i)->IsHost());
+            if ((*i)->GetDest() == dest)
             {
                 if (oif != m_ipv4->GetNetDevice((*i)->GetInterface()))
                 {
                     NS_LOG_LOGIC("Not on requested interface, skipping");
                     continue;
                 }
+                allRoutes.push_back(*i);
+                NS_LOG_LOGIC(allRoutes.size() << "Found global host route" << *i);
             }
-            allRoutes.push_back(*i);
-            NS_LOG_LOGIC(allRoutes.size() << "Found global host route" << *i);
         }
     }
-    if (allRoutes.empty()) // if no host route is found
+    if (m_compactDestinations)
+    {
+        if (const auto destination = m_compactDestinations->FindHost(dest))
+        {
+            addCompactRoutes(*destination);
+        }
+    }
+    if (allRoutes.empty() && compactRoutes.empty()) // if no host route is found
     {
         NS_LOG_LOGIC("Number of m_networkRoutes" << m_networkRoutes.size());
-        for (auto j = m_networkRoutes.begin(); j != m_networkRoutes.end(); j++)
+        if (!oif)
         {
-            Ipv4Mask mask = (*j)->GetDestNetworkMask();
-            Ipv4Address entry = (*j)->GetDestNetwork();
-            if (mask.IsMatch(dest, entry))
+            // all the routes to the prefixes matching the destination are selected,
+            // in the order in which they were added (i.e., the order of m_networkRoutes)
+            std::vector<std::pair<uint64_t, Ipv4RoutingTableEntry*>> matches;
+            std::size_t nPrefixes = 0;
+            m_networkRouteIndex.ForEachMatch(key, [&](uint8_t, const auto& routes) {
+                matches.insert(matches.end(), routes.cbegin(), routes.cend());
+                ++nPrefixes;
+            });
+            if (nPrefixes > 1)
             {
-                if (oif)
+                std::sort(matches.begin(), matches.end());
+            }
+            for (const auto& [order, route] : matches)
+            {
+                allRoutes.push_back(route);
+                NS_LOG_LOGIC(allRoutes.size() << "Found global network route" << route);
+            }
+        }
+        else
+        {
+            for (auto j = m_networkRoutes.begin(); j != m_networkRoutes.end(); j++)
+            {
+                Ipv4Mask mask = (*j)->GetDestNetworkMask();
+                Ipv4Address entry = (*j)->GetDestNetwork();
+                if (mask.IsMatch(dest, entry))
                 {
                     if (oif != m_ipv4->GetNetDevice((*j)->GetInterface()))
                     {
                         NS_LOG_LOGIC("Not on requested interface, skipping");
                         continue;
                     }
+                    allRoutes.push_back(*j);
+                    NS_LOG_LOGIC(allRoutes.size() << "Found global network route" << *j);
                 }
-                allRoutes.push_back(*j);
-                NS_LOG_LOGIC(allRoutes.size() << "Found global network route" << *j);
             }
         }
+        if (m_compactDestinations)
+        {
+            m_compactDestinations->ForEachNetworkMatch(dest, addCompactRoutes);
+        }
     }
-    if (allRoutes.empty()) // consider external if no host/network found
+    // consider external if no host/network found
+    if (allRoutes.empty() && compactRoutes.empty())
     {
         for (auto k = m_ASexternalRoutes.begin(); k != m_ASexternalRoutes.end(); k++)
         {
@@ -188,7 +409,7 @@ Ipv4GlobalRouting::LookupGlobal(Ipv4Address dest, Ptr<NetDevice> oif)
             }
         }
     }
-    if (!allRoutes.empty()) // if route(s) is found
+    if (!allRoutes.empty() || !compactRoutes.empty()) // if route(s) is found
     {
         // pick up one of the routes uniformly at random if random
         // ECMP routing is enabled, or always select the first route
@@ -196,20 +417,31 @@ Ipv4GlobalRouting::LookupGlobal(Ipv4Address dest, Ptr<NetDevice> oif)
         uint32_t selectIndex;
         if (m_randomEcmpRouting)
         {
-            selectIndex = m_rand->GetInteger(0, allRoutes.size() - 1);
+            selectIndex = m_rand->GetInteger(0, allRoutes.size() + compactRoutes.size() - 1);
         }
         else
         {
             selectIndex = 0;
         }
-        Ipv4RoutingTableEntry* route = allRoutes.at(selectIndex);
-        // create a Ipv4Route object from the selected routing table entry
+        // create a Ipv4Route object from the selected routing table entry or compact route
         rtentry = Create<Ipv4Route>();
-        rtentry->SetDestination(route->GetDest());
+        uint32_t interfaceIdx;
+        if (selectIndex < allRoutes.size())
+        {
+            Ipv4RoutingTableEntry* route = allRoutes.at(selectIndex);
+            rtentry->SetDestination(route->GetDest());
+            rtentry->SetGateway(route->GetGateway());
+            interfaceIdx = route->GetInterface();
+        }
+        else
+        {
+            const auto& [destination, nextHop] = compactRoutes.at(selectIndex - allRoutes.size());
+            rtentry->SetDestination(m_compactDestinations->Get(destination).address);
+            rtentry->SetGateway(nextHop->gateway);
+            interfaceIdx = nextHop->interface;
+        }
         /// \todo handle multi-address case
-        rtentry->SetSource(m_ipv4->GetAddress(route->GetInterface(), 0).GetLocal());
-        rtentry->SetGateway(route->GetGateway());
-        uint32_t interfaceIdx = route->GetInterface();
+        rtentry->SetSource(m_ipv4->GetAddress(interfaceIdx, 0).GetLocal());
         rtentry->SetOutputDevice(m_ipv4->GetNetDevice(interfaceIdx));
         return rtentry;
     }
@@ -286,6 +518,10 @@ Ipv4GlobalRouting::RemoveRoute(uint32_t index)
             if (tmp == index)
             {
                 NS_LOG_LOGIC("Removing route " << index << "; size = " << m_hostRoutes.size());
+                auto route = *i;
+                m_hostRouteIndex.Remove(GetIpPrefixTrieKey(route->GetDest()),
+                                        32,
+                                        [route](auto indexed) { return indexed == route; });
                 delete *i;
                 m_hostRoutes.erase(i);
                 NS_LOG_LOGIC("Done removing host route "
@@ -302,6 +538,12 @@ Ipv4GlobalRouting::RemoveRoute(uint32_t index)
         if (tmp == index)
         {
             NS_LOG_LOGIC("Removing route " << index << "; size = " << m_networkRoutes.size());
+            auto route = *j;
+            m_networkRouteIndex.Remove(GetIpPrefixTrieKey(route->GetDestNetwork()),
+                                       route->GetDestNetworkMask().GetPrefixLength(),
+                                       [route](const auto& indexed) {
+                                           return indexed.second == route;
+                                       });
             delete *j;
             m_networkRoutes.erase(j);
             NS_LOG_LOGIC("Done removing network route "
@@ -328,6 +570,29 @@ Ipv4GlobalRouting::RemoveRoute(uint32_t index)
     NS_ASSERT(false);
 }
 
+void
+Ipv4GlobalRouting::RemoveAllRoutes()
+{
+    NS_LOG_FUNCTION(this);
+    for (auto route : m_hostRoutes)
+    {
+        delete route;
+    }
+    for (auto route : m_networkRoutes)
+    {
+        delete route;
+    }
+    for (auto route : m_ASexternalRoutes)
+    {
+        delete route;
+    }
+    m_hostRoutes.clear();
+    m_networkRoutes.clear();
+    m_ASexternalRoutes.clear();
+    m_hostRouteIndex.Clear();
+    m_networkRouteIndex.Clear();
+}
+
 int64_t
 Ipv4GlobalRouting::AssignStreams(int64_t stream)
 {
@@ -340,19 +605,8 @@ void
 Ipv4GlobalRouting::DoDispose()
 {
     NS_LOG_FUNCTION(this);
-    for (auto i = m_hostRoutes.begin(); i != m_hostRoutes.end(); i = m_hostRoutes.erase(i))
-    {
-        delete (*i);
-    }
-    for (auto j = m_networkRoutes.begin(); j != m_networkRoutes.end(); j = m_networkRoutes.erase(j))
-    {
-        delete (*j);
-    }
-    for (auto l = m_ASexternalRoutes.begin(); l != m_ASexternalRoutes.end();
-         l = m_ASexternalRoutes.erase(l))
-    {
-        delete (*l);
-    }
+    RemoveAllRoutes();
+    ClearCompactRoutes();
 
     Ipv4RoutingProtocol::DoDispose();
 }
@@ -373,17 +627,41 @@ Ipv4GlobalRouting::PrintRoutingTable(Ptr<OutputStreamWrapper> stream, Time::Unit
         << ", Local time: " << m_ipv4->GetObject<Node>()->GetLocalTime().As(unit)
         << ", Ipv4GlobalRouting table" << std::endl;
 
-    if (GetNRoutes() > 0)
+    std::vector<Ipv4RoutingTableEntry> routes;
+    for (uint32_t j = 0; j < GetNRoutes(); j++)
+    {
+        routes.emplace_back(GetRoute(j));
+    }
+    for (uint32_t d = 0; d < m_compactRoutes.size(); d++)
+    {
+        if (m_compactRoutes[d] == 0)
+        {
+            continue;
+        }
+        const auto& destination = m_compactDestinations->Get(d);
+        for (const auto& nextHop : *m_nextHopSets[m_compactRoutes[d] - 1])
+        {
+            routes.push_back(destination.host
+                                 ? Ipv4RoutingTableEntry::CreateHostRouteTo(destination.address,
+                                                                            nextHop.gateway,
+                                                                            nextHop.interface)
+                                 : Ipv4RoutingTableEntry::CreateNetworkRouteTo(destination.address,
+                                                                               destination.mask,
+                                                                               nextHop.gateway,
+                                                                               nextHop.interface));
+        }
+    }
+
+    if (!routes.empty())
     {
         *os << "Destination     Gateway         Genmask         Flags Metric Ref    Use Iface"
             << std::endl;
-        for (uint32_t j = 0; j < GetNRoutes(); j++)
+        for (const auto& route : routes)
         {
             std::ostringstream dest;
             std::ostringstream gw;
             std::ostringstream mask;
             std::ostringstream flags;
-            Ipv4RoutingTableEntry route = GetRoute(j);
             dest << route.GetDest();
             *os << std::setw(16) << dest.str();
             gw << route.GetGateway();
@@ -7,6 +7,7 @@
 #ifndef IPV4_GLOBAL_ROUTING_H
 #define IPV4_GLOBAL_ROUTING_H
 
+#include "ip-prefix-trie.h"
 #include "ipv4-header.h"
 #include "ipv4-routing-protocol.h"
 #include "ipv4.h"
@@ -14,9 +15,15 @@
 #include "ns3/ipv4-address.h"
 #include "ns3/ptr.h"
 #include "ns3/random-variable-stream.h"
+#include "ns3/simple-ref-count.h"
 
 #include <list>
+#include <map>
+#include <optional>
 #include <stdint.h>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace ns3
 {
@@ -30,6 +37,71 @@ class Ipv4RoutingTableEntry;
 class Ipv4MulticastRoutingTableEntry;
 class Node;
 
+/**
+ * \ingroup ipv4
+ *
+ * \brief Table of the destinations of the compact global routes, shared by all the nodes.
+ *
+ * Every destination (host address or network prefix) of the compact routes of the nodes
+ * is stored once in this table and identified by its index. The nodes only store, for
+ * every destination index, the index of a set of next hops (see
+ * Ipv4GlobalRouting::AddCompactRouteTo), hence the addresses and masks of the destinations
+ * are not replicated in the routing table of every node.
+ */
+class Ipv4GlobalRoutingDestinations : public SimpleRefCount<Ipv4GlobalRoutingDestinations>
+{
+  public:
+    /// A destination
+    struct Destination
+    {
+        Ipv4Address address; //!< the host address or the network address
+        Ipv4Mask mask;       //!< the network mask (/32 for a host)
+        bool host;           //!< true for a host, false for a network
+    };
+
+    /**
+     * \brief Add a destination, unless it is already in the table.
+     * \param address the host address or the network address
+     * \param mask the network mask (ignored for a host)
+     * \param host true for a host, false for a network
+     * \return the index of the destination
+     */
+    uint32_t Add(Ipv4Address address, Ipv4Mask mask, bool host);
+
+    /// \return the number of destinations
+    uint32_t GetN() const;
+
+    /**
+     * \param index the index of a destination
+     * \return the destination
+     */
+    const Destination& Get(uint32_t index) const;
+
+    /**
+     * \param address an address
+     * \return the index of the host destination with the given address, if any
+     */
+    std::optional<uint32_t> FindHost(Ipv4Address address) const;
+
+    /**
+     * \brief Call the given function with the index of every network destination matching
+     * the given address, from the shortest to the longest prefix.
+     * \tparam F the type of the function
+     * \param address the address
+     * \param f the function, taking the index of a destination
+     */
+    template <typename F>
+    void ForEachNetworkMatch(Ipv4Address address, F&& f) const;
+
+    /// \return an estimate of the heap memory used by the table, in bytes
+    std::size_t GetMemoryUsage() const;
+
+  private:
+    std::vector<Destination> m_destinations; //!< the destinations
+    IpPrefixTrie<4, uint32_t> m_hostIndex;    //!< indices of the hosts, by address
+    IpPrefixTrie<4, uint32_t> m_networkIndex; //!< indices of the networks, by prefix
+};
+
 /**
  * \ingroup ipv4
  *
@@ -54,6 +126,14 @@ class Node;
  *
  * This class deals with Ipv4 unicast routes only.
  *
+ * When the CompactRoutes attribute is set, the GlobalRouteManager does not create an
+ * Ipv4RoutingTableEntry for every intra-area route; the destinations are stored once for
+ * all the nodes in an Ipv4GlobalRoutingDestinations table, and every node only stores a
+ * next hop set index per destination. This reduces the memory needed by the routing tables
+ * of large topologies. The compact routes are used by the lookups like the other routes
+ * (after them, when both match a destination) but they are not counted by GetNRoutes and
+ * cannot be accessed by GetRoute.
+ *
  * \see Ipv4RoutingProtocol
  * \see GlobalRouteManager
  */
@@ -210,6 +290,15 @@ class Ipv4GlobalRouting : public Ipv4RoutingProtocol
      */
     void RemoveRoute(uint32_t i);
 
+    /**
+     * \brief Remove all the host, network and AS external routes from the global
+     * routing table.
+     *
+     * This is equivalent to calling RemoveRoute (0) GetNRoutes () times, in linear time.
+     * Compact routes are not removed (see ClearCompactRoutes()).
+     */
+    void RemoveAllRoutes();
+
     /**
      * Assign a fixed random variable stream number to the random variables
      * used by this model.  Return the number of streams (possibly zero) that
@@ -220,6 +309,49 @@ class Ipv4GlobalRouting : public Ipv4RoutingProtocol
      */
     int64_t AssignStreams(int64_t stream);
 
+    /// \return true if the intra-area global routes of this node are stored as compact routes
+    bool UsesCompactRoutes() const;
+
+    /**
+     * \brief Add a compact route to the global routing table.
+     *
+     * Several compact routes can be added toward the same destination (equal-cost
+     * multipath); they are considered in the order in which they were added.
+     *
+     * \param destinations the table of the destinations, which must be the same for all
+     * the compact routes of this node
+     * \param destination the index of the destination in the table
+     * \param nextHop The next hop in the route to the destination.
+     * \param interface The network interface index used to send packets to the
+     * destination.
+     */
+    void AddCompactRouteTo(Ptr<const Ipv4GlobalRoutingDestinations> destinations,
+                           uint32_t destination,
+                           Ipv4Address nextHop,
+                           uint32_t interface);
+
+    /// \brief Remove all the compact routes from the global routing table.
+    void ClearCompactRoutes();
+
+    /// \return the number of compact routes (one per destination and next hop)
+    uint32_t GetNCompactRoutes() const;
+
+    /**
+     * \brief Get an estimate of the heap memory used by the routes of this node.
+     *
+     * The estimate includes the routing table entries and their indexes and the compact
+     * routes, but not the shared table of the destinations of the compact routes.
+     *
+     * \return the estimated memory, in bytes
+     */
+    std::size_t GetRoutesMemoryUsage() const;
+
+    /**
+     * \return the table of the destinations of the compact routes of this node, or a null
+     * pointer if the node has no compact route
+     */
+    Ptr<const Ipv4GlobalRoutingDestinations> GetCompactRouteDestinations() const;
+
   protected:
     void DoDispose() override;
 
@@ -232,6 +364,8 @@ class Ipv4GlobalRouting : public Ipv4RoutingProtocol
     bool m_respondToInterfaceEvents;
     /// A uniform random number generator for randomly routing packets among ECMP
     Ptr<UniformRandomVariable> m_rand;
+    /// Set to true if the intra-area global routes are stored as compact routes
+    bool m_useCompactRoutes;
 
     /// container of Ipv4RoutingTableEntry (routes to hosts)
     typedef std::list<Ipv4RoutingTableEntry*> HostRoutes;
@@ -262,13 +396,75 @@ class Ipv4GlobalRouting : public Ipv4RoutingProtocol
      */
     Ptr<Ipv4Route> LookupGlobal(Ipv4Address dest, Ptr<NetDevice> oif = nullptr);
 
+    /**
+     * \brief Add a route to a host at the end of the host routes and index it.
+     * \param route the route, whose ownership is transferred to this object
+     */
+    void InsertHostRoute(Ipv4RoutingTableEntry* route);
+
+    /**
+     * \brief Add a route to a network at the end of the network routes and index it.
+     * \param route the route, whose ownership is transferred to this object
+     */
+    void InsertNetworkRoute(Ipv4RoutingTableEntry* route);
+
     HostRoutes m_hostRoutes;             //!< Routes to hosts
     NetworkRoutes m_networkRoutes;       //!< Routes to networks
     ASExternalRoutes m_ASexternalRoutes; //!< External routes imported
 
+    /// Host routes indexed by destination address
+    IpPrefixTrie<4, Ipv4RoutingTableEntry*> m_hostRouteIndex;
+    /// Network routes indexed by destination prefix. Every route is paired with its insertion
+    /// number, which gives the order of the routes in m_networkRoutes
+    IpPrefixTrie<4, std::pair<uint64_t, Ipv4RoutingTableEntry*>> m_networkRouteIndex;
+    uint64_t m_nNetworkRoutesAdded{0}; //!< Number of network routes added so far
+
+    /// A next hop of the compact routes
+    struct CompactNextHop
+    {
+        Ipv4Address gateway; //!< the gateway
+        uint32_t interface;  //!< the output interface
+
+        /**
+         * \param other another next hop
+         * \return true if this next hop is ordered before the other one
+         */
+        bool operator<(const CompactNextHop& other) const
+        {
+            return std::tie(gateway, interface) < std::tie(other.gateway, other.interface);
+        }
+    };
+
+    /// A set of next hops of the compact routes, in the order in which they were added
+    using CompactNextHops = std::vector<CompactNextHop>;
+
+    /// Destinations of the compact routes, shared with the other nodes
+    Ptr<const Ipv4GlobalRoutingDestinations> m_compactDestinations;
+    /// Next hop set of the compact routes by destination index; the value is the index of
+    /// the next hop set in m_nextHopSets plus one, zero if there is no route
+    std::vector<uint16_t> m_compactRoutes;
+    /// Distinct next hop sets of the compact routes, with their index in m_nextHopSets
+    std::map<CompactNextHops, uint16_t> m_nextHopSetIndex;
+    /// Distinct next hop sets of the compact routes (the keys of m_nextHopSetIndex)
+    std::vector<const CompactNextHops*> m_nextHopSets;
+    uint32_t m_nCompactRoutes{0}; //!< Number of compact routes
+
     Ptr<Ipv4> m_ipv4; //!< associated IPv4 instance
 };
 
+template <typename F>
+void
+Ipv4GlobalRoutingDestinations::ForEachNetworkMatch(Ipv4Address address, F&& f) const
+{
+    m_networkIndex.ForEachMatch(GetIpPrefixTrieKey(address),
+                                [&f](uint8_t, const std::vector<uint32_t>& indices) {
+                                    for (auto index : indices)
+                                    {
+                                        f(index);
+                                    }
+                                });
+}
+
 } // Namespace ns3
 
 #endif /* IPV4_GLOBAL_ROUTING_H */
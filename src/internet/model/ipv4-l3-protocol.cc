@@ -29,6 +29,7 @@
 #include "ns3/string.h"
 #include "ns3/trace-source-accessor.h"
 #include "ns3/traffic-control-layer.h"
+#include "ns3/tso-tag.h"
 #include "ns3/uinteger.h"
 
 namespace ns3
@@ -980,7 +981,11 @@ Ipv4L3Protocol::SendRealOut(Ptr<Ipv4Route> route, Ptr<Packet> packet, const Ipv4
     if (outInterface->IsUp())
     {
         NS_LOG_LOGIC("Send to " << targetLabel << " " << target);
-        if (packet->GetSize() + ipHeader.GetSerializedSize() > outInterface->GetDevice()->GetMtu())
+        // the segments of a packet carrying several segments are not fragmented
+        TsoTag tsoTag;
+        if (packet->GetSize() + ipHeader.GetSerializedSize() >
+                outInterface->GetDevice()->GetMtu() &&
+            !packet->PeekPacketTag(tsoTag))
         {
             std::list<Ipv4PayloadHeaderPair> listFragments;
             DoFragmentation(packet, ipHeader, outInterface->GetDevice()->GetMtu(), listFragments);
@@ -67,8 +67,7 @@ Ipv4StaticRouting::AddNetworkRouteTo(Ipv4Address network,
 
     if (!LookupRoute(route, metric))
     {
-        auto routePtr = new Ipv4RoutingTableEntry(route);
-        m_networkRoutes.emplace_back(routePtr, metric);
+        InsertNetworkRoute(new Ipv4RoutingTableEntry(route), metric);
     }
 }
 
@@ -84,9 +83,7 @@ Ipv4StaticRouting::AddNetworkRouteTo(Ipv4Address network,
         Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, interface);
     if (!LookupRoute(route, metric))
     {
-        auto routePtr = new Ipv4RoutingTableEntry(route);
-
-        m_networkRoutes.emplace_back(routePtr, metric);
+        InsertNetworkRoute(new Ipv4RoutingTableEntry(route), metric);
     }
 }
 
@@ -141,7 +138,7 @@ Ipv4StaticRouting::SetDefaultMulticastRoute(uint32_t outputInterface)
     Ipv4Address network("224.0.0.0");
     Ipv4Mask networkMask("240.0.0.0");
     *route = Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, outputInterface);
-    m_networkRoutes.emplace_back(route, 0);
+    InsertNetworkRoute(route, 0);
 }
 
 uint32_t
@@ -210,10 +207,40 @@ Ipv4StaticRouting::RemoveMulticastRoute(uint32_t index)
     }
 }
 
+void
+Ipv4StaticRouting::InsertNetworkRoute(Ipv4RoutingTableEntry* route, uint32_t metric)
+{
+    m_networkRoutes.emplace_back(route, metric);
+    m_networkRouteIndex.Insert(GetIpPrefixTrieKey(route->GetDestNetwork()),
+                               route->GetDestNetworkMask().GetPrefixLength(),
+                               std::prev(m_networkRoutes.end()));
+}
+
+Ipv4StaticRouting::NetworkRoutesI
+Ipv4StaticRouting::EraseNetworkRoute(NetworkRoutesI it)
+{
+    Ipv4RoutingTableEntry* route = it->first;
+    [[maybe_unused]] bool removed =
+        m_networkRouteIndex.Remove(GetIpPrefixTrieKey(route->GetDestNetwork()),
+                                   route->GetDestNetworkMask().GetPrefixLength(),
+                                   [it](NetworkRoutesI indexed) { return indexed == it; });
+    NS_ASSERT_MSG(removed, "Route not found in the index");
+    delete route;
+    return m_networkRoutes.erase(it);
+}
+
 bool
 Ipv4StaticRouting::LookupRoute(const Ipv4RoutingTableEntry& route, uint32_t metric)
 {
-    for (auto j = m_networkRoutes.begin(); j != m_networkRoutes.end(); j++)
+    // only the routes to the same prefix can be equal to the given route
+    const auto routes =
+        m_networkRouteIndex.Find(GetIpPrefixTrieKey(route.GetDestNetwork()),
+                                 route.GetDestNetworkMask().GetPrefixLength());
+    if (!routes)
+    {
+        return false;
+    }
+    for (const auto& j : *routes)
     {
         Ipv4RoutingTableEntry* rtentry = j->first;
 
@@ -250,56 +277,84 @@ Ipv4StaticRouting::LookupStatic(Ipv4Address dest, Ptr<NetDevice> oif)
         return rtentry;
     }
 
-    for (auto i = m_networkRoutes.begin(); i != m_networkRoutes.end(); i++)
+    Ipv4RoutingTableEntry* route = nullptr;
+    if (!oif)
     {
-        Ipv4RoutingTableEntry* j = i->first;
-        uint32_t metric = i->second;
-        Ipv4Mask mask = (j)->GetDestNetworkMask();
-        uint16_t masklen = mask.GetPrefixLength();
-        Ipv4Address entry = (j)->GetDestNetwork();
-        NS_LOG_LOGIC("Searching for route to " << dest << ", checking against route to " << entry
-                                               << "/" << masklen);
-        if (mask.IsMatch(dest, entry))
+        // only the routes to the longest prefix matching the destination are candidates
+        if (const auto routes = m_networkRouteIndex.LongestMatch(GetIpPrefixTrieKey(dest)))
         {
-            NS_LOG_LOGIC("Found global network route " << j << ", mask length " << masklen
-                                                       << ", metric " << metric);
-            if (oif)
+            auto best = routes->front();
+            NS_LOG_LOGIC("Longest matching prefix " << best->first->GetDestNetwork() << "/"
+                                                    << best->first->GetDestNetworkMask()
+                                                    << " has " << routes->size() << " routes");
+            // as when scanning the whole table, the first host route is selected, while
+            // the last route with the shortest metric is selected among network routes
+            if (best->first->GetDestNetworkMask().GetPrefixLength() < 32)
             {
+                for (const auto& it : *routes)
+                {
+                    if (it->second <= best->second)
+                    {
+                        best = it;
+                    }
+                }
+            }
+            route = best->first;
+        }
+    }
+    else
+    {
+        for (auto i = m_networkRoutes.begin(); i != m_networkRoutes.end(); i++)
+        {
+            Ipv4RoutingTableEntry* j = i->first;
+            uint32_t metric = i->second;
+            Ipv4Mask mask = (j)->GetDestNetworkMask();
+            uint16_t masklen = mask.GetPrefixLength();
+            Ipv4Address entry = (j)->GetDestNetwork();
+            NS_LOG_LOGIC("Searching for route to " << dest << ", checking against route to "
+                                                   << entry << "/" << masklen);
+            if (mask.IsMatch(dest, entry))
+            {
+                NS_LOG_LOGIC("Found global network route " << j << ", mask length " << masklen
+                                                           << ", metric " << metric);
                 if (oif != m_ipv4->GetNetDevice(j->GetInterface()))
                 {
                     NS_LOG_LOGIC("Not on requested interface, skipping");
                     continue;
                 }
-            }
-            if (masklen < longest_mask) // Not interested if got shorter mask
-            {
-                NS_LOG_LOGIC("Previous match longer, skipping");
-                continue;
-            }
-            if (masklen > longest_mask) // Reset metric if longer masklen
-            {
-                shortest_metric = 0xffffffff;
-            }
-            longest_mask = masklen;
-            if (metric > shortest_metric)
-            {
-                NS_LOG_LOGIC("Equal mask length, but previous metric shorter, skipping");
-                continue;
-            }
-            shortest_metric = metric;
-            Ipv4RoutingTableEntry* route = (j);
-            uint32_t interfaceIdx = route->GetInterface();
-            rtentry = Create<Ipv4Route>();
-            rtentry->SetDestination(route->GetDest());
-            rtentry->SetSource(m_ipv4->SourceAddressSelection(interfaceIdx, route->GetDest()));
-            rtentry->SetGateway(route->GetGateway());
-            rtentry->SetOutputDevice(m_ipv4->GetNetDevice(interfaceIdx));
-            if (masklen == 32)
-            {
-                break;
+                if (masklen < longest_mask) // Not interested if got shorter mask
+                {
+                    NS_LOG_LOGIC("Previous match longer, skipping");
+                    continue;
+                }
+                if (masklen > longest_mask) // Reset metric if longer masklen
+                {
+                    shortest_metric = 0xffffffff;
+                }
+                longest_mask = masklen;
+                if (metric > shortest_metric)
+                {
+                    NS_LOG_LOGIC("Equal mask length, but previous metric shorter, skipping");
+                    continue;
+                }
+                shortest_metric = metric;
+                route = j;
+                if (masklen == 32)
+                {
+                    break;
+                }
             }
         }
     }
+    if (route)
+    {
+        uint32_t interfaceIdx = route->GetInterface();
+        rtentry = Create<Ipv4Route>();
+        rtentry->SetDestination(route->GetDest());
+        rtentry->SetSource(m_ipv4->SourceAddressSelection(interfaceIdx, route->GetDest()));
+        rtentry->SetGateway(route->GetGateway());
+        rtentry->SetOutputDevice(m_ipv4->GetNetDevice(interfaceIdx));
+    }
     if (rtentry)
     {
         NS_LOG_LOGIC("Matching route via " << rtentry->GetGateway() << " at the end");
@@ -446,8 +501,7 @@ Ipv4StaticRouting::RemoveRoute(uint32_t index)
     {
         if (tmp == index)
         {
-            delete j->first;
-            m_networkRoutes.erase(j);
+            EraseNetworkRoute(j);
             return;
         }
         tmp++;
@@ -581,6 +635,7 @@ Ipv4StaticRouting::DoDispose()
     {
         delete (j->first);
     }
+    m_networkRouteIndex.Clear();
     for (auto i = m_multicastRoutes.begin(); i != m_multicastRoutes.end();
          i = m_multicastRoutes.erase(i))
     {
@@ -620,8 +675,7 @@ Ipv4StaticRouting::NotifyInterfaceDown(uint32_t i)
     {
         if (it->first->GetInterface() == i)
         {
-            delete it->first;
-            it = m_networkRoutes.erase(it);
+            it = EraseNetworkRoute(it);
         }
         else
         {
@@ -665,8 +719,7 @@ Ipv4StaticRouting::NotifyRemoveAddress(uint32_t interface, Ipv4InterfaceAddress
             it->first->GetDestNetwork() == networkAddress &&
             it->first->GetDestNetworkMask() == networkMask)
         {
-            delete it->first;
-            it = m_networkRoutes.erase(it);
+            it = EraseNetworkRoute(it);
         }
         else
         {
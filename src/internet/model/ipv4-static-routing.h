@@ -10,6 +10,7 @@
 #ifndef IPV4_STATIC_ROUTING_H
 #define IPV4_STATIC_ROUTING_H
 
+#include "ip-prefix-trie.h"
 #include "ipv4-header.h"
 #include "ipv4-routing-protocol.h"
 #include "ipv4.h"
@@ -370,6 +371,20 @@ class Ipv4StaticRouting : public Ipv4RoutingProtocol
     /// Iterator for container for the multicast routes
     typedef std::list<Ipv4MulticastRoutingTableEntry*>::iterator MulticastRoutesI;
 
+    /**
+     * \brief Add a network route at the end of the forwarding table and index it.
+     * \param route the route, whose ownership is transferred to this object
+     * \param metric metric of route
+     */
+    void InsertNetworkRoute(Ipv4RoutingTableEntry* route, uint32_t metric);
+
+    /**
+     * \brief Remove a network route from the forwarding table and from the index.
+     * \param it the iterator pointing to the route
+     * \return the iterator following the removed route
+     */
+    NetworkRoutesI EraseNetworkRoute(NetworkRoutesI it);
+
     /**
      * \brief Checks if a route is already present in the forwarding table.
      * \param route route
@@ -400,6 +415,12 @@ class Ipv4StaticRouting : public Ipv4RoutingProtocol
      */
     NetworkRoutes m_networkRoutes;
 
+    /**
+     * \brief the network routes indexed by destination prefix, to find the longest
+     * prefix matching a destination without scanning the forwarding table.
+     */
+    IpPrefixTrie<4, NetworkRoutesI> m_networkRouteIndex;
+
     /**
      * \brief the forwarding table for multicast.
      */
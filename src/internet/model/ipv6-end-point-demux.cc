@@ -12,6 +12,8 @@
 
 #include "ns3/log.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -40,20 +42,17 @@ bool
 Ipv6EndPointDemux::LookupPortLocal(uint16_t port)
 {
     NS_LOG_FUNCTION(this << port);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
-    {
-        if ((*i)->GetLocalPort() == port)
-        {
-            return true;
-        }
-    }
-    return false;
+    return m_nEndPointsPerPort.contains(port);
 }
 
 bool
 Ipv6EndPointDemux::LookupLocal(Ptr<NetDevice> boundNetDevice, Ipv6Address addr, uint16_t port)
 {
     NS_LOG_FUNCTION(this << addr << port);
+    if (!LookupPortLocal(port))
+    {
+        return false;
+    }
     for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
     {
         if ((*i)->GetLocalPort() == port && (*i)->GetLocalAddress() == addr &&
@@ -76,7 +75,7 @@ Ipv6EndPointDemux::Allocate()
         return nullptr;
     }
     auto endPoint = new Ipv6EndPoint(Ipv6Address::GetAny(), port);
-    m_endPoints.push_back(endPoint);
+    AddEndPoint(endPoint);
     NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
     return endPoint;
 }
@@ -92,7 +91,7 @@ Ipv6EndPointDemux::Allocate(Ipv6Address address)
         return nullptr;
     }
     auto endPoint = new Ipv6EndPoint(address, port);
-    m_endPoints.push_back(endPoint);
+    AddEndPoint(endPoint);
     NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
     return endPoint;
 }
@@ -115,7 +114,7 @@ Ipv6EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice, Ipv6Address address,
         return nullptr;
     }
     auto endPoint = new Ipv6EndPoint(address, port);
-    m_endPoints.push_back(endPoint);
+    AddEndPoint(endPoint);
     NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
     return endPoint;
 }
@@ -128,19 +127,21 @@ Ipv6EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice,
                             uint16_t peerPort)
 {
     NS_LOG_FUNCTION(this << boundNetDevice << localAddress << localPort << peerAddress << peerPort);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    if (auto endPoints = GetIndexedEndPoints(localPort, peerAddress, peerPort))
     {
-        if ((*i)->GetLocalPort() == localPort && (*i)->GetLocalAddress() == localAddress &&
-            (*i)->GetPeerPort() == peerPort && (*i)->GetPeerAddress() == peerAddress &&
-            ((*i)->GetBoundNetDevice() == boundNetDevice || !(*i)->GetBoundNetDevice()))
+        for (auto endP : *endPoints)
         {
-            NS_LOG_WARN("Duplicated endpoint.");
-            return nullptr;
+            if (endP->GetLocalAddress() == localAddress &&
+                (endP->GetBoundNetDevice() == boundNetDevice || !endP->GetBoundNetDevice()))
+            {
+                NS_LOG_WARN("Duplicated endpoint.");
+                return nullptr;
+            }
         }
     }
     auto endPoint = new Ipv6EndPoint(localAddress, localPort);
     endPoint->SetPeer(peerAddress, peerPort);
-    m_endPoints.push_back(endPoint);
+    AddEndPoint(endPoint);
 
     NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
 
@@ -151,15 +152,98 @@ void
 Ipv6EndPointDemux::DeAllocate(Ipv6EndPoint* endPoint)
 {
     NS_LOG_FUNCTION(this);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    auto it = m_endPointPositions.find(endPoint);
+    if (it == m_endPointPositions.end())
+    {
+        return;
+    }
+    RemoveFromIndex(endPoint);
+    m_endPoints.erase(it->second);
+    m_endPointPositions.erase(it);
+    delete endPoint;
+}
+
+void
+Ipv6EndPointDemux::AddEndPoint(Ipv6EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    NS_ASSERT(!endPoint->m_demux);
+    m_endPointPositions.emplace(endPoint, m_endPoints.insert(m_endPoints.end(), endPoint));
+    AddToIndex(endPoint);
+    endPoint->m_demux = this;
+}
+
+std::size_t
+Ipv6EndPointDemux::PeerKeyHash::operator()(const PeerKey& key) const
+{
+    return Ipv6AddressHash()(key.peerAddress) ^
+           std::hash<uint32_t>()((static_cast<uint32_t>(key.localPort) << 16) | key.peerPort);
+}
+
+void
+Ipv6EndPointDemux::AddToIndex(Ipv6EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    ++m_nEndPointsPerPort[endPoint->GetLocalPort()];
+    if (endPoint->GetPeerAddress() == Ipv6Address::GetAny() && endPoint->GetPeerPort() == 0)
+    {
+        m_listeners[endPoint->GetLocalPort()].push_back(endPoint);
+    }
+    else
     {
-        if (*i == endPoint)
+        PeerKey key{endPoint->GetPeerAddress(), endPoint->GetLocalPort(), endPoint->GetPeerPort()};
+        m_connected[key].push_back(endPoint);
+    }
+}
+
+void
+Ipv6EndPointDemux::RemoveFromIndex(Ipv6EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    auto count = m_nEndPointsPerPort.find(endPoint->GetLocalPort());
+    NS_ASSERT_MSG(count != m_nEndPointsPerPort.end(), "End point not indexed");
+    if (--count->second == 0)
+    {
+        m_nEndPointsPerPort.erase(count);
+    }
+
+    // lambda to remove the end point from a bucket of the given index
+    auto remove = [endPoint](auto& index, const auto& key) {
+        auto it = index.find(key);
+        NS_ASSERT_MSG(it != index.end(), "End point not indexed");
+        auto& endPoints = it->second;
+        endPoints.erase(std::find(endPoints.begin(), endPoints.end(), endPoint));
+        if (endPoints.empty())
         {
-            delete endPoint;
-            m_endPoints.erase(i);
-            break;
+            index.erase(it);
         }
+    };
+
+    if (endPoint->GetPeerAddress() == Ipv6Address::GetAny() && endPoint->GetPeerPort() == 0)
+    {
+        remove(m_listeners, endPoint->GetLocalPort());
+    }
+    else
+    {
+        remove(m_connected,
+               PeerKey{endPoint->GetPeerAddress(),
+                       endPoint->GetLocalPort(),
+                       endPoint->GetPeerPort()});
+    }
+}
+
+const std::vector<Ipv6EndPoint*>*
+Ipv6EndPointDemux::GetIndexedEndPoints(uint16_t localPort,
+                                       Ipv6Address peerAddress,
+                                       uint16_t peerPort) const
+{
+    if (peerAddress == Ipv6Address::GetAny() && peerPort == 0)
+    {
+        auto it = m_listeners.find(localPort);
+        return it != m_listeners.end() ? &it->second : nullptr;
     }
+    auto it = m_connected.find({peerAddress, localPort, peerPort});
+    return it != m_connected.end() ? &it->second : nullptr;
 }
 
 /*
@@ -182,7 +266,30 @@ Ipv6EndPointDemux::Lookup(Ipv6Address daddr,
     EndPoints retval4; /* Exact match on all 4 */
 
     NS_LOG_DEBUG("Looking up endpoint for destination address " << daddr);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+
+    // The candidates are the end points connected to the source and those accepting packets
+    // from any peer. End points whose peer is only partially specified (e.g., with a wildcard
+    // port) can only match a wildcard source address or port, in which case all the end
+    // points are candidates.
+    std::vector<Ipv6EndPoint*> candidates;
+    if (saddr == Ipv6Address::GetAny() || sport == 0)
+    {
+        candidates.assign(m_endPoints.begin(), m_endPoints.end());
+    }
+    else
+    {
+        auto connected = GetIndexedEndPoints(dport, saddr, sport);
+        auto listeners = GetIndexedEndPoints(dport, Ipv6Address::GetAny(), 0);
+        for (auto endPoints : {connected, listeners})
+        {
+            if (endPoints)
+            {
+                candidates.insert(candidates.end(), endPoints->cbegin(), endPoints->cend());
+            }
+        }
+    }
+
+    for (auto i = candidates.begin(); i != candidates.end(); i++)
     {
         Ipv6EndPoint* endP = *i;
 
@@ -15,6 +15,8 @@
 
 #include <list>
 #include <stdint.h>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -150,6 +152,70 @@ class Ipv6EndPointDemux
     EndPoints GetEndPoints() const;
 
   private:
+    /// Allow the end points to notify changes of their ports or peer
+    friend class Ipv6EndPoint;
+
+    /**
+     * \brief Key of the index of the end points by local port and peer.
+     */
+    struct PeerKey
+    {
+        Ipv6Address peerAddress; //!< the peer address
+        uint16_t localPort;      //!< the local port
+        uint16_t peerPort;       //!< the peer port
+
+        /**
+         * \param other the key to compare with
+         * \return true if the keys are equal
+         */
+        bool operator==(const PeerKey& other) const = default;
+    };
+
+    /**
+     * \brief Hash function for PeerKey.
+     */
+    struct PeerKeyHash
+    {
+        /**
+         * \param key the key
+         * \return the hash of the key
+         */
+        std::size_t operator()(const PeerKey& key) const;
+    };
+
+    /**
+     * \brief Add a new end point to the list of end points and to the indices.
+     * \param endPoint the end point
+     */
+    void AddEndPoint(Ipv6EndPoint* endPoint);
+
+    /**
+     * \brief Add an end point to the indices, according to its current ports and peer.
+     * \param endPoint the end point
+     */
+    void AddToIndex(Ipv6EndPoint* endPoint);
+
+    /**
+     * \brief Remove an end point from the indices, according to its current ports and peer.
+     * \param endPoint the end point
+     */
+    void RemoveFromIndex(Ipv6EndPoint* endPoint);
+
+    /**
+     * \brief Get the end points that have the given local port and peer.
+     *
+     * End points accepting packets from any peer (i.e., whose peer address and port are
+     * wildcards) are indexed by local port only.
+     *
+     * \param localPort the local port
+     * \param peerAddress the peer address
+     * \param peerPort the peer port
+     * \return the end points (could be null if there are none)
+     */
+    const std::vector<Ipv6EndPoint*>* GetIndexedEndPoints(uint16_t localPort,
+                                                          Ipv6Address peerAddress,
+                                                          uint16_t peerPort) const;
+
     /**
      * \brief Allocate a ephemeral port.
      * \return a port
@@ -175,6 +241,26 @@ class Ipv6EndPointDemux
      * \brief A list of IPv6 end points.
      */
     EndPoints m_endPoints;
+
+    /**
+     * \brief The position of every end point in the list of end points.
+     */
+    std::unordered_map<Ipv6EndPoint*, EndPointsI> m_endPointPositions;
+
+    /**
+     * \brief The number of end points using every local port.
+     */
+    std::unordered_map<uint16_t, uint32_t> m_nEndPointsPerPort;
+
+    /**
+     * \brief The end points accepting packets from any peer, by local port.
+     */
+    std::unordered_map<uint16_t, std::vector<Ipv6EndPoint*>> m_listeners;
+
+    /**
+     * \brief The other end points, by local port and peer.
+     */
+    std::unordered_map<PeerKey, std::vector<Ipv6EndPoint*>, PeerKeyHash> m_connected;
 };
 
 } /* namespace ns3 */
@@ -8,6 +8,8 @@
 
 #include "ipv6-end-point.h"
 
+#include "ipv6-end-point-demux.h"
+
 #include "ns3/log.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
@@ -58,7 +60,15 @@ Ipv6EndPoint::GetLocalPort() const
 void
 Ipv6EndPoint::SetLocalPort(uint16_t port)
 {
+    if (m_demux)
+    {
+        m_demux->RemoveFromIndex(this);
+    }
     m_localPort = port;
+    if (m_demux)
+    {
+        m_demux->AddToIndex(this);
+    }
 }
 
 Ipv6Address
@@ -88,8 +98,16 @@ Ipv6EndPoint::GetBoundNetDevice() const
 void
 Ipv6EndPoint::SetPeer(Ipv6Address addr, uint16_t port)
 {
+    if (m_demux)
+    {
+        m_demux->RemoveFromIndex(this);
+    }
     m_peerAddr = addr;
     m_peerPort = port;
+    if (m_demux)
+    {
+        m_demux->AddToIndex(this);
+    }
 }
 
 void
@@ -22,6 +22,7 @@ namespace ns3
 {
 
 class Header;
+class Ipv6EndPointDemux;
 class Packet;
 
 /**
@@ -184,6 +185,15 @@ class Ipv6EndPoint
     bool IsRxEnabled() const;
 
   private:
+    /// Allow the demultiplexer to track the end points it indexes
+    friend class Ipv6EndPointDemux;
+
+    /**
+     * \brief The demultiplexer that allocated this end point (if any), which is
+     * notified when the ports or the peer address change.
+     */
+    Ipv6EndPointDemux* m_demux{nullptr};
+
     /**
      * \brief The local address.
      */
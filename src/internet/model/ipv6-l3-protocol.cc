@@ -31,6 +31,7 @@
 #include "ns3/object-vector.h"
 #include "ns3/trace-source-accessor.h"
 #include "ns3/traffic-control-layer.h"
+#include "ns3/tso-tag.h"
 #include "ns3/uinteger.h"
 #include "ns3/vector.h"
 
@@ -1219,7 +1220,10 @@ Ipv6L3Protocol::SendRealOut(Ptr<Ipv6Route> route, Ptr<Packet> packet, const Ipv6
         targetMtu = dev->GetMtu();
     }
 
-    if (packet->GetSize() + ipHeader.GetSerializedSize() > targetMtu)
+    // the segments of a packet carrying several segments are not fragmented
+    TsoTag tsoTag;
+    if (packet->GetSize() + ipHeader.GetSerializedSize() > targetMtu &&
+        !packet->PeekPacketTag(tsoTag))
     {
         // Router => drop
         if (!fromMe)
@@ -170,8 +170,7 @@ Ipv6StaticRouting::AddNetworkRouteTo(Ipv6Address network,
 
     if (!LookupRoute(route, metric))
     {
-        auto routePtr = new Ipv6RoutingTableEntry(route);
-        m_networkRoutes.emplace_back(routePtr, metric);
+        InsertNetworkRoute(new Ipv6RoutingTableEntry(route), metric);
     }
 }
 
@@ -197,8 +196,7 @@ Ipv6StaticRouting::AddNetworkRouteTo(Ipv6Address network,
                                                                               prefixToUse);
     if (!LookupRoute(route, metric))
     {
-        auto routePtr = new Ipv6RoutingTableEntry(route);
-        m_networkRoutes.emplace_back(routePtr, metric);
+        InsertNetworkRoute(new Ipv6RoutingTableEntry(route), metric);
     }
 }
 
@@ -214,8 +212,7 @@ Ipv6StaticRouting::AddNetworkRouteTo(Ipv6Address network,
         Ipv6RoutingTableEntry::CreateNetworkRouteTo(network, networkPrefix, interface);
     if (!LookupRoute(route, metric))
     {
-        auto routePtr = new Ipv6RoutingTableEntry(route);
-        m_networkRoutes.emplace_back(routePtr, metric);
+        InsertNetworkRoute(new Ipv6RoutingTableEntry(route), metric);
     }
 }
 
@@ -257,7 +254,7 @@ Ipv6StaticRouting::SetDefaultMulticastRoute(uint32_t outputInterface)
     Ipv6Address network = Ipv6Address("ff00::"); /* RFC 3513 */
     Ipv6Prefix networkMask = Ipv6Prefix(8);
     *route = Ipv6RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, outputInterface);
-    m_networkRoutes.emplace_back(route, 0);
+    InsertNetworkRoute(route, 0);
 }
 
 uint32_t
@@ -332,27 +329,54 @@ Ipv6StaticRouting::HasNetworkDest(Ipv6Address network, uint32_t interfaceIndex)
 {
     NS_LOG_FUNCTION(this << network << interfaceIndex);
 
-    /* in the network table */
-    for (auto j = m_networkRoutes.begin(); j != m_networkRoutes.end(); j++)
-    {
-        Ipv6RoutingTableEntry* rtentry = j->first;
-        Ipv6Prefix prefix = rtentry->GetDestNetworkPrefix();
-        Ipv6Address entry = rtentry->GetDestNetwork();
-
-        if (prefix.IsMatch(network, entry) && rtentry->GetInterface() == interfaceIndex)
+    /* in the network table, among the routes to the prefixes matching the network */
+    bool found = false;
+    auto checkRoutes = [&found, interfaceIndex](uint8_t, const auto& routes) {
+        for (const auto& j : routes)
         {
-            return true;
+            found = found || j->first->GetInterface() == interfaceIndex;
         }
-    }
+    };
+    m_networkRouteIndex.ForEachMatch(GetIpPrefixTrieKey(network), checkRoutes);
 
     /* beuh!!! not route at all */
-    return false;
+    return found;
+}
+
+void
+Ipv6StaticRouting::InsertNetworkRoute(Ipv6RoutingTableEntry* route, uint32_t metric)
+{
+    m_networkRoutes.emplace_back(route, metric);
+    m_networkRouteIndex.Insert(GetIpPrefixTrieKey(route->GetDestNetwork()),
+                               route->GetDestNetworkPrefix().GetPrefixLength(),
+                               std::prev(m_networkRoutes.end()));
+}
+
+Ipv6StaticRouting::NetworkRoutesI
+Ipv6StaticRouting::EraseNetworkRoute(NetworkRoutesI it)
+{
+    Ipv6RoutingTableEntry* route = it->first;
+    [[maybe_unused]] bool removed =
+        m_networkRouteIndex.Remove(GetIpPrefixTrieKey(route->GetDestNetwork()),
+                                   route->GetDestNetworkPrefix().GetPrefixLength(),
+                                   [it](NetworkRoutesI indexed) { return indexed == it; });
+    NS_ASSERT_MSG(removed, "Route not found in the index");
+    delete route;
+    return m_networkRoutes.erase(it);
 }
 
 bool
 Ipv6StaticRouting::LookupRoute(const Ipv6RoutingTableEntry& route, uint32_t metric)
 {
-    for (auto j = m_networkRoutes.begin(); j != m_networkRoutes.end(); j++)
+    // only the routes to the same prefix can be equal to the given route
+    const auto routes =
+        m_networkRouteIndex.Find(GetIpPrefixTrieKey(route.GetDestNetwork()),
+                                 route.GetDestNetworkPrefix().GetPrefixLength());
+    if (!routes)
+    {
+        return false;
+    }
+    for (const auto& j : *routes)
     {
         Ipv6RoutingTableEntry* rtentry = j->first;
 
@@ -391,72 +415,103 @@ Ipv6StaticRouting::LookupStatic(Ipv6Address dst, Ptr<NetDevice> interface)
         return rtentry;
     }
 
-    for (auto it = m_networkRoutes.begin(); it != m_networkRoutes.end(); it++)
+    Ipv6RoutingTableEntry* route = nullptr;
+    if (!interface)
     {
-        Ipv6RoutingTableEntry* j = it->first;
-        uint32_t metric = it->second;
-        Ipv6Prefix mask = j->GetDestNetworkPrefix();
-        uint16_t maskLen = mask.GetPrefixLength();
-        Ipv6Address entry = j->GetDestNetwork();
-
-        NS_LOG_LOGIC("Searching for route to " << dst << ", mask length " << maskLen << ", metric "
-                                               << metric);
-
-        if (mask.IsMatch(dst, entry))
+        // only the routes to the longest prefix matching the destination are candidates
+        if (const auto routes = m_networkRouteIndex.LongestMatch(GetIpPrefixTrieKey(dst)))
         {
-            NS_LOG_LOGIC("Found global network route " << *j << ", mask length " << maskLen
-                                                       << ", metric " << metric);
-
-            /* if interface is given, check the route will output on this interface */
-            if (!interface || interface == m_ipv6->GetNetDevice(j->GetInterface()))
+            auto best = routes->front();
+            NS_LOG_LOGIC("Longest matching prefix " << best->first->GetDestNetwork() << "/"
+                                                    << best->first->GetDestNetworkPrefix()
+                                                    << " has " << routes->size() << " routes");
+            // as when scanning the whole table, the first host route is selected, while
+            // the last route with the shortest metric is selected among network routes
+            if (best->first->GetDestNetworkPrefix().GetPrefixLength() < 128)
             {
-                if (maskLen < longestMask)
+                for (const auto& it : *routes)
                 {
-                    NS_LOG_LOGIC("Previous match longer, skipping");
-                    continue;
+                    if (it->second <= best->second)
+                    {
+                        best = it;
+                    }
                 }
+            }
+            route = best->first;
+        }
+    }
+    else
+    {
+        for (auto it = m_networkRoutes.begin(); it != m_networkRoutes.end(); it++)
+        {
+            Ipv6RoutingTableEntry* j = it->first;
+            uint32_t metric = it->second;
+            Ipv6Prefix mask = j->GetDestNetworkPrefix();
+            uint16_t maskLen = mask.GetPrefixLength();
+            Ipv6Address entry = j->GetDestNetwork();
 
-                if (maskLen > longestMask)
-                {
-                    shortestMetric = 0xffffffff;
-                }
+            NS_LOG_LOGIC("Searching for route to " << dst << ", mask length " << maskLen
+                                                   << ", metric " << metric);
+
+            if (mask.IsMatch(dst, entry))
+            {
+                NS_LOG_LOGIC("Found global network route " << *j << ", mask length " << maskLen
+                                                           << ", metric " << metric);
 
-                longestMask = maskLen;
-                if (metric > shortestMetric)
+                /* check the route will output on the given interface */
+                if (interface == m_ipv6->GetNetDevice(j->GetInterface()))
                 {
-                    NS_LOG_LOGIC("Equal mask length, but previous metric shorter, skipping");
-                    continue;
-                }
+                    if (maskLen < longestMask)
+                    {
+                        NS_LOG_LOGIC("Previous match longer, skipping");
+                        continue;
+                    }
 
-                shortestMetric = metric;
-                Ipv6RoutingTableEntry* route = j;
-                uint32_t interfaceIdx = route->GetInterface();
-                rtentry = Create<Ipv6Route>();
+                    if (maskLen > longestMask)
+                    {
+                        shortestMetric = 0xffffffff;
+                    }
 
-                if (route->GetGateway().IsAny() || !route->GetDest().IsAny())
-                {
-                    rtentry->SetSource(
-                        m_ipv6->SourceAddressSelection(interfaceIdx, route->GetDest()));
-                }
-                else
-                {
-                    // Default route
-                    rtentry->SetSource(m_ipv6->SourceAddressSelection(
-                        interfaceIdx,
-                        route->GetPrefixToUse().IsAny() ? dst : route->GetPrefixToUse()));
-                }
+                    longestMask = maskLen;
+                    if (metric > shortestMetric)
+                    {
+                        NS_LOG_LOGIC("Equal mask length, but previous metric shorter, skipping");
+                        continue;
+                    }
 
-                rtentry->SetDestination(route->GetDest());
-                rtentry->SetGateway(route->GetGateway());
-                rtentry->SetOutputDevice(m_ipv6->GetNetDevice(interfaceIdx));
-                if (maskLen == 128)
-                {
-                    break;
+                    shortestMetric = metric;
+                    route = j;
+                    if (maskLen == 128)
+                    {
+                        break;
+                    }
                 }
             }
         }
     }
 
+    if (route)
+    {
+        uint32_t interfaceIdx = route->GetInterface();
+        rtentry = Create<Ipv6Route>();
+
+        if (route->GetGateway().IsAny() || !route->GetDest().IsAny())
+        {
+            rtentry->SetSource(m_ipv6->SourceAddressSelection(interfaceIdx, route->GetDest()));
+        }
+        else
+        {
+            // Default route
+            rtentry->SetSource(m_ipv6->SourceAddressSelection(
+                interfaceIdx,
+                route->GetPrefixToUse().IsAny() ? dst : route->GetPrefixToUse()));
+        }
+
+        rtentry->SetDestination(route->GetDest());
+        rtentry->SetGateway(route->GetGateway());
+        rtentry->SetOutputDevice(m_ipv6->GetNetDevice(interfaceIdx));
+    }
+
     if (rtentry)
     {
         NS_LOG_LOGIC("Matching route via " << rtentry->GetDestination() << " (Through "
@@ -475,6 +530,7 @@ Ipv6StaticRouting::DoDispose()
         delete j->first;
     }
     m_networkRoutes.clear();
+    m_networkRouteIndex.Clear();
 
     for (auto i = m_multicastRoutes.begin(); i != m_multicastRoutes.end();
          i = m_multicastRoutes.erase(i))
@@ -632,8 +688,7 @@ Ipv6StaticRouting::RemoveRoute(uint32_t index)
     {
         if (tmp == index)
         {
-            delete it->first;
-            m_networkRoutes.erase(it);
+            EraseNetworkRoute(it);
             return;
         }
         tmp++;
@@ -655,8 +710,7 @@ Ipv6StaticRouting::RemoveRoute(Ipv6Address network,
         if (network == rtentry->GetDest() && rtentry->GetInterface() == ifIndex &&
             rtentry->GetPrefixToUse() == prefixToUse)
         {
-            delete it->first;
-            m_networkRoutes.erase(it);
+            EraseNetworkRoute(it);
             return;
         }
     }
@@ -797,8 +851,7 @@ Ipv6StaticRouting::NotifyInterfaceDown(uint32_t i)
     {
         if (it->first->GetInterface() == i)
         {
-            delete it->first;
-            it = m_networkRoutes.erase(it);
+            it = EraseNetworkRoute(it);
         }
         else
         {
@@ -835,8 +888,7 @@ Ipv6StaticRouting::NotifyRemoveAddress(uint32_t interface, Ipv6InterfaceAddress
             it->first->GetDestNetwork() == networkAddress &&
             it->first->GetDestNetworkPrefix() == networkMask)
         {
-            delete it->first;
-            it = m_networkRoutes.erase(it);
+            it = EraseNetworkRoute(it);
         }
         else
         {
@@ -893,8 +945,7 @@ Ipv6StaticRouting::NotifyRemoveRoute(Ipv6Address dst,
 
             if (dst == entry && prefix == mask && rtentry->GetInterface() == interface)
             {
-                delete j->first;
-                j = m_networkRoutes.erase(j);
+                j = EraseNetworkRoute(j);
             }
             else
             {
@@ -9,6 +9,7 @@
 #ifndef IPV6_STATIC_ROUTING_H
 #define IPV6_STATIC_ROUTING_H
 
+#include "ip-prefix-trie.h"
 #include "ipv6-header.h"
 #include "ipv6-routing-protocol.h"
 #include "ipv6.h"
@@ -295,6 +296,20 @@ class Ipv6StaticRouting : public Ipv6RoutingProtocol
     /// Iterator for container for the multicast routes
     typedef std::list<Ipv6MulticastRoutingTableEntry*>::iterator MulticastRoutesI;
 
+    /**
+     * \brief Add a network route at the end of the forwarding table and index it.
+     * \param route the route, whose ownership is transferred to this object
+     * \param metric metric of route
+     */
+    void InsertNetworkRoute(Ipv6RoutingTableEntry* route, uint32_t metric);
+
+    /**
+     * \brief Remove a network route from the forwarding table and from the index.
+     * \param it the iterator pointing to the route
+     * \return the iterator following the removed route
+     */
+    NetworkRoutesI EraseNetworkRoute(NetworkRoutesI it);
+
     /**
      * \brief Checks if a route is already present in the forwarding table.
      * \param route route
@@ -325,6 +340,12 @@ class Ipv6StaticRouting : public Ipv6RoutingProtocol
      */
     NetworkRoutes m_networkRoutes;
 
+    /**
+     * \brief the network routes indexed by destination prefix, to find the longest
+     * prefix matching a destination without scanning the forwarding table.
+     */
+    IpPrefixTrie<16, NetworkRoutesI> m_networkRouteIndex;
+
     /**
      * \brief the forwarding table for multicast.
      */
@@ -107,14 +107,11 @@ NdiscCache::LookupInverse(Address dst)
     NS_LOG_FUNCTION(this << dst);
 
     std::list<NdiscCache::Entry*> entryList;
-    for (auto i = m_ndCache.begin(); i != m_ndCache.end(); i++)
+    auto [first, last] = m_macIndex.equal_range(dst);
+    for (auto i = first; i != last; i++)
     {
-        NdiscCache::Entry* entry = (*i).second;
-        if (entry->GetMacAddress() == dst)
-        {
-            NS_LOG_LOGIC("Found an entry:" << (*entry));
-            entryList.push_back(entry);
-        }
+        NS_LOG_LOGIC("Found an entry:" << (*i->second));
+        entryList.push_back(i->second);
     }
     return entryList;
 }
@@ -128,6 +125,7 @@ NdiscCache::Add(Ipv6Address to)
     auto entry = new NdiscCache::Entry(this);
     entry->SetIpv6Address(to);
     m_ndCache[to] = entry;
+    m_macIndex.emplace(entry->GetMacAddress(), entry);
     return entry;
 }
 
@@ -136,13 +134,46 @@ NdiscCache::Remove(NdiscCache::Entry* entry)
 {
     NS_LOG_FUNCTION(this << entry);
 
-    for (auto i = m_ndCache.begin(); i != m_ndCache.end(); i++)
+    auto it = m_ndCache.find(entry->GetIpv6Address());
+    if (it != m_ndCache.end() && it->second == entry)
+    {
+        m_ndCache.erase(it);
+        RemoveFromMacIndex(entry);
+        entry->ClearWaitingPacket();
+        delete entry;
+    }
+}
+
+void
+NdiscCache::UpdateMacIndex(NdiscCache::Entry* entry, const Address& oldMac, const Address& newMac)
+{
+    NS_LOG_FUNCTION(this << entry << oldMac << newMac);
+    if (oldMac == newMac)
+    {
+        return;
+    }
+    auto [first, last] = m_macIndex.equal_range(oldMac);
+    for (auto i = first; i != last; i++)
     {
-        if ((*i).second == entry)
+        if (i->second == entry)
         {
-            m_ndCache.erase(i);
-            entry->ClearWaitingPacket();
-            delete entry;
+            m_macIndex.erase(i);
+            break;
+        }
+    }
+    m_macIndex.emplace(newMac, entry);
+}
+
+void
+NdiscCache::RemoveFromMacIndex(NdiscCache::Entry* entry)
+{
+    NS_LOG_FUNCTION(this << entry);
+    auto [first, last] = m_macIndex.equal_range(entry->GetMacAddress());
+    for (auto i = first; i != last; i++)
+    {
+        if (i->second == entry)
+        {
+            m_macIndex.erase(i);
             return;
         }
     }
@@ -158,7 +189,8 @@ NdiscCache::Flush()
         delete (*i).second; /* delete the pointer NdiscCache::Entry */
     }
 
-    m_ndCache.erase(m_ndCache.begin(), m_ndCache.end());
+    m_ndCache.clear();
+    m_macIndex.clear();
 }
 
 void
@@ -181,7 +213,9 @@ NdiscCache::PrintNdiscCache(Ptr<OutputStreamWrapper> stream)
     NS_LOG_FUNCTION(this << stream);
     std::ostream* os = stream->GetStream();
 
-    for (auto i = m_ndCache.begin(); i != m_ndCache.end(); i++)
+    // print the entries in the order of their address
+    std::map<Ipv6Address, NdiscCache::Entry*> entries(m_ndCache.begin(), m_ndCache.end());
+    for (auto i = entries.begin(); i != entries.end(); i++)
     {
         *os << i->first << " dev ";
         std::string found = Names::FindName(m_device);
@@ -283,6 +317,14 @@ void
 NdiscCache::Entry::FunctionReachableTimeout()
 {
     NS_LOG_FUNCTION(this);
+    // The reachability may have been confirmed since the timer was started
+    Time left = m_lastReachabilityConfirmation + m_ndCache->m_icmpv6->GetReachableTime() -
+                Simulator::Now();
+    if (m_state == REACHABLE && left.IsStrictlyPositive())
+    {
+        m_nudTimer.Schedule(left);
+        return;
+    }
     this->MarkStale();
 }
 
@@ -477,11 +519,11 @@ NdiscCache::Entry::UpdateReachableTimer()
     if (m_state == REACHABLE)
     {
         m_lastReachabilityConfirmation = Simulator::Now();
-        if (m_nudTimer.IsRunning())
+        // a running timer is postponed when it expires (FunctionReachableTimeout)
+        if (!m_nudTimer.IsRunning())
         {
-            m_nudTimer.Cancel();
+            m_nudTimer.Schedule();
         }
-        m_nudTimer.Schedule();
     }
 }
 
@@ -552,6 +594,7 @@ NdiscCache::Entry::MarkReachable(Address mac)
 {
     NS_LOG_FUNCTION(this << mac);
     m_state = REACHABLE;
+    m_ndCache->UpdateMacIndex(this, m_macAddress, mac);
     m_macAddress = mac;
     return m_waiting;
 }
@@ -582,6 +625,7 @@ NdiscCache::Entry::MarkStale(Address mac)
 {
     NS_LOG_FUNCTION(this << mac);
     m_state = STALE;
+    m_ndCache->UpdateMacIndex(this, m_macAddress, mac);
     m_macAddress = mac;
     return m_waiting;
 }
@@ -669,6 +713,7 @@ void
 NdiscCache::Entry::SetMacAddress(Address mac)
 {
     NS_LOG_FUNCTION(this << mac << int(m_state));
+    m_ndCache->UpdateMacIndex(this, m_macAddress, mac);
     m_macAddress = mac;
 }
 
@@ -711,8 +756,9 @@ NdiscCache::RemoveAutoGeneratedEntries()
         if (i->second->IsAutoGenerated())
         {
             i->second->ClearWaitingPacket();
+            RemoveFromMacIndex(i->second);
             delete i->second;
-            m_ndCache.erase(i++);
+            i = m_ndCache.erase(i);
             continue;
         }
         i++;
@@ -20,6 +20,7 @@
 #include <list>
 #include <map>
 #include <stdint.h>
+#include <unordered_map>
 
 namespace ns3
 {
@@ -324,6 +325,9 @@ class NdiscCache : public Object
 
         /**
          * \brief Update the reachable timer.
+         *
+         * The running timer is not rescheduled: it is postponed when it expires, if the
+         * reachability has been confirmed in the meantime.
          */
         void UpdateReachableTimer();
 
@@ -446,11 +450,11 @@ class NdiscCache : public Object
     /**
      * \brief Neighbor Discovery Cache container
      */
-    typedef std::map<Ipv6Address, NdiscCache::Entry*> Cache;
+    typedef std::unordered_map<Ipv6Address, NdiscCache::Entry*, Ipv6AddressHash> Cache;
     /**
      * \brief Neighbor Discovery Cache container iterator
      */
-    typedef std::map<Ipv6Address, NdiscCache::Entry*>::iterator CacheI;
+    typedef Cache::iterator CacheI;
 
     /**
      * \brief A list of Entry.
@@ -458,6 +462,25 @@ class NdiscCache : public Object
     Cache m_ndCache;
 
   private:
+    /**
+     * \brief Update the index of the entries by MAC address.
+     * \param entry the entry
+     * \param oldMac the previous MAC address of the entry
+     * \param newMac the new MAC address of the entry
+     */
+    void UpdateMacIndex(NdiscCache::Entry* entry, const Address& oldMac, const Address& newMac);
+
+    /**
+     * \brief Remove an entry from the index by MAC address.
+     * \param entry the entry
+     */
+    void RemoveFromMacIndex(NdiscCache::Entry* entry);
+
+    /**
+     * \brief The entries indexed by MAC address.
+     */
+    std::multimap<Address, NdiscCache::Entry*> m_macIndex;
+
     /**
      * \brief The NetDevice.
      */
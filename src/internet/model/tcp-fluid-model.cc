@@ -0,0 +1,448 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "tcp-fluid-model.h"
+
+#include "ipv4-route.h"
+#include "ipv4-routing-protocol.h"
+#include "ipv4.h"
+#include "tcp-cubic.h"
+
+#include "ns3/abort.h"
+#include "ns3/channel.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/packet.h"
+#include "ns3/simulator.h"
+#include "ns3/trace-source-accessor.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("TcpFluidModel");
+
+NS_OBJECT_ENSURE_REGISTERED(TcpFluidFlow);
+NS_OBJECT_ENSURE_REGISTERED(TcpFluidModel);
+
+TypeId
+TcpFluidFlow::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::TcpFluidFlow")
+            .SetParent<Object>()
+            .SetGroupName("Internet")
+            .AddConstructor<TcpFluidFlow>()
+            .AddAttribute("CongestionControl",
+                          "Congestion control of the flow.",
+                          TypeIdValue(TcpCubic::GetTypeId()),
+                          MakeTypeIdAccessor(&TcpFluidFlow::m_congestionTypeId),
+                          MakeTypeIdChecker())
+            .AddAttribute("SegmentSize",
+                          "TCP maximum segment size in bytes",
+                          UintegerValue(1448),
+                          MakeUintegerAccessor(&TcpFluidFlow::m_segmentSize),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("InitialCwnd",
+                          "TCP initial congestion window size (segments)",
+                          UintegerValue(10),
+                          MakeUintegerAccessor(&TcpFluidFlow::m_initialCwnd),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("Rtt",
+                          "Round-trip time of the flow",
+                          TimeValue(MilliSeconds(100)),
+                          MakeTimeAccessor(&TcpFluidFlow::m_rtt),
+                          MakeTimeChecker(NanoSeconds(1)))
+            .AddTraceSource("CongestionWindow",
+                            "The TCP connection's congestion window",
+                            MakeTraceSourceAccessor(&TcpFluidFlow::m_cWnd),
+                            "ns3::TracedValueCallback::Uint32")
+            .AddTraceSource("Rate",
+                            "The rate of the flow during the last update interval",
+                            MakeTraceSourceAccessor(&TcpFluidFlow::m_rate),
+                            "ns3::TracedValueCallback::DataRate");
+    return tid;
+}
+
+TcpFluidFlow::TcpFluidFlow()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+TcpFluidFlow::~TcpFluidFlow()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+TcpFluidFlow::DoInitialize()
+{
+    NS_LOG_FUNCTION(this);
+
+    ObjectFactory congestionFactory;
+    congestionFactory.SetTypeId(m_congestionTypeId);
+    m_congestion = congestionFactory.Create<TcpCongestionOps>();
+    NS_ABORT_MSG_IF(m_congestion->HasCongControl(),
+                    m_congestion->GetName() << " is not supported by fluid flows");
+
+    m_tcb = CreateObject<TcpSocketState>();
+    m_tcb->TraceConnectWithoutContext("CongestionWindow",
+                                      MakeCallback(&TcpFluidFlow::UpdateCwnd, this));
+    m_tcb->m_segmentSize = m_segmentSize;
+    m_tcb->m_initialCWnd = m_initialCwnd;
+    m_tcb->m_initialSsThresh = std::numeric_limits<uint32_t>::max();
+    m_tcb->m_ssThresh = m_tcb->m_initialSsThresh;
+    m_tcb->m_cWnd = m_initialCwnd * m_segmentSize;
+    m_tcb->m_cWndInfl = m_tcb->m_cWnd;
+    m_tcb->m_bytesInFlight = m_tcb->m_cWnd;
+    m_tcb->m_highTxMark = m_tcb->m_lastAckedSeq + m_tcb->m_cWnd;
+    m_tcb->m_isCwndLimited = true;
+    m_tcb->m_minRtt = m_rtt;
+    m_tcb->m_srtt = m_rtt;
+    m_tcb->m_lastRtt = m_rtt;
+    m_congestion->Init(m_tcb);
+
+    Object::DoInitialize();
+}
+
+void
+TcpFluidFlow::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_path.clear();
+    m_tcb = nullptr;
+    m_congestion = nullptr;
+    Object::DoDispose();
+}
+
+void
+TcpFluidFlow::UpdateCwnd(uint32_t oldValue [[maybe_unused]], uint32_t newValue)
+{
+    m_cWnd = newValue;
+}
+
+void
+TcpFluidFlow::SetPath(const std::vector<Ptr<NetDevice>>& path)
+{
+    m_path = path;
+}
+
+const std::vector<Ptr<NetDevice>>&
+TcpFluidFlow::GetPath() const
+{
+    return m_path;
+}
+
+uint32_t
+TcpFluidFlow::GetCongestionWindow() const
+{
+    return m_cWnd;
+}
+
+DataRate
+TcpFluidFlow::GetDemand() const
+{
+    return DataRate(static_cast<uint64_t>(m_cWnd * 8.0 / m_rtt.GetSeconds()));
+}
+
+DataRate
+TcpFluidFlow::GetRate() const
+{
+    return m_rate;
+}
+
+uint64_t
+TcpFluidFlow::GetTotalBytes() const
+{
+    return m_totalBytes;
+}
+
+uint32_t
+TcpFluidFlow::GetNLossEvents() const
+{
+    return m_lossEvents;
+}
+
+void
+TcpFluidFlow::Update(DataRate rate, bool congested, Time interval)
+{
+    NS_LOG_FUNCTION(this << rate << congested << interval);
+    NS_ASSERT_MSG(m_tcb, "The flow has not been initialized");
+
+    m_rate = rate;
+    double bytes = rate.GetBitRate() * interval.GetSeconds() / 8 + m_pendingBytes;
+    auto segments = static_cast<uint32_t>(bytes / m_segmentSize);
+    m_pendingBytes = bytes - static_cast<double>(segments) * m_segmentSize;
+    m_totalBytes += static_cast<uint64_t>(segments) * m_segmentSize;
+    m_tcb->m_lastAckedSeq += segments * m_segmentSize;
+
+    if (m_tcb->m_congState == TcpSocketState::CA_RECOVERY)
+    {
+        if (Simulator::Now() < m_recoveryEnd)
+        {
+            // The window does not change during the recovery
+            return;
+        }
+        m_congestion->CongestionStateSet(m_tcb, TcpSocketState::CA_OPEN);
+        m_tcb->m_congState = TcpSocketState::CA_OPEN;
+    }
+
+    m_tcb->m_bytesInFlight = m_tcb->m_cWnd;
+    if (congested)
+    {
+        m_congestion->CongestionStateSet(m_tcb, TcpSocketState::CA_RECOVERY);
+        m_tcb->m_congState = TcpSocketState::CA_RECOVERY;
+        m_tcb->m_ssThresh = m_congestion->GetSsThresh(m_tcb, m_tcb->m_bytesInFlight);
+        m_tcb->m_cWnd = m_tcb->m_ssThresh;
+        m_tcb->m_cWndInfl = m_tcb->m_cWnd;
+        m_recoveryEnd = Simulator::Now() + m_rtt;
+        ++m_lossEvents;
+        NS_LOG_DEBUG("Loss event, cwnd " << m_tcb->m_cWnd << " ssthresh " << m_tcb->m_ssThresh);
+    }
+    else if (segments > 0)
+    {
+        m_congestion->PktsAcked(m_tcb, segments, m_rtt);
+        for (uint32_t i = 0; i < segments; ++i)
+        {
+            m_congestion->IncreaseWindow(m_tcb, 1);
+        }
+        m_tcb->m_cWndInfl = m_tcb->m_cWnd;
+    }
+    m_tcb->m_highTxMark = m_tcb->m_lastAckedSeq + m_tcb->m_cWnd;
+}
+
+TypeId
+TcpFluidModel::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::TcpFluidModel")
+                            .SetParent<Object>()
+                            .SetGroupName("Internet")
+                            .AddConstructor<TcpFluidModel>()
+                            .AddAttribute("Interval",
+                                          "Interval between the updates of the flows",
+                                          TimeValue(MilliSeconds(10)),
+                                          MakeTimeAccessor(&TcpFluidModel::m_interval),
+                                          MakeTimeChecker(NanoSeconds(1)))
+                            .AddAttribute("MaxLinkShare",
+                                          "Maximum fraction of the capacity of a link "
+                                          "that the flows can use",
+                                          DoubleValue(0.95),
+                                          MakeDoubleAccessor(&TcpFluidModel::m_maxLinkShare),
+                                          MakeDoubleChecker<double>(0, 1));
+    return tid;
+}
+
+TcpFluidModel::TcpFluidModel()
+{
+    NS_LOG_FUNCTION(this);
+    m_flowFactory.SetTypeId(TcpFluidFlow::GetTypeId());
+}
+
+TcpFluidModel::~TcpFluidModel()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+TcpFluidModel::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_updateEvent.Cancel();
+    m_stopEvent.Cancel();
+    for (auto& flow : m_flows)
+    {
+        flow->Dispose();
+    }
+    m_flows.clear();
+    m_paths.clear();
+    m_links.clear();
+    m_linkIndex.clear();
+    Object::DoDispose();
+}
+
+void
+TcpFluidModel::SetFlowAttribute(const std::string& name, const AttributeValue& value)
+{
+    m_flowFactory.Set(name, value);
+}
+
+std::size_t
+TcpFluidModel::GetLinkIndex(Ptr<NetDevice> device)
+{
+    auto [it, inserted] = m_linkIndex.emplace(device, m_links.size());
+    if (inserted)
+    {
+        m_links.push_back({device});
+        bool connected = device->TraceConnectWithoutContext(
+            "PhyTxEnd",
+            MakeCallback(&TcpFluidModel::NotifyPhyTxEnd, this).Bind(it->second));
+        NS_ABORT_MSG_UNLESS(connected, "The device has no PhyTxEnd trace source");
+    }
+    return it->second;
+}
+
+Ptr<TcpFluidFlow>
+TcpFluidModel::AddFlow(const std::vector<Ptr<NetDevice>>& path)
+{
+    NS_LOG_FUNCTION(this << path.size());
+    NS_ABORT_MSG_IF(path.empty(), "The path of the flow is empty");
+
+    auto flow = m_flowFactory.Create<TcpFluidFlow>();
+    flow->SetPath(path);
+    flow->Initialize();
+
+    std::vector<std::size_t> links;
+    for (const auto& device : path)
+    {
+        links.push_back(GetLinkIndex(device));
+    }
+    m_flows.push_back(flow);
+    m_paths.push_back(std::move(links));
+    return flow;
+}
+
+Ptr<TcpFluidFlow>
+TcpFluidModel::AddFlow(Ptr<Node> source, Ipv4Address destination)
+{
+    NS_LOG_FUNCTION(this << source << destination);
+
+    std::vector<Ptr<NetDevice>> path;
+    auto node = source;
+    // Walk the routes, up to the maximum number of hops of an IPv4 packet
+    for (uint32_t hop = 0; hop < 256; ++hop)
+    {
+        auto ipv4 = node->GetObject<Ipv4>();
+        NS_ABORT_MSG_UNLESS(ipv4, "Node " << node->GetId() << " has no IPv4 stack");
+        if (ipv4->GetInterfaceForAddress(destination) >= 0)
+        {
+            return AddFlow(path);
+        }
+
+        Ipv4Header header;
+        header.SetDestination(destination);
+        Socket::SocketErrno sockerr;
+        auto route =
+            ipv4->GetRoutingProtocol()->RouteOutput(Create<Packet>(), header, nullptr, sockerr);
+        NS_ABORT_MSG_UNLESS(route,
+                            "No route to " << destination << " from node " << node->GetId());
+
+        auto device = route->GetOutputDevice();
+        auto channel = device->GetChannel();
+        NS_ABORT_MSG_UNLESS(channel && channel->GetNDevices() == 2,
+                            "The link of device " << device->GetIfIndex() << " of node "
+                                                  << node->GetId()
+                                                  << " does not connect two devices");
+        path.push_back(device);
+        auto peer = channel->GetDevice(0) == device ? channel->GetDevice(1) : channel->GetDevice(0);
+        node = peer->GetNode();
+    }
+    NS_FATAL_ERROR("Routing loop from node " << source->GetId() << " to " << destination);
+    return nullptr;
+}
+
+std::size_t
+TcpFluidModel::GetNFlows() const
+{
+    return m_flows.size();
+}
+
+Ptr<TcpFluidFlow>
+TcpFluidModel::GetFlow(std::size_t i) const
+{
+    return m_flows.at(i);
+}
+
+void
+TcpFluidModel::Start(Time start)
+{
+    NS_LOG_FUNCTION(this << start);
+    m_updateEvent.Cancel();
+    m_updateEvent = Simulator::Schedule(start, &TcpFluidModel::Update, this);
+}
+
+void
+TcpFluidModel::Stop(Time stop)
+{
+    NS_LOG_FUNCTION(this << stop);
+    m_stopEvent.Cancel();
+    m_stopEvent = Simulator::Schedule(stop, &TcpFluidModel::DoStop, this);
+}
+
+void
+TcpFluidModel::DoStop()
+{
+    NS_LOG_FUNCTION(this);
+    m_updateEvent.Cancel();
+    for (auto& link : m_links)
+    {
+        link.rate = 0;
+        link.device->SetAttribute("BackgroundDataRate", DataRateValue(DataRate(0)));
+    }
+}
+
+void
+TcpFluidModel::NotifyPhyTxEnd(std::size_t link, Ptr<const Packet> packet)
+{
+    m_links[link].foregroundBytes += packet->GetSize();
+}
+
+void
+TcpFluidModel::Update()
+{
+    NS_LOG_FUNCTION(this);
+
+    // The capacity left to the flows on each link
+    std::vector<double> demands(m_flows.size());
+    for (auto& link : m_links)
+    {
+        link.demand = 0;
+        link.rate = 0;
+    }
+    for (std::size_t i = 0; i < m_flows.size(); ++i)
+    {
+        demands[i] = m_flows[i]->GetDemand().GetBitRate();
+        for (auto link : m_paths[i])
+        {
+            m_links[link].demand += demands[i];
+        }
+    }
+    for (auto& link : m_links)
+    {
+        DataRateValue capacity;
+        link.device->GetAttribute("DataRate", capacity);
+        double foreground = link.foregroundBytes * 8 / m_interval.GetSeconds();
+        double available =
+            std::max(0.0, m_maxLinkShare * capacity.Get().GetBitRate() - foreground);
+        link.factor = link.demand > available ? available / link.demand : 1;
+        link.foregroundBytes = 0;
+    }
+
+    // The flows crossing a congested link get a share proportional to their demand
+    for (std::size_t i = 0; i < m_flows.size(); ++i)
+    {
+        double factor = 1;
+        for (auto link : m_paths[i])
+        {
+            factor = std::min(factor, m_links[link].factor);
+        }
+        double rate = demands[i] * factor;
+        m_flows[i]->Update(DataRate(static_cast<uint64_t>(rate)), factor < 1, m_interval);
+        for (auto link : m_paths[i])
+        {
+            m_links[link].rate += rate;
+        }
+    }
+
+    for (auto& link : m_links)
+    {
+        link.device->SetAttribute("BackgroundDataRate",
+                                  DataRateValue(DataRate(static_cast<uint64_t>(link.rate))));
+    }
+    m_updateEvent = Simulator::Schedule(m_interval, &TcpFluidModel::Update, this);
+}
+
+} // namespace ns3
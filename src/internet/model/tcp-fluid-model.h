@@ -0,0 +1,261 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef TCP_FLUID_MODEL_H
+#define TCP_FLUID_MODEL_H
+
+#include "tcp-congestion-ops.h"
+#include "tcp-socket-state.h"
+
+#include "ns3/data-rate.h"
+#include "ns3/event-id.h"
+#include "ns3/ipv4-address.h"
+#include "ns3/net-device.h"
+#include "ns3/node.h"
+#include "ns3/nstime.h"
+#include "ns3/object-factory.h"
+#include "ns3/object.h"
+#include "ns3/traced-value.h"
+
+#include <map>
+#include <vector>
+
+namespace ns3
+{
+
+class Packet;
+
+/**
+ * \ingroup tcp
+ *
+ * \brief A bulk TCP flow modeled as a fluid rate process.
+ *
+ * The flow does not send packets: it has a congestion window, driven by a
+ * TcpCongestionOps instance as in TcpSocketBase, and sends at the rate of one
+ * congestion window per round-trip time, within the capacity left on its
+ * path. The flows are created and updated by a TcpFluidModel, which computes
+ * the rate of every flow and the loss events at each update interval.
+ *
+ * The round-trip time of the flow is fixed (attribute Rtt): the queuing delay
+ * is not modeled. Congestion control algorithms which replace the window
+ * based congestion control (TcpCongestionOps::HasCongControl) are not
+ * supported.
+ */
+class TcpFluidFlow : public Object
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    TcpFluidFlow();
+    ~TcpFluidFlow() override;
+
+    /**
+     * \brief Set the path of the flow.
+     * \param path the devices transmitting the flow, from the source to the destination
+     */
+    void SetPath(const std::vector<Ptr<NetDevice>>& path);
+
+    /**
+     * \return the devices transmitting the flow, from the source to the destination
+     */
+    const std::vector<Ptr<NetDevice>>& GetPath() const;
+
+    /**
+     * \return the congestion window (in bytes)
+     */
+    uint32_t GetCongestionWindow() const;
+
+    /**
+     * \return the rate at which the flow would send, i.e., one congestion window per
+     *         round-trip time
+     */
+    DataRate GetDemand() const;
+
+    /**
+     * \return the rate of the flow during the last update interval
+     */
+    DataRate GetRate() const;
+
+    /**
+     * \return the number of bytes delivered by the flow
+     */
+    uint64_t GetTotalBytes() const;
+
+    /**
+     * \return the number of loss events of the flow
+     */
+    uint32_t GetNLossEvents() const;
+
+    /**
+     * \brief Advance the flow by one update interval.
+     *
+     * The segments delivered during the interval are acknowledged to the
+     * congestion control (one at a time, as without delayed ACKs), unless the
+     * flow has been congested: the flow then enters the recovery for one
+     * round-trip time, with the slow start threshold and congestion window
+     * given by the congestion control.
+     *
+     * \param rate the rate of the flow during the interval
+     * \param congested whether a link of the path was congested during the interval
+     * \param interval the duration of the interval
+     */
+    void Update(DataRate rate, bool congested, Time interval);
+
+  protected:
+    void DoInitialize() override;
+    void DoDispose() override;
+
+  private:
+    /**
+     * \brief Callback of the congestion window of the socket state.
+     * \param oldValue the old value
+     * \param newValue the new value
+     */
+    void UpdateCwnd(uint32_t oldValue, uint32_t newValue);
+
+    TypeId m_congestionTypeId;          //!< Congestion control type
+    uint32_t m_segmentSize;             //!< Segment size
+    uint32_t m_initialCwnd;             //!< Initial congestion window (in segments)
+    Time m_rtt;                         //!< Round-trip time
+    std::vector<Ptr<NetDevice>> m_path; //!< Devices transmitting the flow
+    Ptr<TcpSocketState> m_tcb;          //!< Congestion control state
+    Ptr<TcpCongestionOps> m_congestion; //!< Congestion control
+    Time m_recoveryEnd;                 //!< End of the current recovery
+    double m_pendingBytes{0};           //!< Bytes sent but not yet acknowledged as segment
+    uint64_t m_totalBytes{0};           //!< Bytes delivered
+    uint32_t m_lossEvents{0};           //!< Number of loss events
+    TracedValue<uint32_t> m_cWnd{0};    //!< Congestion window
+    TracedValue<DataRate> m_rate;       //!< Rate during the last update interval
+};
+
+/**
+ * \ingroup tcp
+ *
+ * \brief Fluid model of background TCP flows sharing the links with packet-level traffic.
+ *
+ * The model updates its flows periodically (attribute Interval). At each update, the
+ * flows crossing a link share the capacity of the link which is left by the packets
+ * transmitted during the previous interval, up to a fraction of the link capacity
+ * (attribute MaxLinkShare). When the flows crossing a link ask for more, the rates of all
+ * of them are scaled down and they experience a loss event. The sum of the rates of the
+ * flows crossing a link is then set as the BackgroundDataRate attribute of the device,
+ * which transmits the packets at the remaining data rate.
+ *
+ * Hence, the background flows cost a few operations per update interval rather than a
+ * few events per segment, while they compete for the links with the packet-level flows.
+ *
+ * The devices of the paths must have the DataRate and BackgroundDataRate attributes and
+ * the PhyTxEnd trace source (e.g., PointToPointNetDevice and SimpleNetDevice).
+ */
+class TcpFluidModel : public Object
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    TcpFluidModel();
+    ~TcpFluidModel() override;
+
+    /**
+     * \brief Set an attribute of the flows created afterwards.
+     * \param name the name of the attribute
+     * \param value the value of the attribute
+     */
+    void SetFlowAttribute(const std::string& name, const AttributeValue& value);
+
+    /**
+     * \brief Add a flow.
+     * \param path the devices transmitting the flow, from the source to the destination
+     * \return the flow
+     */
+    Ptr<TcpFluidFlow> AddFlow(const std::vector<Ptr<NetDevice>>& path);
+
+    /**
+     * \brief Add a flow following the IPv4 routes from a node to a destination.
+     *
+     * The links of the path must connect exactly two devices.
+     *
+     * \param source the source node
+     * \param destination the destination address
+     * \return the flow
+     */
+    Ptr<TcpFluidFlow> AddFlow(Ptr<Node> source, Ipv4Address destination);
+
+    /**
+     * \return the number of flows
+     */
+    std::size_t GetNFlows() const;
+
+    /**
+     * \param i the index of the flow
+     * \return the i-th flow
+     */
+    Ptr<TcpFluidFlow> GetFlow(std::size_t i) const;
+
+    /**
+     * \brief Start updating the flows.
+     * \param start the delay before the first update
+     */
+    void Start(Time start);
+
+    /**
+     * \brief Stop the flows, and release the capacity they use.
+     * \param stop the delay before stopping
+     */
+    void Stop(Time stop);
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    /// A link crossed by flows
+    struct Link
+    {
+        Ptr<NetDevice> device;       //!< Device transmitting on the link
+        uint64_t foregroundBytes{0}; //!< Bytes of packets transmitted since the last update
+        double demand{0};            //!< Sum of the demands of the flows (bit/s)
+        double factor{1};            //!< Fraction of their demand granted to the flows
+        double rate{0};              //!< Sum of the rates of the flows (bit/s)
+    };
+
+    /**
+     * \param device the device
+     * \return the index of the link of the device, added if needed
+     */
+    std::size_t GetLinkIndex(Ptr<NetDevice> device);
+
+    /**
+     * \brief Count a packet transmitted on a link.
+     * \param link the index of the link
+     * \param packet the packet
+     */
+    void NotifyPhyTxEnd(std::size_t link, Ptr<const Packet> packet);
+
+    /// Update the rates and the congestion windows of the flows
+    void Update();
+
+    /// Stop updating the flows
+    void DoStop();
+
+    Time m_interval;                                   //!< Update interval
+    double m_maxLinkShare;                             //!< Max share of a link used by the flows
+    ObjectFactory m_flowFactory;                       //!< Factory of the flows
+    std::vector<Ptr<TcpFluidFlow>> m_flows;            //!< Flows
+    std::vector<std::vector<std::size_t>> m_paths;     //!< Links of each flow
+    std::vector<Link> m_links;                         //!< Links crossed by the flows
+    std::map<Ptr<NetDevice>, std::size_t> m_linkIndex; //!< Index of the link of each device
+    EventId m_updateEvent;                             //!< Next update
+    EventId m_stopEvent;                               //!< Stop event
+};
+
+} // namespace ns3
+
+#endif /* TCP_FLUID_MODEL_H */
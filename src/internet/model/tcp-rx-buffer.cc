@@ -11,6 +11,9 @@
 #include "ns3/log.h"
 #include "ns3/packet.h"
 
+#include <algorithm>
+#include <iterator>
+
 namespace ns3
 {
 
@@ -160,8 +163,14 @@ TcpRxBuffer::Add(Ptr<Packet> p, const TcpHeader& tcph)
             headSeq = tailSeq;
         }
     }
-    // Remove overlapped bytes from packet
-    auto i = m_data.begin();
+    // Remove overlapped bytes from packet. The packets are contiguous or
+    // disjoint, hence only the last one starting at or before headSeq and the
+    // following ones can overlap the new packet
+    auto i = m_data.upper_bound(headSeq);
+    if (i != m_data.begin())
+    {
+        --i;
+    }
     while (i != m_data.end() && i->first <= tailSeq)
     {
         SequenceNumber32 lastByteSeq = i->first + SequenceNumber32(i->second->GetSize());
@@ -200,28 +209,23 @@ TcpRxBuffer::Add(Ptr<Packet> p, const TcpHeader& tcph)
     // Insert packet into buffer
     NS_ASSERT(m_data.find(headSeq) == m_data.end()); // Shouldn't be there yet
     m_data[headSeq] = p;
+    TcpOptionSack::SackBlock block = AddBlock(headSeq, tailSeq);
 
     if (headSeq > m_nextRxSeq)
     {
         // Generate a new SACK block
-        UpdateSackList(headSeq, tailSeq);
+        UpdateSackList(block.first, block.second);
     }
 
     NS_LOG_LOGIC("Buffered packet of seqno=" << headSeq << " len=" << p->GetSize());
     // Update variables
     m_size += p->GetSize(); // Occupancy
-    for (i = m_data.begin(); i != m_data.end(); ++i)
+    if (block.first == m_nextRxSeq)
     {
-        if (i->first < m_nextRxSeq)
-        {
-            continue;
-        }
-        else if (i->first > m_nextRxSeq)
-        {
-            break;
-        };
-        m_nextRxSeq = i->first + SequenceNumber32(i->second->GetSize());
-        m_availBytes += i->second->GetSize();
+        // The whole block of contiguous data is now in order
+        m_blocks.erase(block.first);
+        m_availBytes += static_cast<uint32_t>(block.second - block.first);
+        m_nextRxSeq = block.second;
         ClearSackList(m_nextRxSeq);
     }
     NS_LOG_LOGIC("Updated buffer occupancy=" << m_size << " nextRxSeq=" << m_nextRxSeq);
@@ -232,6 +236,29 @@ TcpRxBuffer::Add(Ptr<Packet> p, const TcpHeader& tcph)
     return true;
 }
 
+TcpOptionSack::SackBlock
+TcpRxBuffer::AddBlock(const SequenceNumber32& head, const SequenceNumber32& tail)
+{
+    NS_LOG_FUNCTION(this << head << tail);
+
+    TcpOptionSack::SackBlock block(head, tail);
+
+    // Merge the blocks overlapping or adjacent to the new data
+    auto it = m_blocks.upper_bound(head);
+    if (it != m_blocks.begin() && std::prev(it)->second >= head)
+    {
+        --it;
+    }
+    while (it != m_blocks.end() && it->first <= tail)
+    {
+        block.first = std::min(block.first, it->first);
+        block.second = std::max(block.second, it->second);
+        it = m_blocks.erase(it);
+    }
+    m_blocks.emplace(block.first, block.second);
+    return block;
+}
+
 uint32_t
 TcpRxBuffer::GetSackListSize() const
 {
@@ -276,54 +303,15 @@ TcpRxBuffer::UpdateSackList(const SequenceNumber32& head, const SequenceNumber32
     //     following SACK blocks in the SACK option may be listed in
     //     arbitrary order.
 
+    // The block "current" is the whole block of contiguous data containing the
+    // new segment (see AddBlock), so the blocks previously reported which were
+    // merged with the new segment are subsets of it: remove them, and insert
+    // the block at the beginning.
+    m_sackList.remove_if([&current](const TcpOptionSack::SackBlock& block) {
+        return current.first <= block.first && block.second <= current.second;
+    });
     m_sackList.push_front(current);
 
-    // We have inserted the block at the beginning of the list. Now, we should
-    // check if any existing blocks overlap with that.
-    bool updated = false;
-    auto it = m_sackList.begin();
-    TcpOptionSack::SackBlock begin = *it;
-    TcpOptionSack::SackBlock merged;
-    ++it;
-
-    // Iterates until we examined all blocks in the list (maximum 4)
-    while (it != m_sackList.end())
-    {
-        current = *it;
-
-        // This is a left merge:
-        // [current_first; current_second] [beg_first; beg_second]
-        if (begin.first == current.second)
-        {
-            NS_ASSERT(current.first < begin.second);
-            merged = TcpOptionSack::SackBlock(current.first, begin.second);
-            updated = true;
-        }
-        // while this is a right merge
-        // [begin_first; begin_second] [current_first; current_second]
-        else if (begin.second == current.first)
-        {
-            NS_ASSERT(begin.first < current.second);
-            merged = TcpOptionSack::SackBlock(begin.first, current.second);
-            updated = true;
-        }
-
-        // If we have merged the blocks (and the result is in merged) we should
-        // delete the current block (it), the first block, and insert the merged
-        // one at the beginning.
-        if (updated)
-        {
-            m_sackList.erase(it);
-            m_sackList.pop_front();
-            m_sackList.push_front(merged);
-            it = m_sackList.begin();
-            begin = *it;
-            updated = false;
-        }
-
-        ++it;
-    }
-
     // Since the maximum blocks that fits into a TCP header are 4, there's no
     // point on maintaining the others.
     if (m_sackList.size() > 4)
@@ -332,9 +320,8 @@ TcpRxBuffer::UpdateSackList(const SequenceNumber32& head, const SequenceNumber32
     }
 
     // Please note that, if a block b is discarded and then a block contiguous
-    // to b is received, only that new block (without the b part) is reported.
-    // This is perfectly fine for the RFC point (a), given that we do not report any
-    // overlapping blocks shortly after.
+    // to b is received, the reported block includes b, because it is built from
+    // the blocks of data stored in the buffer rather than from the SACK list.
 }
 
 void
@@ -58,6 +58,11 @@ class Packet;
  * For more information about the SACK list, please check the documentation of
  * the method GetSackList.
  *
+ * The buffer keeps an index of the blocks of contiguous data received out of
+ * order. Adding a segment only looks at the stored segments it may overlap,
+ * and the SACK block reporting it is the block of contiguous data which
+ * contains it, so the cost does not grow with the number of holes.
+ *
  * \see GetSackList
  * \see UpdateSackList
  */
@@ -196,6 +201,17 @@ class TcpRxBuffer : public Object
      */
     void UpdateSackList(const SequenceNumber32& head, const SequenceNumber32& tail);
 
+    /**
+     * \brief Add new data to the blocks of contiguous data
+     *
+     * The new data is merged with the blocks it overlaps or is adjacent to.
+     *
+     * \param head sequence number of the first byte of the new data
+     * \param tail sequence number following the last byte of the new data
+     * \return the block of contiguous data containing the new data
+     */
+    TcpOptionSack::SackBlock AddBlock(const SequenceNumber32& head, const SequenceNumber32& tail);
+
     /**
      * \brief Remove old blocks from the sack list
      *
@@ -221,6 +237,8 @@ class TcpRxBuffer : public Object
     uint32_t m_maxBuffer;  //!< Upper bound of the number of data bytes in buffer (RCV.WND)
     uint32_t m_availBytes; //!< Number of bytes available to read, i.e. contiguous block at head
     std::map<SequenceNumber32, Ptr<Packet>> m_data; //!< Corresponding data (may be null)
+    /// Blocks of contiguous data not yet in order (end of each block by start sequence number)
+    std::map<SequenceNumber32, SequenceNumber32> m_blocks;
 };
 
 } // namespace ns3
@@ -49,6 +49,7 @@
 #include "ns3/simulation-singleton.h"
 #include "ns3/simulator.h"
 #include "ns3/trace-source-accessor.h"
+#include "ns3/tso-tag.h"
 #include "ns3/uinteger.h"
 
 #include <algorithm>
@@ -56,6 +57,12 @@
 
 namespace
 {
+/**
+ * \brief Max payload of a packet carrying several segments, which must fit in an IP packet
+ * with the largest IPv4 and TCP headers
+ */
+constexpr uint32_t TSO_MAX_PAYLOAD = 65535 - 60 - 60;
+
 
 /**
  * \brief map TcpPacketType and EcnMode to boolean value to check whether ECN-marking is allowed or
@@ -184,6 +191,13 @@ TcpSocketBase::GetTypeId()
                           BooleanValue(true),
                           MakeBooleanAccessor(&TcpSocketBase::m_limitedTx),
                           MakeBooleanChecker())
+            .AddAttribute("TsoMaxSegments",
+                          "Max number of segments of new data sent as a single packet, whose "
+                          "segments are transmitted back to back by the devices supporting it "
+                          "(segmentation offload). 1 disables segmentation offload",
+                          UintegerValue(1),
+                          MakeUintegerAccessor(&TcpSocketBase::m_tsoMaxSegments),
+                          MakeUintegerChecker<uint32_t>(1))
             .AddAttribute("UseEcn",
                           "Parameter to set ECN functionality",
                           EnumValue(TcpSocketState::Off),
@@ -403,6 +417,7 @@ TcpSocketBase::TcpSocketBase(const TcpSocketBase& sock)
       m_recoverActive(sock.m_recoverActive),
       m_retxThresh(sock.m_retxThresh),
       m_limitedTx(sock.m_limitedTx),
+      m_tsoMaxSegments(sock.m_tsoMaxSegments),
       m_isFirstPartialAck(sock.m_isFirstPartialAck),
       m_txTrace(sock.m_txTrace),
       m_rxTrace(sock.m_rxTrace),
@@ -2251,7 +2266,16 @@ TcpSocketBase::ProcessAck(const SequenceNumber32& ackNumber,
             }
             if (m_tcb->m_congState == TcpSocketState::CA_OPEN)
             {
-                m_congestionControl->IncreaseWindow(m_tcb, segsAcked);
+                // With segmentation offload, the ACKs of the receiver cover many segments:
+                // increase the window as for the ACKs it would send without offload
+                uint32_t segsLeft = segsAcked;
+                while (m_tsoMaxSegments > 1 && segsLeft > m_delAckMaxCount &&
+                       m_delAckMaxCount > 0)
+                {
+                    m_congestionControl->IncreaseWindow(m_tcb, m_delAckMaxCount);
+                    segsLeft -= m_delAckMaxCount;
+                }
+                m_congestionControl->IncreaseWindow(m_tcb, segsLeft);
 
                 m_tcb->m_cWndInfl = m_tcb->m_cWnd;
 
@@ -3243,6 +3267,11 @@ TcpSocketBase::SendDataPacket(SequenceNumber32 seq, uint32_t maxSize, bool withA
 
     bool isEct = IsEct(isRetransmission ? TcpPacketType_t::RE_XMT : TcpPacketType_t::DATA);
     AddSocketTags(p, isEct);
+    if (sz > m_tcb->m_segmentSize)
+    {
+        // The packet carries several segments (segmentation offload)
+        p->AddPacketTag(TsoTag(sz, m_tcb->m_segmentSize));
+    }
 
     if (m_closeOnEmpty && (remainingData == 0))
     {
@@ -3470,6 +3499,20 @@ TcpSocketBase::SendPendingData(bool withAck)
             auto maxSizeToSend = static_cast<uint32_t>(nextHigh - next);
             s = std::min(s, maxSizeToSend);
 
+            // Segmentation offload: send several segments of previously unsent data
+            // as a single packet, within the congestion and receiver windows
+            if (m_tsoMaxSegments > 1 && s == m_tcb->m_segmentSize &&
+                next >= m_tcb->m_highTxMark.Get())
+            {
+                auto rWndLeft = static_cast<uint32_t>(
+                    (m_highRxAckMark.Get() + SequenceNumber32(m_rWnd.Get())) - next);
+                uint32_t tsoSize = std::min({availableWindow,
+                                             rWndLeft,
+                                             m_tsoMaxSegments * m_tcb->m_segmentSize,
+                                             TSO_MAX_PAYLOAD});
+                s = std::max(s, tsoSize - tsoSize % m_tcb->m_segmentSize);
+            }
+
             // (C.2) If any of the data octets sent in (C.1) are below HighData,
             //       HighRxt MUST be set to the highest sequence number of the
             //       retransmitted segment unless NextSeg () rule (4) was
@@ -3623,6 +3666,14 @@ TcpSocketBase::ReceivedData(Ptr<Packet> p, const TcpHeader& tcpHeader)
     NS_LOG_DEBUG("Data segment, seq=" << tcpHeader.GetSequenceNumber()
                                       << " pkt size=" << p->GetSize());
 
+    // A packet carrying several segments counts as its segments for the delayed ACKs
+    uint32_t nSegments = 1;
+    TsoTag tsoTag;
+    if (p->RemovePacketTag(tsoTag))
+    {
+        nSegments = tsoTag.GetNSegments();
+    }
+
     // Put into Rx buffer
     SequenceNumber32 expectedSeq = m_tcb->m_rxBuffer->NextRxSequence();
     if (!m_tcb->m_rxBuffer->Add(p, tcpHeader))
@@ -3679,7 +3730,8 @@ TcpSocketBase::ReceivedData(Ptr<Packet> p, const TcpHeader& tcpHeader)
     }
     else
     { // In-sequence packet: ACK if delayed ack count allows
-        if (++m_delAckCount >= m_delAckMaxCount)
+        m_delAckCount += nSegments;
+        if (m_delAckCount >= m_delAckMaxCount)
         {
             m_delAckEvent.Cancel();
             m_delAckCount = 0;
@@ -1429,6 +1429,9 @@ class TcpSocketBase : public TcpSocket
     uint32_t m_retxThresh{3};    //!< Fast Retransmit threshold
     bool m_limitedTx{true};      //!< perform limited transmit
 
+    // Segmentation offload
+    uint32_t m_tsoMaxSegments{1}; //!< Max number of segments of new data sent as a single packet
+
     // Transmission Control Block
     Ptr<TcpSocketState> m_tcb;                 //!< Congestion control information
     Ptr<TcpCongestionOps> m_congestionControl; //!< Congestion control
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <optional>
 
 namespace ns3
 {
@@ -50,7 +51,9 @@ TcpTxBuffer::TcpTxBuffer(uint32_t n)
     : m_maxBuffer(32768),
       m_size(0),
       m_sentSize(0),
-      m_firstByteSeq(n)
+      m_firstByteSeq(n),
+      m_lostFrontier(n),
+      m_nextSegHint(n)
 {
     m_rWndCallback = MakeNullCallback<uint32_t>();
 }
@@ -164,7 +167,9 @@ TcpTxBuffer::SetHeadSequence(const SequenceNumber32& seq)
     // if you change the head with data already sent, something bad will happen
     NS_ASSERT(m_sentList.empty());
     m_sackSeen = false;
-    m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
+    m_highestSack = SequenceNumber32(0);
+    m_lostFrontier = seq;
+    m_nextSegHint = seq;
 }
 
 bool
@@ -299,37 +304,33 @@ TcpTxBuffer::GetTransmittedSegment(uint32_t numBytes, const SequenceNumber32& se
     NS_ASSERT(numBytes <= m_sentSize);
     NS_ASSERT(!m_sentList.empty());
 
-    auto it = m_sentList.begin();
     bool listEdited = false;
     uint32_t s = numBytes;
 
     // Avoid to merge different packet for this retransmission if flags are
     // different.
-    for (; it != m_sentList.end(); ++it)
+    auto it = m_sentList.begin() + FindSentItem(seq);
+    if (it != m_sentList.end() && (*it)->m_startSeq == seq)
     {
-        if ((*it)->m_startSeq == seq)
+        auto next = it;
+        next++;
+        if (next != m_sentList.end())
         {
-            auto next = it;
-            next++;
-            if (next != m_sentList.end())
+            // Next is not sacked and have the same value for m_lost ... there is the
+            // possibility to merge
+            if ((!(*next)->m_sacked) && ((*it)->m_lost == (*next)->m_lost))
             {
-                // Next is not sacked and have the same value for m_lost ... there is the
-                // possibility to merge
-                if ((!(*next)->m_sacked) && ((*it)->m_lost == (*next)->m_lost))
-                {
-                    s = std::min(s, (*it)->m_packet->GetSize() + (*next)->m_packet->GetSize());
-                }
-                else
-                {
-                    // Next is sacked... better to retransmit only the first segment
-                    s = std::min(s, (*it)->m_packet->GetSize());
-                }
+                s = std::min(s, (*it)->m_packet->GetSize() + (*next)->m_packet->GetSize());
             }
             else
             {
+                // Next is sacked... better to retransmit only the first segment
                 s = std::min(s, (*it)->m_packet->GetSize());
             }
-            break;
+        }
+        else
+        {
+            s = std::min(s, (*it)->m_packet->GetSize());
         }
     }
 
@@ -344,26 +345,49 @@ TcpTxBuffer::GetTransmittedSegment(uint32_t numBytes, const SequenceNumber32& se
     return item;
 }
 
-std::pair<TcpTxBuffer::PacketList::const_iterator, SequenceNumber32>
-TcpTxBuffer::FindHighestSacked() const
+std::size_t
+TcpTxBuffer::LowerBoundSentItem(const SequenceNumber32& seq) const
 {
-    NS_LOG_FUNCTION(this);
-
-    SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq;
-
-    auto ret = std::make_pair(m_sentList.end(), SequenceNumber32(0));
+    auto it =
+        std::partition_point(m_sentList.begin(),
+                             m_sentList.end(),
+                             [&seq](const TcpTxItem* item) { return item->m_startSeq < seq; });
+    return it - m_sentList.begin();
+}
 
-    for (auto it = m_sentList.begin(); it != m_sentList.end(); ++it)
+std::size_t
+TcpTxBuffer::FindSentItem(const SequenceNumber32& seq) const
+{
+    auto it =
+        std::partition_point(m_sentList.begin(),
+                             m_sentList.end(),
+                             [&seq](const TcpTxItem* item) { return item->m_startSeq <= seq; });
+    if (it != m_sentList.begin())
     {
-        const TcpTxItem* item = *it;
-        if (item->m_sacked)
+        --it;
+        if (seq < (*it)->m_startSeq + (*it)->m_packet->GetSize())
         {
-            ret = std::make_pair(it, beginOfCurrentPacket);
+            return it - m_sentList.begin();
         }
-        beginOfCurrentPacket += item->m_packet->GetSize();
     }
+    return m_sentList.size();
+}
 
-    return ret;
+void
+TcpTxBuffer::ClampHints()
+{
+    SequenceNumber32 sentEnd = m_firstByteSeq.Get() + m_sentSize;
+    for (auto hint : {&m_lostFrontier, &m_nextSegHint})
+    {
+        if (*hint < m_firstByteSeq.Get())
+        {
+            *hint = m_firstByteSeq.Get();
+        }
+        else if (*hint > sentEnd)
+        {
+            *hint = sentEnd;
+        }
+    }
 }
 
 void
@@ -427,12 +451,23 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
     TcpTxItem* outItem = nullptr;
     auto it = list.begin();
     SequenceNumber32 beginOfCurrentPacket = listStartFrom;
+    const bool isSentList = (&list == &m_sentList);
+
+    if (isSentList)
+    {
+        // The items before the one containing seq are not involved, skip them
+        it += FindSentItem(seq);
+        if (it != list.end())
+        {
+            beginOfCurrentPacket = (*it)->m_startSeq;
+        }
+    }
 
     while (it != list.end())
     {
         currentItem = *it;
         currentPacket = currentItem->m_packet;
-        NS_ASSERT_MSG(list != m_sentList || currentItem->m_startSeq >= m_firstByteSeq,
+        NS_ASSERT_MSG(!isSentList || currentItem->m_startSeq >= m_firstByteSeq,
                       "start: " << m_firstByteSeq
                                 << " currentItem start: " << currentItem->m_startSeq);
 
@@ -466,6 +501,10 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
                 {
                     *listEdited = true;
                 }
+                if (isSentList)
+                {
+                    m_nextSegHint = std::min(m_nextSegHint, firstPart->m_startSeq);
+                }
 
                 return GetPacketFromList(list, listStartFrom, numBytes, seq, listEdited);
             }
@@ -515,6 +554,10 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
                     {
                         *listEdited = true;
                     }
+                    if (isSentList)
+                    {
+                        m_nextSegHint = std::min(m_nextSegHint, previous->m_startSeq);
+                    }
 
                     return GetPacketFromList(list, listStartFrom, numBytes, seq, listEdited);
                 }
@@ -532,6 +575,10 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
                 {
                     *listEdited = true;
                 }
+                if (isSentList)
+                {
+                    m_nextSegHint = std::min(m_nextSegHint, firstPart->m_startSeq);
+                }
 
                 return firstPart;
             }
@@ -564,6 +611,10 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
             {
                 *listEdited = true;
             }
+            if (isSentList)
+            {
+                m_nextSegHint = std::min(m_nextSegHint, currentItem->m_startSeq);
+            }
 
             return GetPacketFromList(list, listStartFrom, numBytes, seq, listEdited);
         }
@@ -640,16 +691,15 @@ bool
 TcpTxBuffer::IsRetransmittedDataAcked(const SequenceNumber32& ack) const
 {
     NS_LOG_FUNCTION(this);
-    for (const auto& it : m_sentList)
+    // Only the item ending right before the ACK number can match
+    auto index = FindSentItem(ack - 1);
+    if (index == m_sentList.size())
     {
-        TcpTxItem* item = it;
-        Ptr<Packet> p = item->m_packet;
-        if (item->m_startSeq + p->GetSize() == ack && !item->m_sacked && item->m_retrans)
-        {
-            return true;
-        }
+        return false;
     }
-    return false;
+    TcpTxItem* item = m_sentList[index];
+    Ptr<Packet> p = item->m_packet;
+    return item->m_startSeq + p->GetSize() == ack && !item->m_sacked && item->m_retrans;
 }
 
 void
@@ -755,11 +805,12 @@ TcpTxBuffer::DiscardUpTo(const SequenceNumber32& seq, const Callback<void, TcpTx
                                               << " this is the result: " << *this);
     }
 
-    if (m_highestSack.second <= m_firstByteSeq)
+    if (m_highestSack <= m_firstByteSeq)
     {
         m_sackSeen = false;
-        m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
+        m_highestSack = SequenceNumber32(0);
     }
+    ClampHints();
 
     NS_LOG_DEBUG("Discarded up to " << seq << " lost: " << m_lostOut << " retrans: " << m_retrans
                                     << " sacked: " << m_sackedOut);
@@ -779,18 +830,19 @@ TcpTxBuffer::Update(const TcpOptionSack::SackList& list, const Callback<void, Tc
 
     for (auto option_it = list.begin(); option_it != list.end(); ++option_it)
     {
-        auto item_it = m_sentList.begin();
-        SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq;
-
         if (m_firstByteSeq + m_sentSize < (*option_it).first)
         {
             NS_LOG_INFO("Not updating scoreboard, the option block is outside the sent list");
             return bytesSacked;
         }
 
+        // The items starting before the block can not be sacked by it, skip them
+        auto item_it = m_sentList.begin() + LowerBoundSentItem((*option_it).first);
+
         while (item_it != m_sentList.end())
         {
             uint32_t pktSize = (*item_it)->m_packet->GetSize();
+            SequenceNumber32 beginOfCurrentPacket = (*item_it)->m_startSeq;
 
             // Check the boundary of this packet ... only mark as sacked if
             // it is precisely mapped over the option. It means that if the receiver
@@ -819,17 +871,16 @@ TcpTxBuffer::Update(const TcpOptionSack::SackList& list, const Callback<void, Tc
                     m_sackedOut += (*item_it)->m_packet->GetSize();
                     bytesSacked += (*item_it)->m_packet->GetSize();
 
-                    if (m_highestSack.first == m_sentList.end() ||
-                        m_highestSack.second <= beginOfCurrentPacket + pktSize)
+                    if (!m_sackSeen || m_highestSack <= beginOfCurrentPacket + pktSize)
                     {
                         m_sackSeen = true;
-                        m_highestSack = std::make_pair(item_it, beginOfCurrentPacket);
+                        m_highestSack = beginOfCurrentPacket;
                     }
 
                     NS_LOG_INFO("Received block "
                                 << *option_it << ", checking sentList for block " << *(*item_it)
                                 << ", found in the sackboard, sacking, current highSack: "
-                                << m_highestSack.second);
+                                << m_highestSack);
 
                     if (!sackedCb.IsNull())
                     {
@@ -845,14 +896,13 @@ TcpTxBuffer::Update(const TcpOptionSack::SackList& list, const Callback<void, Tc
                 break;
             }
 
-            beginOfCurrentPacket += pktSize;
             ++item_it;
         }
     }
 
     if (bytesSacked > 0)
     {
-        NS_ASSERT_MSG(m_highestSack.first != m_sentList.end(), "Buffer status: " << *this);
+        NS_ASSERT_MSG(m_sackSeen, "Buffer status: " << *this);
         UpdateLostCount();
     }
 
@@ -869,21 +919,24 @@ TcpTxBuffer::UpdateLostCount()
 {
     NS_LOG_FUNCTION(this);
     uint32_t sacked = 0;
-    SequenceNumber32 beginOfCurrentPacket = m_highestSack.second;
-    if (m_highestSack.first == m_sentList.end())
+    auto index = FindSentItem(m_highestSack);
+    if (!m_sackSeen || index == m_sentList.size())
     {
-        NS_LOG_INFO("Status before the update: " << *this
-                                                 << ", will start from the latest sent item");
+        NS_LOG_INFO("Status: " << *this << ", no sacked item to start from");
+        return;
     }
-    else
+    NS_LOG_INFO("Status before the update: " << *this << ", will start from item "
+                                             << *m_sentList[index]);
+
+    // The items after the head and before m_lostFrontier are lost or sacked
+    // already, hence walking them changes nothing but the number of sacked
+    // items, which only matters if the head is sacked and not lost
+    const TcpTxItem* head = m_sentList.front();
+    const bool countAll = head->m_sacked && !head->m_lost;
+    std::optional<SequenceNumber32> lostFrontier;
+    for (; index > 0 && (countAll || m_sentList[index]->m_startSeq >= m_lostFrontier); --index)
     {
-        NS_LOG_INFO("Status before the update: " << *this << ", will start from item "
-                                                 << *(*m_highestSack.first));
-    }
-
-    for (auto it = m_highestSack.first; it != m_sentList.begin(); --it)
-    {
-        TcpTxItem* item = *it;
+        TcpTxItem* item = m_sentList[index];
         if (item->m_sacked)
         {
             sacked++;
@@ -891,13 +944,17 @@ TcpTxBuffer::UpdateLostCount()
 
         if (sacked >= m_dupAckThresh)
         {
+            if (!lostFrontier)
+            {
+                // this item and all the ones before will be lost or sacked
+                lostFrontier = item->m_startSeq + item->m_packet->GetSize();
+            }
             if (!item->m_sacked && !item->m_lost)
             {
                 item->m_lost = true;
                 m_lostOut += item->m_packet->GetSize();
             }
         }
-        beginOfCurrentPacket -= item->m_packet->GetSize();
     }
 
     if (sacked >= m_dupAckThresh)
@@ -909,6 +966,10 @@ TcpTxBuffer::UpdateLostCount()
             m_lostOut += item->m_packet->GetSize();
         }
     }
+    if (lostFrontier && *lostFrontier > m_lostFrontier)
+    {
+        m_lostFrontier = *lostFrontier;
+    }
     NS_LOG_INFO("Status after the update: " << *this);
     ConsistencyCheck();
 }
@@ -918,29 +979,25 @@ TcpTxBuffer::IsLost(const SequenceNumber32& seq) const
 {
     NS_LOG_FUNCTION(this << seq);
 
-    if (seq >= m_highestSack.second)
+    if (seq >= m_highestSack)
     {
         return false;
     }
 
-    // In theory, using a map and hints when inserting elements can improve
-    // performance
-    for (auto it = m_sentList.begin(); it != m_sentList.end(); ++it)
+    auto index = FindSentItem(seq);
+    if (index < m_sentList.size())
     {
-        // Search for the right iterator before calling IsLost()
-        if ((*it)->m_startSeq <= seq && seq < (*it)->m_startSeq + (*it)->m_packet->GetSize())
+        const TcpTxItem* item = m_sentList[index];
+        if (item->m_lost)
         {
-            if ((*it)->m_lost)
-            {
-                NS_LOG_INFO("seq=" << seq << " is lost because of lost flag");
-                return true;
-            }
+            NS_LOG_INFO("seq=" << seq << " is lost because of lost flag");
+            return true;
+        }
 
-            if ((*it)->m_sacked)
-            {
-                NS_LOG_INFO("seq=" << seq << " is not lost because of sacked flag");
-                return false;
-            }
+        if (item->m_sacked)
+        {
+            NS_LOG_INFO("seq=" << seq << " is not lost because of sacked flag");
+            return false;
         }
     }
 
@@ -968,15 +1025,39 @@ TcpTxBuffer::NextSeg(SequenceNumber32* seq, SequenceNumber32* seqHigh, bool isRe
     TcpTxItem* item;
     SequenceNumber32 seqPerRule3;
     bool isSeqPerRule3Valid = false;
-    SequenceNumber32 beginOfCurrentPkt = m_firstByteSeq;
 
-    for (auto it = m_sentList.begin(); it != m_sentList.end(); ++it)
+    // The items after the head and before m_nextSegHint are retransmitted or
+    // sacked, hence they do not meet the criteria below: check the head, then
+    // continue from m_nextSegHint (which is advanced over such items)
+    const std::size_t first = std::max<std::size_t>(1, LowerBoundSentItem(m_nextSegHint));
+    bool advanceHint = true;
+
+    for (std::size_t i = 0; i < m_sentList.size(); i = (i == 0 ? first : i + 1))
     {
-        item = *it;
+        item = m_sentList[i];
+        SequenceNumber32 beginOfCurrentPkt = item->m_startSeq;
+
+        if (i > 0 && advanceHint)
+        {
+            if (item->m_retrans || item->m_sacked)
+            {
+                m_nextSegHint = beginOfCurrentPkt + item->m_packet->GetSize();
+            }
+            else
+            {
+                advanceHint = false;
+            }
+        }
+
+        if (m_sackSeen && beginOfCurrentPkt >= m_highestSack)
+        {
+            // Conditions 1.b and 3 can not be met anymore
+            break;
+        }
 
         // Condition 1.a , 1.b , and 1.c
         if (!item->m_retrans && !item->m_sacked &&
-            ((m_sackSeen && item->m_startSeq < m_highestSack.second) || !m_sackSeen))
+            ((m_sackSeen && item->m_startSeq < m_highestSack) || !m_sackSeen))
         {
             if (item->m_lost)
             {
@@ -992,9 +1073,6 @@ TcpTxBuffer::NextSeg(SequenceNumber32* seq, SequenceNumber32* seqHigh, bool isRe
                 seqPerRule3 = beginOfCurrentPkt;
             }
         }
-
-        // Nothing found, iterate
-        beginOfCurrentPkt += item->m_packet->GetSize();
     }
 
     /* (2) If no sequence number 'S2' per rule (1) exists but there
@@ -1173,7 +1251,7 @@ TcpTxBuffer::IsLostRFC(const SequenceNumber32& seq, const PacketList::const_iter
             }
         }
 
-        if (beginOfCurrentPacket >= m_highestSack.second)
+        if (beginOfCurrentPacket >= m_highestSack)
         {
             if (item->m_lost && !item->m_retrans)
             {
@@ -1186,10 +1264,10 @@ TcpTxBuffer::IsLostRFC(const SequenceNumber32& seq, const PacketList::const_iter
 
         beginOfCurrentPacket += current->GetSize();
     }
-    if (it == m_highestSack.first)
+    if (!m_sackSeen)
     {
         NS_LOG_INFO("seq=" << seq << " is not lost because there are no sacked segment ahead "
-                           << m_highestSack.second);
+                           << m_highestSack);
     }
     return false;
 }
@@ -1205,8 +1283,10 @@ TcpTxBuffer::ResetRenoSack()
         (*it)->m_sacked = false;
     }
 
-    m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
+    m_highestSack = SequenceNumber32(0);
     m_sackSeen = false;
+    m_lostFrontier = m_firstByteSeq;
+    m_nextSegHint = m_firstByteSeq;
 }
 
 void
@@ -1236,7 +1316,9 @@ TcpTxBuffer::ResetSentList()
     m_retrans = 0;
     m_sackedOut = 0;
     m_sackSeen = false;
-    m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
+    m_highestSack = SequenceNumber32(0);
+    m_lostFrontier = m_firstByteSeq;
+    m_nextSegHint = m_firstByteSeq;
 }
 
 void
@@ -1254,6 +1336,7 @@ TcpTxBuffer::ResetLastSegmentSent()
             m_retrans -= item->m_packet->GetSize();
         }
         m_appList.insert(m_appList.begin(), item);
+        ClampHints();
     }
     ConsistencyCheck();
 }
@@ -1269,13 +1352,17 @@ TcpTxBuffer::SetSentListLost(bool resetSack)
         m_sackedOut = 0;
         m_lostOut = m_sentSize;
         m_sackSeen = false;
-        m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
+        m_highestSack = SequenceNumber32(0);
     }
     else
     {
         m_lostOut = 0;
     }
 
+    // All the items become lost (or stay sacked) and none is retransmitted
+    m_lostFrontier = m_firstByteSeq.Get() + m_sentSize;
+    m_nextSegHint = m_firstByteSeq;
+
     for (auto it = m_sentList.begin(); it != m_sentList.end(); ++it)
     {
         if (resetSack)
@@ -1397,7 +1484,7 @@ TcpTxBuffer::AddRenoSack()
         (*it)->m_sacked = true;
         m_sackedOut += (*it)->m_packet->GetSize();
         m_sackSeen = true;
-        m_highestSack = std::make_pair(it, (*it)->m_startSeq);
+        m_highestSack = (*it)->m_startSeq;
         NS_LOG_INFO("Added a Reno SACK, status: " << *this);
     }
     else
@@ -0,0 +1,214 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/ipv4-end-point-demux.h"
+#include "ns3/ipv4-end-point.h"
+#include "ns3/ipv4-interface.h"
+#include "ns3/ipv6-end-point-demux.h"
+#include "ns3/ipv6-end-point.h"
+#include "ns3/ipv6-interface.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief End point demultiplexer lookup Test
+ *
+ * Many end points, either accepting packets from any peer or connected to a peer, are
+ * allocated on a few local ports of a demultiplexer. The test checks that packets are
+ * delivered to the connected end point when there is one and to the end point accepting
+ * packets from any peer otherwise, including after the peer of some end points is changed
+ * and after some end points are deallocated. It also checks the detection of duplicated
+ * end points and of the local ports in use.
+ *
+ * \tparam Demux the demultiplexer type (Ipv4EndPointDemux or Ipv6EndPointDemux)
+ * \tparam Interface the interface type (Ipv4Interface or Ipv6Interface)
+ */
+template <class Demux, class Interface>
+class EndPointDemuxLookupTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param name the name of the test case
+     */
+    EndPointDemuxLookupTestCase(const std::string& name);
+
+  private:
+    void DoRun() override;
+
+    /// Address type of the end points
+    using EndPointAddress =
+        decltype(std::declval<typename Demux::EndPoints::value_type>()->GetLocalAddress());
+
+    /**
+     * \param i the index of the peer
+     * \return the address of the i-th peer
+     */
+    EndPointAddress GetPeerAddress(uint32_t i) const;
+
+    /**
+     * \brief Lookup the end point receiving a packet.
+     * \param dport the destination port of the packet
+     * \param saddr the source address of the packet
+     * \param sport the source port of the packet
+     * \return the end point, or null if there is none
+     */
+    typename Demux::EndPoints::value_type Lookup(uint16_t dport,
+                                                 EndPointAddress saddr,
+                                                 uint16_t sport);
+
+    Demux m_demux;                  //!< demultiplexer
+    EndPointAddress m_localAddress; //!< local address
+    Ptr<Interface> m_interface;     //!< incoming interface
+};
+
+template <class Demux, class Interface>
+EndPointDemuxLookupTestCase<Demux, Interface>::EndPointDemuxLookupTestCase(
+    const std::string& name)
+    : TestCase(name)
+{
+}
+
+template <class Demux, class Interface>
+typename EndPointDemuxLookupTestCase<Demux, Interface>::EndPointAddress
+EndPointDemuxLookupTestCase<Demux, Interface>::GetPeerAddress(uint32_t i) const
+{
+    if constexpr (std::is_same_v<EndPointAddress, Ipv4Address>)
+    {
+        return Ipv4Address(0x0a000000 + i + 1);
+    }
+    else
+    {
+        uint8_t bytes[16] = {0x20, 0x01, 0x0d, 0xb8};
+        bytes[14] = (i + 1) >> 8;
+        bytes[15] = (i + 1) & 0xff;
+        return Ipv6Address(bytes);
+    }
+}
+
+template <class Demux, class Interface>
+typename Demux::EndPoints::value_type
+EndPointDemuxLookupTestCase<Demux, Interface>::Lookup(uint16_t dport,
+                                                      EndPointAddress saddr,
+                                                      uint16_t sport)
+{
+    auto endPoints = m_demux.Lookup(m_localAddress, dport, saddr, sport, m_interface);
+    return endPoints.empty() ? nullptr : endPoints.front();
+}
+
+template <class Demux, class Interface>
+void
+EndPointDemuxLookupTestCase<Demux, Interface>::DoRun()
+{
+    m_localAddress = GetPeerAddress(0xfff0);
+    m_interface = CreateObject<Interface>();
+
+    const uint16_t nPorts = 4;
+    const uint32_t nPeers = 200;
+    const uint16_t peerPort = 5000;
+
+    std::vector<typename Demux::EndPoints::value_type> listeners;
+    std::vector<typename Demux::EndPoints::value_type> connected;
+    for (uint16_t port = 1; port <= nPorts; ++port)
+    {
+        listeners.push_back(m_demux.Allocate(nullptr, m_localAddress, port));
+        for (uint32_t i = 0; i < nPeers; ++i)
+        {
+            connected.push_back(
+                m_demux.Allocate(nullptr, m_localAddress, port, GetPeerAddress(i), peerPort));
+        }
+    }
+
+    for (uint16_t port = 1; port <= nPorts + 1; ++port)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_demux.LookupPortLocal(port),
+                              (port <= nPorts),
+                              "Unexpected use of local port " << port);
+    }
+    NS_TEST_EXPECT_MSG_EQ(m_demux.Allocate(nullptr, m_localAddress, 1, GetPeerAddress(7), peerPort),
+                          nullptr,
+                          "Duplicated end point allocated");
+
+    // connected end points receive the packets from their peer, the listener all the others
+    for (uint16_t port = 1; port <= nPorts; ++port)
+    {
+        for (uint32_t i = 0; i < nPeers; i += 7)
+        {
+            NS_TEST_EXPECT_MSG_EQ(Lookup(port, GetPeerAddress(i), peerPort),
+                                  connected[(port - 1) * nPeers + i],
+                                  "Unexpected end point for port " << port << " and peer " << i);
+        }
+        NS_TEST_EXPECT_MSG_EQ(Lookup(port, GetPeerAddress(nPeers), peerPort),
+                              listeners[port - 1],
+                              "Unexpected end point for port " << port << " and unknown peer");
+        NS_TEST_EXPECT_MSG_EQ(Lookup(port, GetPeerAddress(0), peerPort + 1),
+                              listeners[port - 1],
+                              "Unexpected end point for port " << port << " and unknown port");
+    }
+    NS_TEST_EXPECT_MSG_EQ(Lookup(nPorts + 1, GetPeerAddress(0), peerPort),
+                          nullptr,
+                          "Unexpected end point for unused port");
+
+    // change the peer of an end point
+    auto endPoint = connected[3];
+    endPoint->SetPeer(GetPeerAddress(nPeers), peerPort);
+    NS_TEST_EXPECT_MSG_EQ(Lookup(1, GetPeerAddress(3), peerPort),
+                          listeners[0],
+                          "Packet from the former peer not delivered to the listener");
+    NS_TEST_EXPECT_MSG_EQ(Lookup(1, GetPeerAddress(nPeers), peerPort),
+                          endPoint,
+                          "Packet from the new peer not delivered to the end point");
+
+    // deallocate end points
+    m_demux.DeAllocate(endPoint);
+    NS_TEST_EXPECT_MSG_EQ(Lookup(1, GetPeerAddress(nPeers), peerPort),
+                          listeners[0],
+                          "Packet delivered to a deallocated end point");
+    m_demux.DeAllocate(listeners[nPorts - 1]);
+    NS_TEST_EXPECT_MSG_EQ(Lookup(nPorts, GetPeerAddress(nPeers), peerPort),
+                          nullptr,
+                          "Packet delivered to a deallocated listener");
+    NS_TEST_EXPECT_MSG_EQ(Lookup(nPorts, GetPeerAddress(0), peerPort),
+                          connected[(nPorts - 1) * nPeers],
+                          "Packet not delivered to a connected end point");
+    for (uint32_t i = 0; i < nPeers; ++i)
+    {
+        m_demux.DeAllocate(connected[(nPorts - 1) * nPeers + i]);
+    }
+    NS_TEST_EXPECT_MSG_EQ(m_demux.LookupPortLocal(nPorts),
+                          false,
+                          "Local port still in use after deallocating all its end points");
+
+    m_interface = nullptr;
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief End point demultiplexer TestSuite
+ */
+class EndPointDemuxTestSuite : public TestSuite
+{
+  public:
+    EndPointDemuxTestSuite();
+};
+
+EndPointDemuxTestSuite::EndPointDemuxTestSuite()
+    : TestSuite("end-point-demux", Type::UNIT)
+{
+    AddTestCase(new EndPointDemuxLookupTestCase<Ipv4EndPointDemux, Ipv4Interface>(
+                    "Lookup of IPv4 end points"),
+                TestCase::Duration::QUICK);
+    AddTestCase(new EndPointDemuxLookupTestCase<Ipv6EndPointDemux, Ipv6Interface>(
+                    "Lookup of IPv6 end points"),
+                TestCase::Duration::QUICK);
+}
+
+static EndPointDemuxTestSuite g_endPointDemuxTestSuite; //!< Static variable for test initialization
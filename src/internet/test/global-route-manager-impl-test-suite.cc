@@ -15,7 +15,9 @@
 #include "ns3/simulator.h"
 #include "ns3/test.h"
 
+#include <algorithm>
 #include <cstdlib> // for rand()
+#include <list>
 
 using namespace ns3;
 
@@ -204,6 +206,95 @@ GlobalRouteManagerImplTestCase::DoRun()
     // does not crash
 }
 
+/**
+ * \ingroup internet-test
+ *
+ * \brief CandidateQueue ordering Test
+ *
+ * Vertices with random distances and types are pushed to a CandidateQueue, the distance
+ * of random vertices in the queue is reduced and vertices are popped. The order in which
+ * the vertices are popped is compared with the order given by a sorted list, where new
+ * vertices are inserted after the vertices with the same priority and which is stably
+ * sorted when a distance is reduced.
+ */
+class CandidateQueueTestCase : public TestCase
+{
+  public:
+    CandidateQueueTestCase();
+    void DoRun() override;
+};
+
+CandidateQueueTestCase::CandidateQueueTestCase()
+    : TestCase("CandidateQueue ordering")
+{
+}
+
+void
+CandidateQueueTestCase::DoRun()
+{
+    // the priority order: lower distance first, network vertices before router vertices
+    auto compare = [](const SPFVertex* v1, const SPFVertex* v2) {
+        return v1->GetDistanceFromRoot() < v2->GetDistanceFromRoot() ||
+               (v1->GetDistanceFromRoot() == v2->GetDistanceFromRoot() &&
+                v1->GetVertexType() == SPFVertex::VertexNetwork &&
+                v2->GetVertexType() == SPFVertex::VertexRouter);
+    };
+
+    CandidateQueue candidate;
+    std::list<SPFVertex*> expected;
+    std::srand(1);
+    uint32_t nextId = 1;
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        auto op = std::rand() % 4;
+        if (op <= 1 || expected.empty())
+        {
+            auto v = new SPFVertex;
+            v->SetVertexId(Ipv4Address(nextId++));
+            v->SetVertexType(std::rand() % 2 ? SPFVertex::VertexRouter
+                                             : SPFVertex::VertexNetwork);
+            v->SetDistanceFromRoot(std::rand() % 20 + 10);
+            candidate.Push(v);
+            expected.insert(std::upper_bound(expected.begin(), expected.end(), v, compare), v);
+        }
+        else if (op == 2)
+        {
+            auto it = expected.begin();
+            std::advance(it, std::rand() % expected.size());
+            auto v = candidate.Find((*it)->GetVertexId());
+            NS_TEST_ASSERT_MSG_EQ(v, *it, "Vertex " << (*it)->GetVertexId() << " not found");
+            if (v->GetDistanceFromRoot() > 0)
+            {
+                v->SetDistanceFromRoot(std::rand() % v->GetDistanceFromRoot());
+                candidate.Update(v);
+                expected.sort(compare);
+            }
+        }
+        else
+        {
+            NS_TEST_ASSERT_MSG_EQ(candidate.Top(), expected.front(), "Unexpected top vertex");
+            auto v = candidate.Pop();
+            NS_TEST_ASSERT_MSG_EQ(v, expected.front(), "Unexpected popped vertex");
+            NS_TEST_EXPECT_MSG_EQ(candidate.Find(v->GetVertexId()),
+                                  nullptr,
+                                  "Popped vertex still found");
+            expected.pop_front();
+            delete v;
+        }
+        NS_TEST_ASSERT_MSG_EQ(candidate.Size(), expected.size(), "Unexpected queue size");
+    }
+
+    while (!expected.empty())
+    {
+        auto v = candidate.Pop();
+        NS_TEST_ASSERT_MSG_EQ(v, expected.front(), "Unexpected popped vertex");
+        expected.pop_front();
+        delete v;
+    }
+    NS_TEST_EXPECT_MSG_EQ(candidate.Empty(), true, "Queue not empty");
+}
+
 /**
  * \ingroup internet-test
  *
@@ -221,6 +312,7 @@ GlobalRouteManagerImplTestSuite::GlobalRouteManagerImplTestSuite()
     : TestSuite("global-route-manager-impl", Type::UNIT)
 {
     AddTestCase(new GlobalRouteManagerImplTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(new CandidateQueueTestCase(), TestCase::Duration::QUICK);
 }
 
 static GlobalRouteManagerImplTestSuite
@@ -5,6 +5,7 @@
 #include "ns3/boolean.h"
 #include "ns3/bridge-helper.h"
 #include "ns3/config.h"
+#include "ns3/global-router-interface.h"
 #include "ns3/inet-socket-address.h"
 #include "ns3/internet-stack-helper.h"
 #include "ns3/ipv4-address-helper.h"
@@ -20,6 +21,7 @@
 #include "ns3/node.h"
 #include "ns3/packet.h"
 #include "ns3/pointer.h"
+#include "ns3/random-variable-stream.h"
 #include "ns3/simple-channel.h"
 #include "ns3/simple-net-device-helper.h"
 #include "ns3/simple-net-device.h"
@@ -1300,6 +1302,299 @@ Ipv4GlobalRoutingSlash32TestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup internet-test
+ *
+ * \brief IPv4 GlobalRouting route lookup test
+ *
+ * Many overlapping host and network routes are added to a global routing instance. The
+ * routes returned by RouteOutput() for random destinations are compared with those
+ * selected by scanning the routing table (i.e., the first host route to the destination
+ * or, if none, the first network route matching the destination), before and after
+ * removing some of the routes.
+ */
+class Ipv4GlobalRoutingLookupTestCase : public TestCase
+{
+  public:
+    Ipv4GlobalRoutingLookupTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Check the routes to random destinations.
+     * \param stage the description of the stage of the test
+     */
+    void CheckRoutes(const std::string& stage);
+
+    /**
+     * \brief Select a route by scanning the routing table.
+     * \param dest the destination
+     * \return the index of the selected route, or the number of routes if none matches
+     */
+    uint32_t ScanRoutes(Ipv4Address dest) const;
+
+    Ptr<Ipv4> m_ipv4;                    //!< IPv4 of the node
+    Ptr<Ipv4GlobalRouting> m_routing;    //!< global routing under test
+    Ptr<UniformRandomVariable> m_random; //!< random variable
+    uint32_t m_nHostRoutes{0};           //!< number of host routes
+};
+
+Ipv4GlobalRoutingLookupTestCase::Ipv4GlobalRoutingLookupTestCase()
+    : TestCase("Global routing lookup of host and network routes")
+{
+}
+
+uint32_t
+Ipv4GlobalRoutingLookupTestCase::ScanRoutes(Ipv4Address dest) const
+{
+    // host routes come first in the routing table
+    for (uint32_t i = 0; i < m_routing->GetNRoutes(); ++i)
+    {
+        auto route = m_routing->GetRoute(i);
+        if ((i < m_nHostRoutes && route->GetDest() == dest) ||
+            (i >= m_nHostRoutes &&
+             route->GetDestNetworkMask().IsMatch(dest, route->GetDestNetwork())))
+        {
+            return i;
+        }
+    }
+    return m_routing->GetNRoutes();
+}
+
+void
+Ipv4GlobalRoutingLookupTestCase::CheckRoutes(const std::string& stage)
+{
+    for (uint32_t i = 0; i < 2000; ++i)
+    {
+        // pick either a random address or the destination of a route
+        Ipv4Address dest(m_random->GetInteger(0x0a000000, 0x0affffff));
+        if (i % 4 == 0)
+        {
+            dest = m_routing->GetRoute(m_random->GetInteger(0, m_routing->GetNRoutes() - 1))
+                       ->GetDest();
+        }
+
+        Ipv4Header header;
+        header.SetDestination(dest);
+        Socket::SocketErrno sockerr;
+        auto route = m_routing->RouteOutput(Create<Packet>(), header, nullptr, sockerr);
+        auto expected = ScanRoutes(dest);
+
+        if (expected == m_routing->GetNRoutes())
+        {
+            NS_TEST_EXPECT_MSG_EQ(route, nullptr, stage << ": unexpected route to " << dest);
+            continue;
+        }
+        auto entry = m_routing->GetRoute(expected);
+        NS_TEST_ASSERT_MSG_NE(route, nullptr, stage << ": no route to " << dest);
+        NS_TEST_EXPECT_MSG_EQ(route->GetGateway(),
+                              entry->GetGateway(),
+                              stage << ": unexpected gateway to " << dest);
+        NS_TEST_EXPECT_MSG_EQ(route->GetOutputDevice(),
+                              m_ipv4->GetNetDevice(entry->GetInterface()),
+                              stage << ": unexpected output device to " << dest);
+    }
+}
+
+void
+Ipv4GlobalRoutingLookupTestCase::DoRun()
+{
+    Ptr<Node> node = CreateObject<Node>();
+    InternetStackHelper internet;
+    internet.Install(node);
+    m_ipv4 = node->GetObject<Ipv4>();
+
+    const uint32_t nInterfaces = 3;
+    for (uint32_t i = 1; i <= nInterfaces; ++i)
+    {
+        Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice>();
+        device->SetAddress(Mac48Address::Allocate());
+        node->AddDevice(device);
+        auto ifIndex = m_ipv4->AddInterface(device);
+        m_ipv4->AddAddress(ifIndex,
+                           Ipv4InterfaceAddress(Ipv4Address(0xc0a80001 + (i << 8)),
+                                                Ipv4Mask("/24")));
+        m_ipv4->SetUp(ifIndex);
+    }
+
+    m_routing = CreateObject<Ipv4GlobalRouting>();
+    m_routing->SetIpv4(m_ipv4);
+    m_random = CreateObject<UniformRandomVariable>();
+    m_random->SetStream(1);
+
+    // a few host routes (some of them equal cost) and overlapping network routes
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        auto interface = m_random->GetInteger(1, nInterfaces);
+        Ipv4Address dest(m_random->GetInteger(0x0a000000, 0x0a0000ff));
+        m_routing->AddHostRouteTo(dest, Ipv4Address(0xc0a80002 + (interface << 8) + i), interface);
+        ++m_nHostRoutes;
+    }
+    for (uint32_t i = 0; i < 500; ++i)
+    {
+        auto length = m_random->GetInteger(8, 32);
+        auto interface = m_random->GetInteger(1, nInterfaces);
+        Ipv4Mask mask(length == 32 ? 0xffffffff : ~(0xffffffff >> length));
+        Ipv4Address network(m_random->GetInteger(0x0a000000, 0x0affffff) & mask.Get());
+        m_routing->AddNetworkRouteTo(network,
+                                     mask,
+                                     Ipv4Address(0xc0a80002 + (interface << 8) + i % 200),
+                                     interface);
+    }
+    CheckRoutes("Initial routes");
+
+    for (uint32_t i = 0; i < 200; ++i)
+    {
+        auto index = m_random->GetInteger(0, m_routing->GetNRoutes() - 1);
+        if (index < m_nHostRoutes)
+        {
+            --m_nHostRoutes;
+        }
+        m_routing->RemoveRoute(index);
+    }
+    CheckRoutes("After removing routes");
+
+    m_routing->Dispose();
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief IPv4 GlobalRouting compact routes test
+ *
+ * The global routes of a ring of routers, some of them also connected to a LAN, are
+ * computed first as routing table entries and then as compact routes. The test checks that
+ * the routes returned by RouteOutput() from every node to every address are the same in
+ * both cases, and that the compact routes replace the routing table entries and use less
+ * memory.
+ */
+class Ipv4GlobalRoutingCompactRoutesTestCase : public TestCase
+{
+  public:
+    Ipv4GlobalRoutingCompactRoutesTestCase();
+
+  private:
+    void DoRun() override;
+
+    /// Route from a node to a destination: gateway and output device
+    using Route = std::pair<Ipv4Address, Ptr<NetDevice>>;
+
+    /**
+     * \brief Lookup the routes from every node to every destination.
+     * \param nodes the nodes
+     * \param destinations the destinations
+     * \return the routes, by node and destination
+     */
+    std::vector<Route> LookupRoutes(const NodeContainer& nodes,
+                                    const std::vector<Ipv4Address>& destinations) const;
+};
+
+Ipv4GlobalRoutingCompactRoutesTestCase::Ipv4GlobalRoutingCompactRoutesTestCase()
+    : TestCase("Global routing with compact routes")
+{
+}
+
+std::vector<Ipv4GlobalRoutingCompactRoutesTestCase::Route>
+Ipv4GlobalRoutingCompactRoutesTestCase::LookupRoutes(
+    const NodeContainer& nodes,
+    const std::vector<Ipv4Address>& destinations) const
+{
+    std::vector<Route> routes;
+    for (auto node = nodes.Begin(); node != nodes.End(); ++node)
+    {
+        auto routing = (*node)->GetObject<GlobalRouter>()->GetRoutingProtocol();
+        for (const auto& dest : destinations)
+        {
+            Ipv4Header header;
+            header.SetDestination(dest);
+            Socket::SocketErrno sockerr;
+            auto route = routing->RouteOutput(Create<Packet>(), header, nullptr, sockerr);
+            routes.emplace_back(route ? route->GetGateway() : Ipv4Address(),
+                                route ? route->GetOutputDevice() : nullptr);
+        }
+    }
+    return routes;
+}
+
+void
+Ipv4GlobalRoutingCompactRoutesTestCase::DoRun()
+{
+    const uint32_t nNodes = 8;
+    NodeContainer nodes;
+    nodes.Create(nNodes);
+    InternetStackHelper internet;
+    internet.Install(nodes);
+
+    // a ring of point-to-point links and a LAN connecting two neighbors (the global routes
+    // do not support equal cost paths to a LAN which is not attached to the root)
+    SimpleNetDeviceHelper devHelper;
+    devHelper.SetNetDevicePointToPointMode(true);
+    Ipv4AddressHelper ipv4;
+    ipv4.SetBase("10.1.0.0", "255.255.255.252");
+    for (uint32_t i = 0; i < nNodes; ++i)
+    {
+        ipv4.Assign(devHelper.Install(NodeContainer(nodes.Get(i), nodes.Get((i + 1) % nNodes))));
+        ipv4.NewNetwork();
+    }
+    devHelper.SetNetDevicePointToPointMode(false);
+    ipv4.SetBase("10.2.0.0", "255.255.255.0");
+    ipv4.Assign(devHelper.Install(NodeContainer(nodes.Get(0), nodes.Get(1))));
+
+    std::vector<Ipv4Address> destinations;
+    for (auto node = nodes.Begin(); node != nodes.End(); ++node)
+    {
+        auto ipv4L3 = (*node)->GetObject<Ipv4>();
+        for (uint32_t i = 1; i < ipv4L3->GetNInterfaces(); ++i)
+        {
+            destinations.push_back(ipv4L3->GetAddress(i, 0).GetLocal());
+        }
+    }
+    destinations.emplace_back("10.2.0.200");
+    destinations.emplace_back("192.168.0.1");
+
+    Ipv4GlobalRoutingHelper::PopulateRoutingTables();
+    auto expected = LookupRoutes(nodes, destinations);
+    std::vector<uint32_t> nRoutes;
+    std::vector<std::size_t> memoryUsage;
+    for (auto node = nodes.Begin(); node != nodes.End(); ++node)
+    {
+        auto routing = (*node)->GetObject<GlobalRouter>()->GetRoutingProtocol();
+        nRoutes.push_back(routing->GetNRoutes());
+        memoryUsage.push_back(routing->GetRoutesMemoryUsage());
+        NS_TEST_EXPECT_MSG_EQ(routing->GetNCompactRoutes(), 0, "Unexpected compact routes");
+        routing->SetAttribute("CompactRoutes", BooleanValue(true));
+    }
+
+    Ipv4GlobalRoutingHelper::RecomputeRoutingTables();
+    auto routes = LookupRoutes(nodes, destinations);
+    for (uint32_t i = 0; i < routes.size(); ++i)
+    {
+        auto node = i / destinations.size();
+        auto dest = destinations[i % destinations.size()];
+        NS_TEST_EXPECT_MSG_EQ(routes[i].first,
+                              expected[i].first,
+                              "Unexpected gateway from node " << node << " to " << dest);
+        NS_TEST_EXPECT_MSG_EQ(routes[i].second,
+                              expected[i].second,
+                              "Unexpected output device from node " << node << " to " << dest);
+    }
+    for (uint32_t i = 0; i < nNodes; ++i)
+    {
+        auto routing = nodes.Get(i)->GetObject<GlobalRouter>()->GetRoutingProtocol();
+        NS_TEST_EXPECT_MSG_EQ(routing->GetNRoutes(), 0, "Unexpected routing table entries");
+        NS_TEST_EXPECT_MSG_EQ(routing->GetNCompactRoutes(),
+                              nRoutes[i],
+                              "Unexpected number of compact routes of node " << i);
+        NS_TEST_EXPECT_MSG_LT(routing->GetRoutesMemoryUsage(),
+                              memoryUsage[i],
+                              "Compact routes of node " << i << " use more memory");
+    }
+
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup internet-test
  *
@@ -1322,6 +1617,8 @@ Ipv4GlobalRoutingTestSuite::Ipv4GlobalRoutingTestSuite()
     AddTestCase(new TwoBridgeTest, TestCase::Duration::QUICK);
     AddTestCase(new Ipv4DynamicGlobalRoutingTestCase, TestCase::Duration::QUICK);
     AddTestCase(new Ipv4GlobalRoutingSlash32TestCase, TestCase::Duration::QUICK);
+    AddTestCase(new Ipv4GlobalRoutingLookupTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new Ipv4GlobalRoutingCompactRoutesTestCase, TestCase::Duration::QUICK);
 }
 
 static Ipv4GlobalRoutingTestSuite
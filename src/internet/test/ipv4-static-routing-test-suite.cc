@@ -9,11 +9,14 @@
 #include "ns3/inet-socket-address.h"
 #include "ns3/internet-stack-helper.h"
 #include "ns3/ipv4-address-helper.h"
+#include "ns3/ipv4-routing-table-entry.h"
 #include "ns3/ipv4-static-routing-helper.h"
+#include "ns3/ipv4-static-routing.h"
 #include "ns3/node-container.h"
 #include "ns3/node.h"
 #include "ns3/packet.h"
 #include "ns3/pointer.h"
+#include "ns3/random-variable-stream.h"
 #include "ns3/simple-channel.h"
 #include "ns3/simple-net-device-helper.h"
 #include "ns3/simple-net-device.h"
@@ -196,6 +199,171 @@ Ipv4StaticRoutingSlash32TestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup internet-test
+ *
+ * \brief IPv4 StaticRouting longest prefix match Test
+ *
+ * Many overlapping network routes (with random prefix lengths, interfaces and metrics)
+ * are added to a node. The routes returned by RouteOutput() for random destinations are
+ * compared with those selected by scanning the whole forwarding table, before and after
+ * removing some of the routes.
+ */
+class Ipv4StaticRoutingLongestPrefixMatchTestCase : public TestCase
+{
+  public:
+    Ipv4StaticRoutingLongestPrefixMatchTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Check the routes to random destinations.
+     * \param stage the description of the stage of the test
+     */
+    void CheckRoutes(const std::string& stage);
+
+    /**
+     * \brief Select a route by scanning the forwarding table.
+     * \param dest the destination
+     * \return the index of the selected route, or the number of routes if none matches
+     */
+    uint32_t ScanRoutes(Ipv4Address dest) const;
+
+    Ptr<Ipv4> m_ipv4;                    //!< IPv4 of the node
+    Ptr<Ipv4StaticRouting> m_routing;    //!< static routing of the node
+    Ptr<UniformRandomVariable> m_random; //!< random variable
+};
+
+Ipv4StaticRoutingLongestPrefixMatchTestCase::Ipv4StaticRoutingLongestPrefixMatchTestCase()
+    : TestCase("Longest prefix match of static network routes")
+{
+}
+
+uint32_t
+Ipv4StaticRoutingLongestPrefixMatchTestCase::ScanRoutes(Ipv4Address dest) const
+{
+    uint32_t selected = m_routing->GetNRoutes();
+    uint16_t longestMask = 0;
+    uint32_t shortestMetric = 0xffffffff;
+    for (uint32_t i = 0; i < m_routing->GetNRoutes(); ++i)
+    {
+        auto route = m_routing->GetRoute(i);
+        auto metric = m_routing->GetMetric(i);
+        auto masklen = route.GetDestNetworkMask().GetPrefixLength();
+        if (!route.GetDestNetworkMask().IsMatch(dest, route.GetDestNetwork()) ||
+            masklen < longestMask)
+        {
+            continue;
+        }
+        if (masklen > longestMask)
+        {
+            shortestMetric = 0xffffffff;
+        }
+        longestMask = masklen;
+        if (metric > shortestMetric)
+        {
+            continue;
+        }
+        shortestMetric = metric;
+        selected = i;
+        if (masklen == 32)
+        {
+            break;
+        }
+    }
+    return selected;
+}
+
+void
+Ipv4StaticRoutingLongestPrefixMatchTestCase::CheckRoutes(const std::string& stage)
+{
+    for (uint32_t i = 0; i < 2000; ++i)
+    {
+        // pick either a random address or the address of a route
+        Ipv4Address dest(m_random->GetInteger(0x0a000000, 0x0affffff));
+        if (i % 4 == 0)
+        {
+            dest = m_routing
+                       ->GetRoute(m_random->GetInteger(0, m_routing->GetNRoutes() - 1))
+                       .GetDestNetwork();
+        }
+
+        Ipv4Header header;
+        header.SetDestination(dest);
+        Socket::SocketErrno sockerr;
+        auto route = m_routing->RouteOutput(Create<Packet>(), header, nullptr, sockerr);
+        auto expected = ScanRoutes(dest);
+
+        if (expected == m_routing->GetNRoutes())
+        {
+            NS_TEST_EXPECT_MSG_EQ(route, nullptr, stage << ": unexpected route to " << dest);
+            continue;
+        }
+        auto entry = m_routing->GetRoute(expected);
+        NS_TEST_ASSERT_MSG_NE(route, nullptr, stage << ": no route to " << dest);
+        NS_TEST_EXPECT_MSG_EQ(route->GetGateway(),
+                              entry.GetGateway(),
+                              stage << ": unexpected gateway to " << dest);
+        NS_TEST_EXPECT_MSG_EQ(route->GetOutputDevice(),
+                              m_ipv4->GetNetDevice(entry.GetInterface()),
+                              stage << ": unexpected output device to " << dest);
+    }
+}
+
+void
+Ipv4StaticRoutingLongestPrefixMatchTestCase::DoRun()
+{
+    Ptr<Node> node = CreateObject<Node>();
+    InternetStackHelper internet;
+    internet.Install(node);
+    m_ipv4 = node->GetObject<Ipv4>();
+
+    const uint32_t nInterfaces = 3;
+    for (uint32_t i = 1; i <= nInterfaces; ++i)
+    {
+        Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice>();
+        device->SetAddress(Mac48Address::Allocate());
+        node->AddDevice(device);
+        auto ifIndex = m_ipv4->AddInterface(device);
+        m_ipv4->AddAddress(ifIndex,
+                           Ipv4InterfaceAddress(Ipv4Address(0xc0a80001 + (i << 8)),
+                                                Ipv4Mask("/24")));
+        m_ipv4->SetUp(ifIndex);
+    }
+
+    Ipv4StaticRoutingHelper helper;
+    m_routing = helper.GetStaticRouting(m_ipv4);
+    m_random = CreateObject<UniformRandomVariable>();
+    m_random->SetStream(1);
+
+    // overlapping routes within 10.0.0.0/8, with few distinct metrics to have ties
+    for (uint32_t i = 0; i < 500; ++i)
+    {
+        auto length = m_random->GetInteger(8, 32);
+        auto interface = m_random->GetInteger(1, nInterfaces);
+        Ipv4Mask mask(length == 32 ? 0xffffffff : ~(0xffffffff >> length));
+        Ipv4Address network(m_random->GetInteger(0x0a000000, 0x0affffff) & mask.Get());
+        m_routing->AddNetworkRouteTo(network,
+                                     mask,
+                                     Ipv4Address(0xc0a80002 + (interface << 8) + i % 200),
+                                     interface,
+                                     m_random->GetInteger(0, 2));
+    }
+    CheckRoutes("Initial routes");
+
+    for (uint32_t i = 0; i < 200; ++i)
+    {
+        m_routing->RemoveRoute(m_random->GetInteger(0, m_routing->GetNRoutes() - 1));
+    }
+    CheckRoutes("After removing routes");
+
+    m_ipv4->SetDown(2);
+    CheckRoutes("After bringing an interface down");
+
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup internet-test
  *
@@ -211,6 +379,7 @@ Ipv4StaticRoutingTestSuite::Ipv4StaticRoutingTestSuite()
     : TestSuite("ipv4-static-routing", Type::UNIT)
 {
     AddTestCase(new Ipv4StaticRoutingSlash32TestCase, TestCase::Duration::QUICK);
+    AddTestCase(new Ipv4StaticRoutingLongestPrefixMatchTestCase, TestCase::Duration::QUICK);
 }
 
 static Ipv4StaticRoutingTestSuite
@@ -0,0 +1,221 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv6-route.h"
+#include "ns3/ipv6-routing-table-entry.h"
+#include "ns3/ipv6-static-routing-helper.h"
+#include "ns3/ipv6-static-routing.h"
+#include "ns3/node.h"
+#include "ns3/packet.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief IPv6 StaticRouting longest prefix match Test
+ *
+ * Many overlapping network routes (with random prefix lengths, interfaces and metrics)
+ * are added to a node. The routes returned by RouteOutput() for random destinations are
+ * compared with those selected by scanning the whole forwarding table, before and after
+ * removing some of the routes.
+ */
+class Ipv6StaticRoutingLongestPrefixMatchTestCase : public TestCase
+{
+  public:
+    Ipv6StaticRoutingLongestPrefixMatchTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Check the routes to random destinations.
+     * \param stage the description of the stage of the test
+     */
+    void CheckRoutes(const std::string& stage);
+
+    /**
+     * \brief Select a route by scanning the forwarding table.
+     * \param dest the destination
+     * \return the index of the selected route, or the number of routes if none matches
+     */
+    uint32_t ScanRoutes(Ipv6Address dest) const;
+
+    /**
+     * \return a random address within 2001:db8::/32, with many bits set to zero so that
+     *         the addresses often match the random prefixes
+     */
+    Ipv6Address GetRandomAddress() const;
+
+    Ptr<Ipv6> m_ipv6;                    //!< IPv6 of the node
+    Ptr<Ipv6StaticRouting> m_routing;    //!< static routing of the node
+    Ptr<UniformRandomVariable> m_random; //!< random variable
+};
+
+Ipv6StaticRoutingLongestPrefixMatchTestCase::Ipv6StaticRoutingLongestPrefixMatchTestCase()
+    : TestCase("Longest prefix match of static IPv6 network routes")
+{
+}
+
+Ipv6Address
+Ipv6StaticRoutingLongestPrefixMatchTestCase::GetRandomAddress() const
+{
+    uint8_t bytes[16] = {0x20, 0x01, 0x0d, 0xb8};
+    for (uint8_t i = 4; i < 16; ++i)
+    {
+        bytes[i] = (i % 5 == 0) ? m_random->GetInteger(0, 3) : 0;
+    }
+    return Ipv6Address(bytes);
+}
+
+uint32_t
+Ipv6StaticRoutingLongestPrefixMatchTestCase::ScanRoutes(Ipv6Address dest) const
+{
+    uint32_t selected = m_routing->GetNRoutes();
+    uint16_t longestMask = 0;
+    uint32_t shortestMetric = 0xffffffff;
+    for (uint32_t i = 0; i < m_routing->GetNRoutes(); ++i)
+    {
+        auto route = m_routing->GetRoute(i);
+        auto metric = m_routing->GetMetric(i);
+        auto maskLen = route.GetDestNetworkPrefix().GetPrefixLength();
+        if (!route.GetDestNetworkPrefix().IsMatch(dest, route.GetDestNetwork()) ||
+            maskLen < longestMask)
+        {
+            continue;
+        }
+        if (maskLen > longestMask)
+        {
+            shortestMetric = 0xffffffff;
+        }
+        longestMask = maskLen;
+        if (metric > shortestMetric)
+        {
+            continue;
+        }
+        shortestMetric = metric;
+        selected = i;
+        if (maskLen == 128)
+        {
+            break;
+        }
+    }
+    return selected;
+}
+
+void
+Ipv6StaticRoutingLongestPrefixMatchTestCase::CheckRoutes(const std::string& stage)
+{
+    for (uint32_t i = 0; i < 2000; ++i)
+    {
+        // pick either a random address or the address of a route
+        auto dest = GetRandomAddress();
+        if (i % 4 == 0)
+        {
+            dest = m_routing
+                       ->GetRoute(m_random->GetInteger(0, m_routing->GetNRoutes() - 1))
+                       .GetDestNetwork();
+        }
+
+        Ipv6Header header;
+        header.SetDestination(dest);
+        Socket::SocketErrno sockerr;
+        auto route = m_routing->RouteOutput(Create<Packet>(), header, nullptr, sockerr);
+        auto expected = ScanRoutes(dest);
+
+        if (expected == m_routing->GetNRoutes())
+        {
+            NS_TEST_EXPECT_MSG_EQ(route, nullptr, stage << ": unexpected route to " << dest);
+            continue;
+        }
+        auto entry = m_routing->GetRoute(expected);
+        NS_TEST_ASSERT_MSG_NE(route, nullptr, stage << ": no route to " << dest);
+        NS_TEST_EXPECT_MSG_EQ(route->GetGateway(),
+                              entry.GetGateway(),
+                              stage << ": unexpected gateway to " << dest);
+        NS_TEST_EXPECT_MSG_EQ(route->GetOutputDevice(),
+                              m_ipv6->GetNetDevice(entry.GetInterface()),
+                              stage << ": unexpected output device to " << dest);
+    }
+}
+
+void
+Ipv6StaticRoutingLongestPrefixMatchTestCase::DoRun()
+{
+    Ptr<Node> node = CreateObject<Node>();
+    InternetStackHelper internet;
+    internet.SetIpv4StackInstall(false);
+    internet.Install(node);
+    m_ipv6 = node->GetObject<Ipv6>();
+
+    const uint32_t nInterfaces = 3;
+    for (uint32_t i = 1; i <= nInterfaces; ++i)
+    {
+        Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice>();
+        device->SetAddress(Mac48Address::Allocate());
+        node->AddDevice(device);
+        auto ifIndex = m_ipv6->AddInterface(device);
+        uint8_t bytes[16] = {0x20, 0x01, 0x0d, 0xb9, 0, static_cast<uint8_t>(i)};
+        bytes[15] = 1;
+        m_ipv6->AddAddress(ifIndex, Ipv6InterfaceAddress(Ipv6Address(bytes), Ipv6Prefix(64)));
+        m_ipv6->SetUp(ifIndex);
+    }
+
+    Ipv6StaticRoutingHelper helper;
+    m_routing = helper.GetStaticRouting(m_ipv6);
+    m_random = CreateObject<UniformRandomVariable>();
+    m_random->SetStream(1);
+
+    // overlapping routes within 2001:db8::/32, with few distinct metrics to have ties
+    for (uint32_t i = 0; i < 500; ++i)
+    {
+        Ipv6Prefix prefix(m_random->GetInteger(32, 128));
+        auto interface = m_random->GetInteger(1, nInterfaces);
+        uint8_t gateway[16] = {0xfe, 0x80};
+        gateway[14] = interface;
+        gateway[15] = i % 200 + 2;
+        m_routing->AddNetworkRouteTo(GetRandomAddress().CombinePrefix(prefix),
+                                     prefix,
+                                     Ipv6Address(gateway),
+                                     interface,
+                                     m_random->GetInteger(0, 2));
+    }
+    CheckRoutes("Initial routes");
+
+    for (uint32_t i = 0; i < 200; ++i)
+    {
+        m_routing->RemoveRoute(m_random->GetInteger(0, m_routing->GetNRoutes() - 1));
+    }
+    CheckRoutes("After removing routes");
+
+    m_ipv6->SetDown(2);
+    CheckRoutes("After bringing an interface down");
+
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief IPv6 StaticRouting TestSuite
+ */
+class Ipv6StaticRoutingTestSuite : public TestSuite
+{
+  public:
+    Ipv6StaticRoutingTestSuite();
+};
+
+Ipv6StaticRoutingTestSuite::Ipv6StaticRoutingTestSuite()
+    : TestSuite("ipv6-static-routing", Type::UNIT)
+{
+    AddTestCase(new Ipv6StaticRoutingLongestPrefixMatchTestCase, TestCase::Duration::QUICK);
+}
+
+static Ipv6StaticRoutingTestSuite
+    ipv6StaticRoutingTestSuite; //!< Static variable for test initialization
@@ -1210,6 +1210,80 @@ DynamicPartialTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup internet-test
+ *
+ * \brief Neighbor Cache Lookup by MAC Address Test
+ */
+class LookupInverseTest : public TestCase
+{
+  public:
+    void DoRun() override;
+    LookupInverseTest();
+};
+
+LookupInverseTest::LookupInverseTest()
+    : TestCase("The LookupInverseTest checks that the entries of a MAC address are found after "
+               "the MAC address of entries is changed and entries are removed.")
+{
+}
+
+void
+LookupInverseTest::DoRun()
+{
+    Mac48Address mac1("00:00:00:00:00:01");
+    Mac48Address mac2("00:00:00:00:00:02");
+
+    Ptr<ArpCache> arpCache = CreateObject<ArpCache>();
+    ArpCache::Entry* arpEntry1 = arpCache->Add(Ipv4Address("10.1.1.1"));
+    arpEntry1->SetMacAddress(mac1);
+    arpEntry1->MarkAutoGenerated();
+    ArpCache::Entry* arpEntry2 = arpCache->Add(Ipv4Address("10.1.1.2"));
+    arpEntry2->SetMacAddress(mac1);
+    arpEntry2->MarkPermanent();
+    ArpCache::Entry* arpEntry3 = arpCache->Add(Ipv4Address("10.1.1.3"));
+    arpEntry3->SetMacAddress(mac2);
+    arpEntry3->MarkPermanent();
+    NS_TEST_EXPECT_MSG_EQ(arpCache->LookupInverse(mac1).size(), 2, "Wrong ARP entries");
+    NS_TEST_EXPECT_MSG_EQ(arpCache->LookupInverse(mac2).size(), 1, "Wrong ARP entries");
+
+    arpEntry3->SetMacAddress(mac1);
+    NS_TEST_EXPECT_MSG_EQ(arpCache->LookupInverse(mac1).size(), 3, "Wrong ARP entries");
+    NS_TEST_EXPECT_MSG_EQ(arpCache->LookupInverse(mac2).size(), 0, "Wrong ARP entries");
+
+    arpCache->Remove(arpEntry2);
+    arpCache->RemoveAutoGeneratedEntries();
+    auto arpEntries = arpCache->LookupInverse(mac1);
+    NS_TEST_ASSERT_MSG_EQ(arpEntries.size(), 1, "Wrong ARP entries");
+    NS_TEST_EXPECT_MSG_EQ(arpEntries.front(), arpEntry3, "Wrong ARP entry");
+    NS_TEST_EXPECT_MSG_EQ(arpCache->Lookup(Ipv4Address("10.1.1.2")), nullptr, "Entry not removed");
+    arpCache->Dispose();
+
+    Ptr<NdiscCache> ndiscCache = CreateObject<NdiscCache>();
+    NdiscCache::Entry* ndiscEntry1 = ndiscCache->Add(Ipv6Address("2001::1"));
+    ndiscEntry1->SetMacAddress(mac1);
+    ndiscEntry1->MarkAutoGenerated();
+    NdiscCache::Entry* ndiscEntry2 = ndiscCache->Add(Ipv6Address("2001::2"));
+    ndiscEntry2->SetMacAddress(mac1);
+    ndiscEntry2->MarkPermanent();
+    NdiscCache::Entry* ndiscEntry3 = ndiscCache->Add(Ipv6Address("2001::3"));
+    ndiscEntry3->MarkStale(mac2);
+    NS_TEST_EXPECT_MSG_EQ(ndiscCache->LookupInverse(mac1).size(), 2, "Wrong NDISC entries");
+    NS_TEST_EXPECT_MSG_EQ(ndiscCache->LookupInverse(mac2).size(), 1, "Wrong NDISC entries");
+
+    ndiscEntry3->MarkReachable(mac1);
+    NS_TEST_EXPECT_MSG_EQ(ndiscCache->LookupInverse(mac1).size(), 3, "Wrong NDISC entries");
+    NS_TEST_EXPECT_MSG_EQ(ndiscCache->LookupInverse(mac2).size(), 0, "Wrong NDISC entries");
+
+    ndiscCache->Remove(ndiscEntry2);
+    ndiscCache->RemoveAutoGeneratedEntries();
+    auto ndiscEntries = ndiscCache->LookupInverse(mac1);
+    NS_TEST_ASSERT_MSG_EQ(ndiscEntries.size(), 1, "Wrong NDISC entries");
+    NS_TEST_EXPECT_MSG_EQ(ndiscEntries.front(), ndiscEntry3, "Wrong NDISC entry");
+    NS_TEST_EXPECT_MSG_EQ(ndiscCache->Lookup(Ipv6Address("2001::2")), nullptr, "Entry not removed");
+    ndiscCache->Dispose();
+}
+
 /**
  * \ingroup internet-test
  *
@@ -1228,6 +1302,7 @@ class NeighborCacheTestSuite : public TestSuite
         AddTestCase(new FlushTest, TestCase::Duration::QUICK);
         AddTestCase(new DuplicateTest, TestCase::Duration::QUICK);
         AddTestCase(new DynamicPartialTest, TestCase::Duration::QUICK);
+        AddTestCase(new LookupInverseTest, TestCase::Duration::QUICK);
     }
 };
 
@@ -0,0 +1,189 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/double.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device-helper.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/tcp-cubic.h"
+#include "ns3/tcp-fluid-model.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief TcpFluidModel Test
+ *
+ * Two fluid flows share a link, one of them added with its path and the other one from
+ * the routes of its source. Both of them experience loss events and get the same rate,
+ * and together they use most of the share of the link left to them. With packets
+ * transmitted on the link at a constant rate, the fluid flows only use the remaining
+ * capacity.
+ */
+class TcpFluidModelTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param foregroundRate the rate of the packets transmitted on the link
+     * \param congestionControl the congestion control of the fluid flows
+     */
+    TcpFluidModelTestCase(DataRate foregroundRate, TypeId congestionControl);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Send a foreground packet and schedule the next one.
+     * \param device the device sending the packet
+     */
+    void SendPacket(Ptr<NetDevice> device);
+
+    /**
+     * \brief Receive a foreground packet.
+     * \param device the receiving device
+     * \param packet the packet
+     * \param protocol the protocol
+     * \param from the sender address
+     * \return true
+     */
+    bool ReceivePacket(Ptr<NetDevice> device,
+                       Ptr<const Packet> packet,
+                       uint16_t protocol,
+                       const Address& from);
+
+    DataRate m_foregroundRate;   //!< Rate of the foreground packets
+    TypeId m_congestionControl;  //!< Congestion control of the fluid flows
+    uint64_t m_receivedBytes{0}; //!< Bytes of the foreground packets received
+};
+
+TcpFluidModelTestCase::TcpFluidModelTestCase(DataRate foregroundRate, TypeId congestionControl)
+    : TestCase("Fluid " + congestionControl.GetName() + " flows with " +
+               std::to_string(foregroundRate.GetBitRate() / 1000000) + "Mbps of packets"),
+      m_foregroundRate(foregroundRate),
+      m_congestionControl(congestionControl)
+{
+}
+
+void
+TcpFluidModelTestCase::SendPacket(Ptr<NetDevice> device)
+{
+    const uint32_t size = 1000;
+    device->Send(Create<Packet>(size), device->GetBroadcast(), 0x800);
+    Simulator::Schedule(m_foregroundRate.CalculateBytesTxTime(size),
+                        &TcpFluidModelTestCase::SendPacket,
+                        this,
+                        device);
+}
+
+bool
+TcpFluidModelTestCase::ReceivePacket(Ptr<NetDevice> device,
+                                     Ptr<const Packet> packet,
+                                     uint16_t protocol,
+                                     const Address& from)
+{
+    m_receivedBytes += packet->GetSize();
+    return true;
+}
+
+void
+TcpFluidModelTestCase::DoRun()
+{
+    NodeContainer nodes;
+    nodes.Create(2);
+    SimpleNetDeviceHelper helper;
+    helper.SetNetDevicePointToPointMode(true);
+    helper.SetDeviceAttribute("DataRate", DataRateValue(DataRate("10Mb/s")));
+    helper.SetQueue("ns3::DropTailQueue", "MaxSize", StringValue("1000p"));
+    NetDeviceContainer devices = helper.Install(nodes);
+
+    const double maxLinkShare = 0.95;
+    const Time duration = Seconds(60);
+    auto model = CreateObject<TcpFluidModel>();
+    model->SetAttribute("MaxLinkShare", DoubleValue(maxLinkShare));
+    model->SetFlowAttribute("CongestionControl", TypeIdValue(m_congestionControl));
+
+    if (m_foregroundRate.GetBitRate() == 0)
+    {
+        InternetStackHelper internet;
+        internet.Install(nodes);
+        Ipv4AddressHelper ipv4;
+        ipv4.SetBase("10.1.1.0", "255.255.255.0");
+        auto interfaces = ipv4.Assign(devices);
+
+        model->AddFlow({devices.Get(0)});
+        auto flow = model->AddFlow(nodes.Get(0), interfaces.GetAddress(1));
+        NS_TEST_ASSERT_MSG_EQ(flow->GetPath().size(), 1, "Unexpected path length");
+        NS_TEST_ASSERT_MSG_EQ(flow->GetPath()[0], devices.Get(0), "Unexpected path");
+    }
+    else
+    {
+        model->AddFlow({devices.Get(0)});
+        model->AddFlow({devices.Get(0)});
+        devices.Get(1)->SetReceiveCallback(
+            MakeCallback(&TcpFluidModelTestCase::ReceivePacket, this));
+        Simulator::Schedule(Seconds(0), &TcpFluidModelTestCase::SendPacket, this, devices.Get(0));
+    }
+    model->Start(Seconds(0));
+    model->Stop(duration);
+    Simulator::Stop(duration);
+    Simulator::Run();
+
+    double capacity = maxLinkShare * 10e6 - m_foregroundRate.GetBitRate();
+    double total = 0;
+    for (std::size_t i = 0; i < model->GetNFlows(); ++i)
+    {
+        auto flow = model->GetFlow(i);
+        NS_TEST_EXPECT_MSG_GT(flow->GetNLossEvents(), 1, "Flow " << i << " was never congested");
+        NS_TEST_EXPECT_MSG_EQ(flow->GetTotalBytes(),
+                              model->GetFlow(0)->GetTotalBytes(),
+                              "The flows did not get the same rate");
+        total += flow->GetTotalBytes() * 8 / duration.GetSeconds();
+    }
+    // the share left by the packets is measured, allow for its variations
+    NS_TEST_EXPECT_MSG_LT_OR_EQ(total, capacity + 0.01e6, "The flows used more than their share");
+    NS_TEST_EXPECT_MSG_GT(total, capacity / 2, "The flows used too little of their share");
+    if (m_foregroundRate.GetBitRate() > 0)
+    {
+        NS_TEST_EXPECT_MSG_GT(m_receivedBytes * 8 / duration.GetSeconds(),
+                              0.95 * m_foregroundRate.GetBitRate(),
+                              "The packets did not get their rate");
+    }
+
+    DataRateValue background;
+    devices.Get(0)->GetAttribute("BackgroundDataRate", background);
+    NS_TEST_EXPECT_MSG_EQ(background.Get(), DataRate(0), "The capacity was not released");
+
+    model->Dispose();
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief TcpFluidModel TestSuite
+ */
+class TcpFluidModelTestSuite : public TestSuite
+{
+  public:
+    TcpFluidModelTestSuite()
+        : TestSuite("tcp-fluid-model", Type::UNIT)
+    {
+        AddTestCase(new TcpFluidModelTestCase(DataRate(0), TcpNewReno::GetTypeId()),
+                    TestCase::Duration::QUICK);
+        AddTestCase(new TcpFluidModelTestCase(DataRate(0), TcpCubic::GetTypeId()),
+                    TestCase::Duration::QUICK);
+        AddTestCase(new TcpFluidModelTestCase(DataRate("5Mb/s"), TcpNewReno::GetTypeId()),
+                    TestCase::Duration::QUICK);
+    }
+};
+
+static TcpFluidModelTestSuite g_tcpFluidModelTestSuite; //!< Static variable for test initialization
@@ -31,6 +31,11 @@ class TcpRxBufferTestCase : public TestCase
      * \brief Test the SACK list update.
      */
     void TestUpdateSACKList();
+
+    /**
+     * \brief Test the reassembly of many out of order segments.
+     */
+    void TestManyHoles();
 };
 
 TcpRxBufferTestCase::TcpRxBufferTestCase()
@@ -42,6 +47,7 @@ void
 TcpRxBufferTestCase::DoRun()
 {
     TestUpdateSACKList();
+    TestManyHoles();
 }
 
 void
@@ -277,6 +283,79 @@ TcpRxBufferTestCase::TestUpdateSACKList()
     NS_TEST_ASSERT_MSG_EQ(sackList.size(), 0, "SACK list should contain no element");
 }
 
+void
+TcpRxBufferTestCase::TestManyHoles()
+{
+    TcpRxBuffer rxBuf;
+    rxBuf.SetMaxBufferSize(1 << 20);
+    rxBuf.SetNextRxSequence(SequenceNumber32(1));
+    Ptr<Packet> p = Create<Packet>(100);
+    TcpHeader h;
+    const uint32_t nSegments = 1000;
+    auto start = [](uint32_t i) { return SequenceNumber32(1 + i * 100); };
+
+    // every other segment is lost
+    for (uint32_t i = 1; i < nSegments; i += 2)
+    {
+        h.SetSequenceNumber(start(i));
+        rxBuf.Add(p, h);
+    }
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.NextRxSequence(), start(0), "Unexpected sequence number");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Size(), nSegments / 2 * 100, "Unexpected buffer size");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Available(), 0, "Unexpected available data");
+    auto sackList = rxBuf.GetSackList();
+    NS_TEST_ASSERT_MSG_EQ(sackList.size(), 4, "SACK list should contain four element");
+    NS_TEST_ASSERT_MSG_EQ(sackList.front().first, start(999), "Unexpected first SACK block");
+
+    // the first block contains the blocks merged with the new segment, even when
+    // they are not in the SACK list anymore
+    h.SetSequenceNumber(start(2));
+    rxBuf.Add(p, h);
+    sackList = rxBuf.GetSackList();
+    NS_TEST_ASSERT_MSG_EQ(sackList.size(), 4, "SACK list should contain four element");
+    NS_TEST_ASSERT_MSG_EQ(sackList.front().first, start(1), "Unexpected first SACK block");
+    NS_TEST_ASSERT_MSG_EQ(sackList.front().second, start(4), "Unexpected first SACK block");
+
+    // a segment overlapping the segment 5 fills the holes around it
+    h.SetSequenceNumber(start(4));
+    rxBuf.Add(Create<Packet>(300), h);
+    sackList = rxBuf.GetSackList();
+    NS_TEST_ASSERT_MSG_EQ(sackList.size(), 4, "SACK list should contain four element");
+    NS_TEST_ASSERT_MSG_EQ(sackList.front().first, start(1), "Unexpected first SACK block");
+    NS_TEST_ASSERT_MSG_EQ(sackList.front().second, start(8), "Unexpected first SACK block");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Size(), nSegments / 2 * 100 + 300, "Unexpected buffer size");
+
+    // the first hole is filled
+    h.SetSequenceNumber(start(0));
+    rxBuf.Add(p, h);
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.NextRxSequence(), start(8), "Unexpected sequence number");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Available(), 800, "Unexpected available data");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.GetSackListSize(), 3, "SACK list should contain three element");
+    Ptr<Packet> extracted = rxBuf.Extract(1000);
+    NS_TEST_ASSERT_MSG_NE(extracted, nullptr, "Nothing extracted");
+    NS_TEST_ASSERT_MSG_EQ(extracted->GetSize(), 800, "Unexpected extracted size");
+
+    // the remaining holes are filled, from the last one
+    for (uint32_t i = nSegments - 2; i >= 8; i -= 2)
+    {
+        h.SetSequenceNumber(start(i));
+        rxBuf.Add(p, h);
+        if (i > 8)
+        {
+            sackList = rxBuf.GetSackList();
+            NS_TEST_ASSERT_MSG_EQ(sackList.front().first,
+                                  start(i - 1),
+                                  "Unexpected first SACK block");
+            NS_TEST_ASSERT_MSG_EQ(sackList.front().second,
+                                  start(nSegments),
+                                  "Unexpected first SACK block");
+        }
+    }
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.NextRxSequence(), start(nSegments), "Unexpected sequence number");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Available(), (nSegments - 8) * 100, "Unexpected available data");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.GetSackListSize(), 0, "SACK list should contain no element");
+}
+
 void
 TcpRxBufferTestCase::DoTeardown()
 {
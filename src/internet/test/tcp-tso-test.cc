@@ -0,0 +1,218 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/inet-socket-address.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/simple-net-device-helper.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/simulator.h"
+#include "ns3/socket.h"
+#include "ns3/string.h"
+#include "ns3/tcp-socket-factory.h"
+#include "ns3/test.h"
+#include "ns3/tso-tag.h"
+#include "ns3/uinteger.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief TCP segmentation offload Test
+ *
+ * The same bulk transfer is run without and with segmentation offload. With segmentation
+ * offload, the sender transmits far fewer packets, and the transfer completes in about the
+ * same time, since the packets carrying several segments take the time needed to transmit
+ * all of them.
+ */
+class TcpTsoTestCase : public TestCase
+{
+  public:
+    TcpTsoTestCase();
+
+  private:
+    void DoRun() override;
+
+    /// Results of a transfer
+    struct Transfer
+    {
+        uint64_t receivedBytes{0}; //!< Bytes received
+        uint32_t txPackets{0};     //!< Packets transmitted by the sender device
+        uint32_t tsoPackets{0};    //!< Packets carrying several segments
+        Time lastRx;               //!< Time of the last reception
+    };
+
+    /**
+     * \brief Run a bulk transfer.
+     * \param tsoMaxSegments the max number of segments sent as a single packet
+     * \return the results of the transfer
+     */
+    Transfer RunTransfer(uint32_t tsoMaxSegments);
+
+    /**
+     * \brief Send data.
+     * \param socket the sending socket
+     * \param available the space available in the send buffer
+     */
+    void SendData(Ptr<Socket> socket, uint32_t available);
+
+    /**
+     * \brief Accept a connection.
+     * \param socket the accepted socket
+     * \param from the address of the peer
+     */
+    void Accept(Ptr<Socket> socket, const Address& from);
+
+    /**
+     * \brief Receive data.
+     * \param socket the receiving socket
+     */
+    void ReceiveData(Ptr<Socket> socket);
+
+    /**
+     * \brief Count a packet transmitted by the sender device.
+     * \param packet the packet
+     */
+    void CountTx(Ptr<const Packet> packet);
+
+    const uint32_t m_totalBytes{2000000}; //!< Bytes to transfer
+    uint32_t m_sentBytes{0};              //!< Bytes sent by the application
+    Transfer m_transfer;                  //!< Results of the current transfer
+};
+
+TcpTsoTestCase::TcpTsoTestCase()
+    : TestCase("TCP bulk transfer with and without segmentation offload")
+{
+}
+
+void
+TcpTsoTestCase::SendData(Ptr<Socket> socket, uint32_t available)
+{
+    while (m_sentBytes < m_totalBytes && socket->GetTxAvailable() > 0)
+    {
+        uint32_t size = std::min(m_totalBytes - m_sentBytes, socket->GetTxAvailable());
+        int sent = socket->Send(Create<Packet>(size));
+        if (sent <= 0)
+        {
+            break;
+        }
+        m_sentBytes += sent;
+    }
+}
+
+void
+TcpTsoTestCase::Accept(Ptr<Socket> socket, const Address& from)
+{
+    socket->SetRecvCallback(MakeCallback(&TcpTsoTestCase::ReceiveData, this));
+}
+
+void
+TcpTsoTestCase::ReceiveData(Ptr<Socket> socket)
+{
+    while (Ptr<Packet> packet = socket->Recv())
+    {
+        m_transfer.receivedBytes += packet->GetSize();
+        m_transfer.lastRx = Simulator::Now();
+    }
+}
+
+void
+TcpTsoTestCase::CountTx(Ptr<const Packet> packet)
+{
+    ++m_transfer.txPackets;
+    TsoTag tsoTag;
+    if (packet->PeekPacketTag(tsoTag))
+    {
+        ++m_transfer.tsoPackets;
+        NS_TEST_EXPECT_MSG_GT(tsoTag.GetNSegments(), 1, "Unexpected number of segments");
+    }
+}
+
+TcpTsoTestCase::Transfer
+TcpTsoTestCase::RunTransfer(uint32_t tsoMaxSegments)
+{
+    m_sentBytes = 0;
+    m_transfer = Transfer();
+
+    NodeContainer nodes;
+    nodes.Create(2);
+    SimpleNetDeviceHelper helper;
+    helper.SetNetDevicePointToPointMode(true);
+    helper.SetDeviceAttribute("DataRate", DataRateValue(DataRate("100Mb/s")));
+    helper.SetChannelAttribute("Delay", TimeValue(MilliSeconds(5)));
+    helper.SetQueue("ns3::DropTailQueue", "MaxSize", StringValue("1000p"));
+    NetDeviceContainer devices = helper.Install(nodes);
+    for (uint32_t i = 0; i < devices.GetN(); ++i)
+    {
+        devices.Get(i)->SetMtu(1500);
+    }
+    devices.Get(0)->TraceConnectWithoutContext("PhyTxEnd",
+                                               MakeCallback(&TcpTsoTestCase::CountTx, this));
+
+    InternetStackHelper internet;
+    internet.Install(nodes);
+    Ipv4AddressHelper ipv4;
+    ipv4.SetBase("10.1.1.0", "255.255.255.0");
+    auto interfaces = ipv4.Assign(devices);
+
+    const uint16_t port = 50000;
+    Ptr<Socket> server = Socket::CreateSocket(nodes.Get(1), TcpSocketFactory::GetTypeId());
+    server->SetAttribute("SegmentSize", UintegerValue(1448));
+    server->Bind(InetSocketAddress(Ipv4Address::GetAny(), port));
+    server->Listen();
+    server->SetAcceptCallback(MakeNullCallback<bool, Ptr<Socket>, const Address&>(),
+                              MakeCallback(&TcpTsoTestCase::Accept, this));
+
+    Ptr<Socket> source = Socket::CreateSocket(nodes.Get(0), TcpSocketFactory::GetTypeId());
+    source->SetAttribute("SegmentSize", UintegerValue(1448));
+    source->SetAttribute("TsoMaxSegments", UintegerValue(tsoMaxSegments));
+    source->SetSendCallback(MakeCallback(&TcpTsoTestCase::SendData, this));
+    InetSocketAddress remote(interfaces.GetAddress(1), port);
+    Simulator::Schedule(MilliSeconds(1), [this, source, remote]() {
+        source->Connect(remote);
+        SendData(source, source->GetTxAvailable());
+    });
+
+    Simulator::Stop(Seconds(10));
+    Simulator::Run();
+    Simulator::Destroy();
+    return m_transfer;
+}
+
+void
+TcpTsoTestCase::DoRun()
+{
+    Transfer segments = RunTransfer(1);
+    Transfer tso = RunTransfer(16);
+
+    NS_TEST_ASSERT_MSG_EQ(segments.receivedBytes, m_totalBytes, "Transfer not completed");
+    NS_TEST_ASSERT_MSG_EQ(tso.receivedBytes, m_totalBytes, "Transfer not completed with TSO");
+    NS_TEST_EXPECT_MSG_EQ(segments.tsoPackets, 0, "Several segments sent without TSO");
+    NS_TEST_EXPECT_MSG_GT(tso.tsoPackets, 0, "No segments sent as a single packet");
+    NS_TEST_EXPECT_MSG_LT(tso.txPackets * 4,
+                          segments.txPackets,
+                          "TSO did not reduce the number of packets");
+    NS_TEST_EXPECT_MSG_EQ_TOL(tso.lastRx.GetSeconds(),
+                              segments.lastRx.GetSeconds(),
+                              0.1 * segments.lastRx.GetSeconds(),
+                              "TSO changed the transfer time");
+}
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief TCP segmentation offload TestSuite
+ */
+class TcpTsoTestSuite : public TestSuite
+{
+  public:
+    TcpTsoTestSuite()
+        : TestSuite("tcp-tso", Type::UNIT)
+    {
+        AddTestCase(new TcpTsoTestCase(), TestCase::Duration::QUICK);
+    }
+};
+
+static TcpTsoTestSuite g_tcpTsoTestSuite; //!< Static variable for test initialization
@@ -42,6 +42,8 @@ class TcpTxBufferTestCase : public TestCase
     /** \brief Test the logic of merging items in GetTransmittedSegment()
      * which is triggered by CopyFromSequence()*/
     void TestMergeItemsWhenGetTransmittedSegment();
+    /** \brief Test the scoreboard of a large window during a SACK recovery */
+    void TestLargeWindowRecovery();
     /**
      * \brief Callback to provide a value of receiver window
      * \returns the receiver window size
@@ -88,6 +90,7 @@ TcpTxBufferTestCase::DoRun()
     Simulator::Schedule(Seconds(0.0),
                         &TcpTxBufferTestCase::TestMergeItemsWhenGetTransmittedSegment,
                         this);
+    Simulator::Schedule(Seconds(0.0), &TcpTxBufferTestCase::TestLargeWindowRecovery, this);
 
     Simulator::Run();
     Simulator::Destroy();
@@ -409,6 +412,70 @@ TcpTxBufferTestCase::TestMergeItemsWhenGetTransmittedSegment()
     txBuf.CopyFromSequence(2000, SequenceNumber32(1));
 }
 
+void
+TcpTxBufferTestCase::TestLargeWindowRecovery()
+{
+    Ptr<TcpTxBuffer> txBuf = CreateObject<TcpTxBuffer>();
+    txBuf->SetRWndCallback(MakeCallback(&TcpTxBufferTestCase::GetRWnd, this));
+    txBuf->SetHeadSequence(SequenceNumber32(1));
+    txBuf->SetSegmentSize(100);
+    txBuf->SetDupAckThresh(3);
+
+    const uint32_t nSegments = 2000;
+    auto start = [](uint32_t i) { return SequenceNumber32(1 + i * 100); };
+    txBuf->SetMaxBufferSize(nSegments * 100);
+    NS_TEST_ASSERT_MSG_EQ(txBuf->Add(Create<Packet>(nSegments * 100)), true, "Data not added");
+    for (uint32_t i = 0; i < nSegments; ++i)
+    {
+        txBuf->CopyFromSequence(100, start(i));
+    }
+
+    // every other segment is received, and sacked in order
+    for (uint32_t i = 1; i < nSegments; i += 2)
+    {
+        Ptr<TcpOptionSack> sack = CreateObject<TcpOptionSack>();
+        sack->AddSackBlock(TcpOptionSack::SackBlock(start(i), start(i + 1)));
+        txBuf->Update(sack->GetSackList());
+    }
+
+    // the missing segments with at least three sacked segments above are lost
+    const uint32_t nLost = (nSegments - 6) / 2 + 1;
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetSacked(), nSegments / 2 * 100, "Unexpected sacked bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetLost(), nLost * 100, "Unexpected lost bytes");
+    for (uint32_t i = 0; i < nSegments; ++i)
+    {
+        NS_TEST_ASSERT_MSG_EQ(txBuf->IsLost(start(i) + 50),
+                              (i % 2 == 0 && i < nSegments - 5),
+                              "Unexpected loss state of segment " << i);
+    }
+
+    // the lost segments are retransmitted in order, then the first one not lost
+    SequenceNumber32 seq;
+    SequenceNumber32 seqHigh;
+    for (uint32_t i = 0; i < nLost; ++i)
+    {
+        NS_TEST_ASSERT_MSG_EQ(txBuf->NextSeg(&seq, &seqHigh, true), true, "No next segment");
+        NS_TEST_ASSERT_MSG_EQ(seq, start(2 * i), "Unexpected next segment");
+        txBuf->CopyFromSequence(100, seq);
+    }
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetRetransmitsCount(),
+                          nLost * 100,
+                          "Unexpected retransmitted bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->NextSeg(&seq, &seqHigh, true), true, "No next segment");
+    NS_TEST_ASSERT_MSG_EQ(seq, start(nSegments - 4), "Unexpected segment per rule 3");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->NextSeg(&seq, &seqHigh, false), false, "Unexpected segment");
+
+    // the first half is acknowledged
+    txBuf->DiscardUpTo(start(nSegments / 2));
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetSacked(), nSegments / 4 * 100, "Unexpected sacked bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetLost(),
+                          (nLost - nSegments / 4) * 100,
+                          "Unexpected lost bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->IsLost(start(nSegments / 2)), true, "Head is not lost");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->NextSeg(&seq, &seqHigh, true), true, "No next segment");
+    NS_TEST_ASSERT_MSG_EQ(seq, start(nSegments - 4), "Unexpected segment per rule 3");
+}
+
 void
 TcpTxBufferTestCase::TestTransmittedBlock()
 {
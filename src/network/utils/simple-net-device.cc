@@ -10,7 +10,9 @@
 #include "error-model.h"
 #include "queue.h"
 #include "simple-channel.h"
+#include "tso-tag.h"
 
+#include "ns3/abort.h"
 #include "ns3/boolean.h"
 #include "ns3/log.h"
 #include "ns3/node.h"
@@ -202,6 +204,18 @@ SimpleNetDevice::GetTypeId()
                           DataRateValue(DataRate("0b/s")),
                           MakeDataRateAccessor(&SimpleNetDevice::m_bps),
                           MakeDataRateChecker())
+            .AddAttribute("BackgroundDataRate",
+                          "The data rate used by background traffic which is not modeled "
+                          "as packets (e.g., fluid flows). The packets are transmitted at "
+                          "the remaining data rate. Ignored if the data rate is infinite.",
+                          DataRateValue(DataRate("0b/s")),
+                          MakeDataRateAccessor(&SimpleNetDevice::m_backgroundBps),
+                          MakeDataRateChecker())
+            .AddTraceSource("PhyTxEnd",
+                            "Trace source indicating a packet has been "
+                            "completely transmitted over the channel",
+                            MakeTraceSourceAccessor(&SimpleNetDevice::m_phyTxEndTrace),
+                            "ns3::Packet::TracedCallback")
             .AddTraceSource("PhyRxDrop",
                             "Trace source indicating a packet has been dropped "
                             "by the device during reception",
@@ -422,7 +436,8 @@ SimpleNetDevice::SendFrom(Ptr<Packet> p,
                           uint16_t protocolNumber)
 {
     NS_LOG_FUNCTION(this << p << source << dest << protocolNumber);
-    if (p->GetSize() > GetMtu())
+    TsoTag tsoTag;
+    if (p->GetSize() > GetMtu() && !p->PeekPacketTag(tsoTag))
     {
         return false;
     }
@@ -474,7 +489,14 @@ SimpleNetDevice::StartTransmission()
     Time txTime = Time(0);
     if (m_bps > DataRate(0))
     {
-        txTime = m_bps.CalculateBytesTxTime(packet->GetSize());
+        NS_ABORT_MSG_IF(m_backgroundBps >= m_bps,
+                        "The background data rate " << m_backgroundBps
+                                                    << " leaves no room to transmit packets");
+        TsoTag tsoTag;
+        uint32_t size = packet->PeekPacketTag(tsoTag) ? tsoTag.GetWireSize(packet->GetSize())
+                                                      : packet->GetSize();
+        txTime =
+            DataRate(m_bps.GetBitRate() - m_backgroundBps.GetBitRate()).CalculateBytesTxTime(size);
     }
     FinishTransmissionEvent =
         Simulator::Schedule(txTime, &SimpleNetDevice::FinishTransmission, this, packet);
@@ -493,6 +515,7 @@ SimpleNetDevice::FinishTransmission(Ptr<Packet> packet)
     uint16_t proto = tag.GetProto();
 
     m_channel->Send(packet, proto, dst, src, this);
+    m_phyTxEndTrace(packet);
 
     StartTransmission();
 }
@@ -150,6 +150,14 @@ class SimpleNetDevice : public NetDevice
      */
     TracedCallback<Ptr<const Packet>> m_phyRxDropTrace;
 
+    /**
+     * The trace source fired when a packet ends the transmission process on
+     * the medium.
+     *
+     * \see class CallBackTraceSource
+     */
+    TracedCallback<Ptr<const Packet>> m_phyTxEndTrace;
+
     /**
      * The StartTransmission method is used internally to start the process
      * of sending a packet out on the channel, by scheduling the
@@ -175,6 +183,7 @@ class SimpleNetDevice : public NetDevice
 
     Ptr<Queue<Packet>> m_queue;      //!< The Queue for outgoing packets.
     DataRate m_bps;                  //!< The device nominal Data rate. Zero means infinite
+    DataRate m_backgroundBps;        //!< The data rate used by background traffic
     EventId FinishTransmissionEvent; //!< the Tx Complete event
 
     /**
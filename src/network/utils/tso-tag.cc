@@ -0,0 +1,100 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "tso-tag.h"
+
+#include "ns3/log.h"
+
+#include <algorithm>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("TsoTag");
+
+NS_OBJECT_ENSURE_REGISTERED(TsoTag);
+
+TypeId
+TsoTag::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::TsoTag")
+                            .SetParent<Tag>()
+                            .SetGroupName("Network")
+                            .AddConstructor<TsoTag>();
+    return tid;
+}
+
+TypeId
+TsoTag::GetInstanceTypeId() const
+{
+    return GetTypeId();
+}
+
+uint32_t
+TsoTag::GetSerializedSize() const
+{
+    return 8;
+}
+
+void
+TsoTag::Serialize(TagBuffer buf) const
+{
+    buf.WriteU32(m_payloadSize);
+    buf.WriteU32(m_segmentSize);
+}
+
+void
+TsoTag::Deserialize(TagBuffer buf)
+{
+    m_payloadSize = buf.ReadU32();
+    m_segmentSize = buf.ReadU32();
+}
+
+void
+TsoTag::Print(std::ostream& os) const
+{
+    os << "PayloadSize=" << m_payloadSize << " SegmentSize=" << m_segmentSize;
+}
+
+TsoTag::TsoTag()
+    : Tag()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+TsoTag::TsoTag(uint32_t payloadSize, uint32_t segmentSize)
+    : Tag(),
+      m_payloadSize(payloadSize),
+      m_segmentSize(segmentSize)
+{
+    NS_LOG_FUNCTION(this << payloadSize << segmentSize);
+    NS_ASSERT_MSG(segmentSize > 0, "The segment size must be positive");
+}
+
+uint32_t
+TsoTag::GetPayloadSize() const
+{
+    return m_payloadSize;
+}
+
+uint32_t
+TsoTag::GetSegmentSize() const
+{
+    return m_segmentSize;
+}
+
+uint32_t
+TsoTag::GetNSegments() const
+{
+    return std::max<uint32_t>(1, (m_payloadSize + m_segmentSize - 1) / m_segmentSize);
+}
+
+uint32_t
+TsoTag::GetWireSize(uint32_t packetSize) const
+{
+    NS_ASSERT_MSG(packetSize >= m_payloadSize, "The packet is smaller than its payload");
+    return packetSize + (GetNSegments() - 1) * (packetSize - m_payloadSize);
+}
+
+} // namespace ns3
@@ -0,0 +1,86 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef TSO_TAG_H
+#define TSO_TAG_H
+
+#include "ns3/tag.h"
+
+namespace ns3
+{
+
+/**
+ * \ingroup network
+ *
+ * \brief Tag of a packet carrying several transport segments at once.
+ *
+ * A transport protocol performing segmentation offload (e.g., TCP with the
+ * TsoMaxSegments attribute) may send the payload of several consecutive
+ * segments of up to a given size as a single packet. The packet carries the
+ * headers of the first segment only, and this tag.
+ *
+ * The packet crosses the protocol stacks and the queues as a single packet,
+ * while the devices supporting the tag transmit it during the time needed to
+ * transmit all its segments, every segment carrying its own copy of the
+ * headers. Hence, the packet is received when the last segment would have
+ * been, and the receiver processes the segments at once, as if they were
+ * coalesced by its device (i.e., generic receive offload).
+ */
+class TsoTag : public Tag
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+    TypeId GetInstanceTypeId() const override;
+    uint32_t GetSerializedSize() const override;
+    void Serialize(TagBuffer buf) const override;
+    void Deserialize(TagBuffer buf) override;
+    void Print(std::ostream& os) const override;
+    TsoTag();
+
+    /**
+     * Constructs a TsoTag
+     *
+     * \param payloadSize the size of the payload of all the segments
+     * \param segmentSize the maximum size of the payload of a segment
+     */
+    TsoTag(uint32_t payloadSize, uint32_t segmentSize);
+
+    /**
+     * \return the size of the payload of all the segments
+     */
+    uint32_t GetPayloadSize() const;
+
+    /**
+     * \return the maximum size of the payload of a segment
+     */
+    uint32_t GetSegmentSize() const;
+
+    /**
+     * \return the number of segments carried by the packet
+     */
+    uint32_t GetNSegments() const;
+
+    /**
+     * \brief Get the number of bytes transmitted for the segments of a packet.
+     *
+     * The bytes of the packet which are not part of the payload (i.e., the headers
+     * and trailers, including the ones of the device) are repeated for every segment.
+     *
+     * \param packetSize the size of the packet carrying the tag
+     * \return the number of bytes transmitted for all the segments
+     */
+    uint32_t GetWireSize(uint32_t packetSize) const;
+
+  private:
+    uint32_t m_payloadSize{0}; //!< Size of the payload of all the segments
+    uint32_t m_segmentSize{0}; //!< Maximum size of the payload of a segment
+};
+
+} // namespace ns3
+
+#endif /* TSO_TAG_H */
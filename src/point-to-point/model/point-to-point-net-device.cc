@@ -9,6 +9,7 @@
 #include "point-to-point-channel.h"
 #include "ppp-header.h"
 
+#include "ns3/abort.h"
 #include "ns3/error-model.h"
 #include "ns3/llc-snap-header.h"
 #include "ns3/log.h"
@@ -17,6 +18,7 @@
 #include "ns3/queue.h"
 #include "ns3/simulator.h"
 #include "ns3/trace-source-accessor.h"
+#include "ns3/tso-tag.h"
 #include "ns3/uinteger.h"
 
 namespace ns3
@@ -50,6 +52,13 @@ PointToPointNetDevice::GetTypeId()
                           DataRateValue(DataRate("32768b/s")),
                           MakeDataRateAccessor(&PointToPointNetDevice::m_bps),
                           MakeDataRateChecker())
+            .AddAttribute("BackgroundDataRate",
+                          "The data rate used by background traffic which is not modeled "
+                          "as packets (e.g., fluid flows). The packets are transmitted at "
+                          "the remaining data rate.",
+                          DataRateValue(DataRate("0b/s")),
+                          MakeDataRateAccessor(&PointToPointNetDevice::m_backgroundBps),
+                          MakeDataRateChecker())
             .AddAttribute("ReceiveErrorModel",
                           "The receiver error model used to simulate packet loss",
                           PointerValue(),
@@ -238,7 +247,14 @@ PointToPointNetDevice::TransmitStart(Ptr<Packet> p)
     m_currentPkt = p;
     m_phyTxBeginTrace(m_currentPkt);
 
-    Time txTime = m_bps.CalculateBytesTxTime(p->GetSize());
+    NS_ABORT_MSG_IF(m_backgroundBps >= m_bps,
+                    "The background data rate " << m_backgroundBps
+                                                << " leaves no room to transmit packets");
+    // a packet carrying several segments takes the time needed to transmit all of them
+    TsoTag tsoTag;
+    uint32_t size = p->PeekPacketTag(tsoTag) ? tsoTag.GetWireSize(p->GetSize()) : p->GetSize();
+    Time txTime =
+        DataRate(m_bps.GetBitRate() - m_backgroundBps.GetBitRate()).CalculateBytesTxTime(size);
     Time txCompleteTime = txTime + m_tInterframeGap;
 
     NS_LOG_LOGIC("Schedule TransmitCompleteEvent in " << txCompleteTime.As(Time::S));
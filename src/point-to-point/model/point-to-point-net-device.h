@@ -277,6 +277,12 @@ class PointToPointNetDevice : public NetDevice
      */
     DataRate m_bps;
 
+    /**
+     * The data rate used by the background traffic sharing the link, which
+     * is not available to the packets.
+     */
+    DataRate m_backgroundBps;
+
     /**
      * The interframe gap that the Net Device uses to throttle packet
      * transmission
@@ -0,0 +1,211 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "jakes-fading-table.h"
+
+#include "jakes-process.h"
+
+#include "ns3/log.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <tuple>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("JakesFadingTable");
+
+namespace
+{
+
+/// Identifier of the files written by JakesFadingTable::Save
+constexpr char FILE_MAGIC[8] = {'N', 'S', '3', 'J', 'A', 'K', 'E', 'S'};
+
+/// Configuration of a table: Doppler frequency, number of oscillators, resolution, number
+/// of samples, seed, run number and stream of the random variable that initialized the process
+using TableKey = std::tuple<double, uint32_t, int64_t, uint32_t, uint32_t, uint64_t, int64_t>;
+
+/**
+ * \return the tables shared in the current simulation
+ */
+std::map<TableKey, Ptr<const JakesFadingTable>>&
+GetTables()
+{
+    static std::map<TableKey, Ptr<const JakesFadingTable>> tables;
+    return tables;
+}
+
+/**
+ * Release the tables shared in the current simulation
+ */
+void
+ClearTables()
+{
+    GetTables().clear();
+}
+
+} // namespace
+
+JakesFadingTable::JakesFadingTable(Time resolution, std::vector<float> gainsDb)
+    : m_resolution(resolution),
+      m_gainsDb(std::move(gainsDb))
+{
+    NS_LOG_FUNCTION(this << resolution << m_gainsDb.size());
+    NS_ASSERT_MSG(m_resolution.IsStrictlyPositive(), "The resolution must be positive");
+    NS_ASSERT_MSG(!m_gainsDb.empty(), "The table must not be empty");
+}
+
+Ptr<const JakesFadingTable>
+JakesFadingTable::GetTable(Ptr<const JakesProcess> process,
+                           int64_t stream,
+                           Time resolution,
+                           Time duration,
+                           const std::string& filename)
+{
+    NS_LOG_FUNCTION(process << stream << resolution << duration << filename);
+    NS_ASSERT_MSG(resolution.IsStrictlyPositive(), "The resolution must be positive");
+    NS_ASSERT_MSG(duration >= resolution, "The duration must be at least equal to the resolution");
+
+    auto& tables = GetTables();
+
+    auto nSamples = static_cast<uint32_t>(std::ceil(duration.GetDouble() / resolution.GetDouble()));
+    double doppler = process->GetDopplerFrequencyHz();
+    uint32_t nOscillators = process->GetNOscillators();
+    TableKey key{doppler,
+                 nOscillators,
+                 resolution.GetTimeStep(),
+                 nSamples,
+                 RngSeedManager::GetSeed(),
+                 RngSeedManager::GetRun(),
+                 stream};
+
+    if (auto it = tables.find(key); it != tables.end())
+    {
+        return it->second;
+    }
+
+    Ptr<JakesFadingTable> table;
+    if (!filename.empty())
+    {
+        table = Load(filename, doppler, nOscillators, resolution, nSamples);
+    }
+    if (!table)
+    {
+        NS_LOG_DEBUG("Generating a table of " << nSamples << " samples for a Doppler frequency of "
+                                              << doppler << " Hz");
+        std::vector<float> gainsDb(nSamples);
+        for (uint32_t i = 0; i < nSamples; ++i)
+        {
+            gainsDb[i] = process->GetChannelGainDbAt(resolution * i);
+        }
+        table = Create<JakesFadingTable>(resolution, std::move(gainsDb));
+        if (!filename.empty() && !table->Save(filename, doppler, nOscillators))
+        {
+            NS_LOG_WARN("Unable to save the fading table into " << filename);
+        }
+    }
+    if (tables.empty())
+    {
+        Simulator::ScheduleDestroy(&ClearTables);
+    }
+    tables[key] = table;
+    return table;
+}
+
+double
+JakesFadingTable::GetChannelGainDb(Time t, uint32_t offset) const
+{
+    const auto n = static_cast<uint32_t>(m_gainsDb.size());
+    double pos = t.GetDouble() / m_resolution.GetDouble();
+    double whole = std::floor(pos);
+    double frac = pos - whole;
+    auto index = static_cast<uint32_t>((static_cast<uint64_t>(whole) + offset) % n);
+    if (index + 1 == n)
+    {
+        // do not interpolate towards the first sample, the table wraps around here
+        return m_gainsDb[index];
+    }
+    return m_gainsDb[index] + frac * (m_gainsDb[index + 1] - m_gainsDb[index]);
+}
+
+uint32_t
+JakesFadingTable::GetNSamples() const
+{
+    return m_gainsDb.size();
+}
+
+Time
+JakesFadingTable::GetResolution() const
+{
+    return m_resolution;
+}
+
+bool
+JakesFadingTable::Save(const std::string& filename,
+                       double dopplerFrequencyHz,
+                       uint32_t nOscillators) const
+{
+    NS_LOG_FUNCTION(this << filename << dopplerFrequencyHz << nOscillators);
+    std::ofstream os(filename, std::ios::binary);
+    if (!os.is_open())
+    {
+        return false;
+    }
+    int64_t resolution = m_resolution.GetTimeStep();
+    auto nSamples = static_cast<uint32_t>(m_gainsDb.size());
+    os.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+    os.write(reinterpret_cast<const char*>(&dopplerFrequencyHz), sizeof(dopplerFrequencyHz));
+    os.write(reinterpret_cast<const char*>(&nOscillators), sizeof(nOscillators));
+    os.write(reinterpret_cast<const char*>(&resolution), sizeof(resolution));
+    os.write(reinterpret_cast<const char*>(&nSamples), sizeof(nSamples));
+    os.write(reinterpret_cast<const char*>(m_gainsDb.data()), nSamples * sizeof(float));
+    return os.good();
+}
+
+Ptr<JakesFadingTable>
+JakesFadingTable::Load(const std::string& filename,
+                       double dopplerFrequencyHz,
+                       uint32_t nOscillators,
+                       Time resolution,
+                       uint32_t nSamples)
+{
+    NS_LOG_FUNCTION(filename << dopplerFrequencyHz << nOscillators << resolution << nSamples);
+    std::ifstream is(filename, std::ios::binary);
+    if (!is.is_open())
+    {
+        return nullptr;
+    }
+    char magic[sizeof(FILE_MAGIC)];
+    double fileDoppler;
+    uint32_t fileOscillators;
+    int64_t fileResolution;
+    uint32_t fileSamples;
+    is.read(magic, sizeof(magic));
+    is.read(reinterpret_cast<char*>(&fileDoppler), sizeof(fileDoppler));
+    is.read(reinterpret_cast<char*>(&fileOscillators), sizeof(fileOscillators));
+    is.read(reinterpret_cast<char*>(&fileResolution), sizeof(fileResolution));
+    is.read(reinterpret_cast<char*>(&fileSamples), sizeof(fileSamples));
+    if (!is.good() || std::memcmp(magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 ||
+        fileDoppler != dopplerFrequencyHz || fileOscillators != nOscillators ||
+        fileResolution != resolution.GetTimeStep() || fileSamples != nSamples)
+    {
+        NS_LOG_DEBUG("The file " << filename << " does not match the requested table");
+        return nullptr;
+    }
+    std::vector<float> gainsDb(nSamples);
+    is.read(reinterpret_cast<char*>(gainsDb.data()), nSamples * sizeof(float));
+    if (!is.good())
+    {
+        NS_LOG_DEBUG("The file " << filename << " is truncated");
+        return nullptr;
+    }
+    return Create<JakesFadingTable>(resolution, std::move(gainsDb));
+}
+
+} // namespace ns3
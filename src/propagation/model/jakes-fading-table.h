@@ -0,0 +1,132 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef JAKES_FADING_TABLE_H
+#define JAKES_FADING_TABLE_H
+
+#include "ns3/nstime.h"
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+class JakesProcess;
+
+/**
+ * \ingroup propagation
+ *
+ * \brief A precomputed realization of a Jakes fading process, shared across links.
+ *
+ * The table stores the channel gain (in dB) of a single realization of a JakesProcess,
+ * sampled with a fixed resolution over a given duration. Each link reads the table with
+ * its own time offset, wrapping around at the end of the table, so that the cost of the
+ * fading is a table lookup and a linear interpolation per query, and the state of each
+ * link reduces to its offset.
+ *
+ * Tables are generated once per combination of Doppler frequency, number of oscillators,
+ * resolution, number of samples and random stream (including the seed and the run number
+ * of the simulation), and are shared by all the users asking for the same configuration
+ * (see GetTable()). The shared tables are released by Simulator::Destroy, so that
+ * every simulation generates its own tables. Optionally, a table can be saved to and
+ * loaded from a binary file, so that large tables are generated only once across
+ * simulation runs; note that, in this case, the realization stored in the file is used
+ * regardless of the random stream, seed and run number.
+ *
+ * The duration of the table should be much larger than the coherence time of the channel
+ * (i.e., the inverse of the Doppler frequency), otherwise the gains of different links
+ * would be strongly correlated.
+ */
+class JakesFadingTable : public SimpleRefCount<JakesFadingTable>
+{
+  public:
+    /**
+     * Constructor
+     * \param resolution the time interval between two consecutive samples
+     * \param gainsDb the channel gains [dB]
+     */
+    JakesFadingTable(Time resolution, std::vector<float> gainsDb);
+
+    /**
+     * Get a table sampling the given Jakes process. If a table with the same
+     * configuration has already been generated in the current simulation from the
+     * same random stream, it is returned instead.
+     *
+     * If filename is not empty, the table is loaded from this file if it exists and
+     * matches the requested configuration; otherwise the table is generated and saved
+     * into the file.
+     *
+     * \param process the Jakes process to sample, which must be already initialized
+     * \param stream the stream number of the random variable used to initialize the process,
+     *        or -1 if the stream was automatically assigned
+     * \param resolution the time interval between two consecutive samples
+     * \param duration the time span covered by the table
+     * \param filename the name of the file storing the table, or an empty string
+     * \return the table
+     */
+    static Ptr<const JakesFadingTable> GetTable(Ptr<const JakesProcess> process,
+                                                int64_t stream,
+                                                Time resolution,
+                                                Time duration,
+                                                const std::string& filename = "");
+
+    /**
+     * Get the channel gain seen at a given time by a link reading the table
+     * with the given offset. The gain is linearly interpolated between samples, except
+     * after the last sample, which is held until the table wraps around because the first
+     * sample does not belong to the same portion of the realization.
+     * \param t the time instant
+     * \param offset the offset of the link [samples]
+     * \return the channel gain [dB]
+     */
+    double GetChannelGainDb(Time t, uint32_t offset) const;
+
+    /**
+     * \return the number of samples of the table
+     */
+    uint32_t GetNSamples() const;
+
+    /**
+     * \return the time interval between two consecutive samples
+     */
+    Time GetResolution() const;
+
+    /**
+     * Save the table into a binary file
+     * \param filename the name of the file
+     * \param dopplerFrequencyHz the Doppler frequency of the sampled process [Hz]
+     * \param nOscillators the number of oscillators of the sampled process
+     * \return true if the file has been successfully written
+     */
+    bool Save(const std::string& filename,
+              double dopplerFrequencyHz,
+              uint32_t nOscillators) const;
+
+    /**
+     * Load a table from a binary file written by Save()
+     * \param filename the name of the file
+     * \param dopplerFrequencyHz the expected Doppler frequency [Hz]
+     * \param nOscillators the expected number of oscillators
+     * \param resolution the expected resolution
+     * \param nSamples the expected number of samples
+     * \return the table, or nullptr if the file does not exist or does not match the
+     *         expected configuration
+     */
+    static Ptr<JakesFadingTable> Load(const std::string& filename,
+                                      double dopplerFrequencyHz,
+                                      uint32_t nOscillators,
+                                      Time resolution,
+                                      uint32_t nSamples);
+
+  private:
+    Time m_resolution;            //!< time interval between two consecutive samples
+    std::vector<float> m_gainsDb; //!< channel gains [dB]
+};
+
+} // namespace ns3
+
+#endif /* JAKES_FADING_TABLE_H */
@@ -131,21 +131,45 @@ JakesProcess::DoDispose()
 
 std::complex<double>
 JakesProcess::GetComplexGain() const
+{
+    return GetComplexGainAt(Now());
+}
+
+double
+JakesProcess::GetChannelGainDb() const
+{
+    return GetChannelGainDbAt(Now());
+}
+
+std::complex<double>
+JakesProcess::GetComplexGainAt(Time t) const
 {
     std::complex<double> sumAmplitude = std::complex<double>(0, 0);
     for (unsigned int i = 0; i < m_oscillators.size(); i++)
     {
-        sumAmplitude += m_oscillators[i].GetValueAt(Now());
+        sumAmplitude += m_oscillators[i].GetValueAt(t);
     }
     return sumAmplitude;
 }
 
 double
-JakesProcess::GetChannelGainDb() const
+JakesProcess::GetChannelGainDbAt(Time t) const
 {
-    std::complex<double> complexGain = GetComplexGain();
+    std::complex<double> complexGain = GetComplexGainAt(t);
     return (10 *
             std::log10((std::pow(complexGain.real(), 2) + std::pow(complexGain.imag(), 2)) / 2));
 }
 
+double
+JakesProcess::GetDopplerFrequencyHz() const
+{
+    return m_omegaDopplerMax / (2 * M_PI);
+}
+
+unsigned int
+JakesProcess::GetNOscillators() const
+{
+    return m_nOscillators;
+}
+
 } // namespace ns3
@@ -64,6 +64,30 @@ class JakesProcess : public Object
      */
     double GetChannelGainDb() const;
 
+    /**
+     * Get the channel complex gain at a given time
+     * \param t the time instant
+     * \return the channel complex gain
+     */
+    std::complex<double> GetComplexGainAt(Time t) const;
+    /**
+     * Get the channel gain in dB at a given time
+     * \param t the time instant
+     * \return the channel gain [dB]
+     */
+    double GetChannelGainDbAt(Time t) const;
+
+    /**
+     * Get the Doppler frequency
+     * \return the Doppler frequency [Hz]
+     */
+    double GetDopplerFrequencyHz() const;
+    /**
+     * Get the number of oscillators
+     * \return the number of oscillators
+     */
+    unsigned int GetNOscillators() const;
+
     /**
      * Set the propagation model using this class
      * \param model the propagation model using this class
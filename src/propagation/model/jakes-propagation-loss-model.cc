@@ -8,8 +8,11 @@
 
 #include "jakes-propagation-loss-model.h"
 
+#include "ns3/boolean.h"
 #include "ns3/double.h"
 #include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
 
 namespace ns3
 {
@@ -19,6 +22,7 @@ NS_LOG_COMPONENT_DEFINE("Jakes");
 NS_OBJECT_ENSURE_REGISTERED(JakesPropagationLossModel);
 
 JakesPropagationLossModel::JakesPropagationLossModel()
+    : m_useFadingTable(false)
 {
     m_uniformVariable = CreateObject<UniformRandomVariable>();
     m_uniformVariable->SetAttribute("Min", DoubleValue(-1.0 * M_PI));
@@ -35,7 +39,37 @@ JakesPropagationLossModel::GetTypeId()
     static TypeId tid = TypeId("ns3::JakesPropagationLossModel")
                             .SetParent<PropagationLossModel>()
                             .SetGroupName("Propagation")
-                            .AddConstructor<JakesPropagationLossModel>();
+                            .AddConstructor<JakesPropagationLossModel>()
+                            .AddAttribute("UseFadingTable",
+                                          "If true, a precomputed realization of the Jakes process "
+                                          "is shared by all links, each link reading it with a "
+                                          "random time offset.",
+                                          BooleanValue(false),
+                                          MakeBooleanAccessor(
+                                              &JakesPropagationLossModel::m_useFadingTable),
+                                          MakeBooleanChecker())
+                            .AddAttribute("FadingTableResolution",
+                                          "The time interval between two samples of the fading "
+                                          "table.",
+                                          TimeValue(MilliSeconds(1)),
+                                          MakeTimeAccessor(
+                                              &JakesPropagationLossModel::m_fadingTableResolution),
+                                          MakeTimeChecker(NanoSeconds(1)))
+                            .AddAttribute("FadingTableDuration",
+                                          "The time span covered by the fading table. It should "
+                                          "be much larger than the coherence time of the channel.",
+                                          TimeValue(Seconds(10)),
+                                          MakeTimeAccessor(
+                                              &JakesPropagationLossModel::m_fadingTableDuration),
+                                          MakeTimeChecker(NanoSeconds(1)))
+                            .AddAttribute("FadingTableFile",
+                                          "If not empty, the fading table is loaded from this "
+                                          "file if it matches the configuration, otherwise it is "
+                                          "generated and saved into this file.",
+                                          StringValue(""),
+                                          MakeStringAccessor(
+                                              &JakesPropagationLossModel::m_fadingTableFile),
+                                          MakeStringChecker());
     return tid;
 }
 
@@ -44,6 +78,44 @@ JakesPropagationLossModel::DoDispose()
 {
     m_uniformVariable = nullptr;
     m_propagationCache.Cleanup();
+    m_fadingTable = nullptr;
+    m_fadingTableOffsets.clear();
+}
+
+Ptr<const JakesFadingTable>
+JakesPropagationLossModel::GetFadingTable() const
+{
+    if (m_useFadingTable && !m_fadingTable)
+    {
+        // The process is built with the default attribute values of JakesProcess
+        Ptr<JakesProcess> process = CreateObject<JakesProcess>();
+        process->SetPropagationLossModel(this);
+        m_fadingTable = JakesFadingTable::GetTable(process,
+                                                   m_uniformVariable->GetStream(),
+                                                   m_fadingTableResolution,
+                                                   m_fadingTableDuration,
+                                                   m_fadingTableFile);
+        process->Dispose();
+    }
+    return m_fadingTable;
+}
+
+uint32_t
+JakesPropagationLossModel::GetFadingTableOffset(Ptr<const MobilityModel> a,
+                                                Ptr<const MobilityModel> b) const
+{
+    LinkId link = (a < b) ? LinkId{a, b} : LinkId{b, a};
+    auto it = m_fadingTableOffsets.find(link);
+    if (it == m_fadingTableOffsets.end())
+    {
+        uint32_t nSamples = GetFadingTable()->GetNSamples();
+        // The random variable is uniformly distributed in [-pi, pi)
+        auto offset = static_cast<uint32_t>((m_uniformVariable->GetValue() + M_PI) / (2 * M_PI) *
+                                            nSamples) %
+                      nSamples;
+        it = m_fadingTableOffsets.emplace(link, offset).first;
+    }
+    return it->second;
 }
 
 double
@@ -51,6 +123,12 @@ JakesPropagationLossModel::DoCalcRxPower(double txPowerDbm,
                                          Ptr<MobilityModel> a,
                                          Ptr<MobilityModel> b) const
 {
+    if (m_useFadingTable)
+    {
+        uint32_t offset = GetFadingTableOffset(a, b);
+        return txPowerDbm + GetFadingTable()->GetChannelGainDb(Now(), offset);
+    }
+
     Ptr<JakesProcess> pathData = m_propagationCache.GetPathData(
         a,
         b,
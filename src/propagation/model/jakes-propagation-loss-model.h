@@ -8,10 +8,14 @@
 #ifndef JAKES_STATIONARY_LOSS_MODEL_H
 #define JAKES_STATIONARY_LOSS_MODEL_H
 
+#include "jakes-fading-table.h"
 #include "jakes-process.h"
 #include "propagation-cache.h"
 #include "propagation-loss-model.h"
 
+#include <map>
+#include <string>
+
 namespace ns3
 {
 /**
@@ -19,6 +23,11 @@ namespace ns3
  *
  * \brief a  Jakes narrowband propagation model.
  * Symmetrical cache for JakesProcess
+ *
+ * If the UseFadingTable attribute is true, a single realization of the JakesProcess
+ * is precomputed into a JakesFadingTable shared by all links (and by all the models
+ * using the same configuration and random stream); each link then only stores a random
+ * time offset into the table.
  */
 
 class JakesPropagationLossModel : public PropagationLossModel
@@ -36,6 +45,12 @@ class JakesPropagationLossModel : public PropagationLossModel
     JakesPropagationLossModel(const JakesPropagationLossModel&) = delete;
     JakesPropagationLossModel& operator=(const JakesPropagationLossModel&) = delete;
 
+    /**
+     * Get the fading table used by this model, generating it if needed
+     * \return the fading table, or nullptr if the UseFadingTable attribute is false
+     */
+    Ptr<const JakesFadingTable> GetFadingTable() const;
+
   protected:
     void DoDispose() override;
 
@@ -54,8 +69,26 @@ class JakesPropagationLossModel : public PropagationLossModel
      */
     Ptr<UniformRandomVariable> GetUniformRandomVariable() const;
 
+    /**
+     * Get the offset into the fading table of the link between two nodes,
+     * drawing a random one if the link is new
+     * \param a the mobility model of the first node
+     * \param b the mobility model of the second node
+     * \return the offset [samples]
+     */
+    uint32_t GetFadingTableOffset(Ptr<const MobilityModel> a, Ptr<const MobilityModel> b) const;
+
     Ptr<UniformRandomVariable> m_uniformVariable;              //!< random stream
     mutable PropagationCache<JakesProcess> m_propagationCache; //!< Propagation cache
+
+    bool m_useFadingTable;                             //!< whether to use a fading table
+    Time m_fadingTableResolution;                      //!< resolution of the fading table
+    Time m_fadingTableDuration;                        //!< duration of the fading table
+    std::string m_fadingTableFile;                     //!< file storing the fading table
+    mutable Ptr<const JakesFadingTable> m_fadingTable; //!< the shared fading table
+    /// Symmetrical link identifier (the pair is sorted)
+    using LinkId = std::pair<Ptr<const MobilityModel>, Ptr<const MobilityModel>>;
+    mutable std::map<LinkId, uint32_t> m_fadingTableOffsets; //!< offset of each link [samples]
 };
 
 } // namespace ns3
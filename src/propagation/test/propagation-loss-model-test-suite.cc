@@ -5,12 +5,16 @@
  */
 
 #include "ns3/abort.h"
+#include "ns3/boolean.h"
 #include "ns3/config.h"
 #include "ns3/constant-position-mobility-model.h"
 #include "ns3/double.h"
+#include "ns3/jakes-propagation-loss-model.h"
 #include "ns3/log.h"
 #include "ns3/propagation-loss-model.h"
+#include "ns3/rng-seed-manager.h"
 #include "ns3/simulator.h"
+#include "ns3/string.h"
 #include "ns3/test.h"
 
 using namespace ns3;
@@ -478,6 +482,158 @@ RangePropagationLossModelTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup propagation-tests
+ *
+ * \brief JakesPropagationLossModel Test with a shared fading table
+ */
+class JakesFadingTableTestCase : public TestCase
+{
+  public:
+    JakesFadingTableTestCase();
+
+  private:
+    void DoRun() override;
+    /**
+     * Check the received power of the links at the current time
+     * \param lossModel the loss model
+     * \param a the first node
+     * \param b the second node
+     * \param c the third node
+     */
+    void CheckLinks(Ptr<JakesPropagationLossModel> lossModel,
+                    Ptr<MobilityModel> a,
+                    Ptr<MobilityModel> b,
+                    Ptr<MobilityModel> c);
+};
+
+JakesFadingTableTestCase::JakesFadingTableTestCase()
+    : TestCase("Test JakesPropagationLossModel with a shared fading table")
+{
+}
+
+void
+JakesFadingTableTestCase::CheckLinks(Ptr<JakesPropagationLossModel> lossModel,
+                                     Ptr<MobilityModel> a,
+                                     Ptr<MobilityModel> b,
+                                     Ptr<MobilityModel> c)
+{
+    // Links are symmetrical
+    NS_TEST_EXPECT_MSG_EQ_TOL(lossModel->CalcRxPower(0, a, b),
+                              lossModel->CalcRxPower(0, b, a),
+                              1e-9,
+                              "Links should be symmetrical");
+    // Different links read the table with different offsets
+    NS_TEST_EXPECT_MSG_NE(lossModel->CalcRxPower(0, a, b),
+                          lossModel->CalcRxPower(0, a, c),
+                          "Different links should see different gains");
+}
+
+void
+JakesFadingTableTestCase::DoRun()
+{
+    Config::SetDefault("ns3::JakesPropagationLossModel::UseFadingTable", BooleanValue(true));
+    Config::SetDefault("ns3::JakesPropagationLossModel::FadingTableDuration",
+                       TimeValue(Seconds(20)));
+
+    Ptr<MobilityModel> a = CreateObject<ConstantPositionMobilityModel>();
+    Ptr<MobilityModel> b = CreateObject<ConstantPositionMobilityModel>();
+    Ptr<MobilityModel> c = CreateObject<ConstantPositionMobilityModel>();
+
+    Ptr<JakesPropagationLossModel> lossModel = CreateObject<JakesPropagationLossModel>();
+    lossModel->AssignStreams(1);
+    Ptr<const JakesFadingTable> table = lossModel->GetFadingTable();
+    NS_TEST_ASSERT_MSG_NE(table, nullptr, "The fading table should be available");
+    NS_TEST_EXPECT_MSG_EQ(table->GetNSamples(), 20000, "Unexpected number of samples");
+
+    // The fading process has unitary mean power
+    double meanPower = 0;
+    for (uint32_t i = 0; i < table->GetNSamples(); ++i)
+    {
+        meanPower += std::pow(10, table->GetChannelGainDb(MilliSeconds(i), 0) / 10);
+    }
+    meanPower /= table->GetNSamples();
+    NS_TEST_EXPECT_MSG_EQ_TOL(meanPower, 1.0, 0.2, "The mean power of the fading should be 1");
+
+    // Gains are linearly interpolated between samples and wrap around
+    double first = table->GetChannelGainDb(Seconds(0), 0);
+    double second = table->GetChannelGainDb(MilliSeconds(1), 0);
+    NS_TEST_EXPECT_MSG_EQ_TOL(table->GetChannelGainDb(MicroSeconds(500), 0),
+                              (first + second) / 2,
+                              1e-6,
+                              "Wrong interpolation");
+    NS_TEST_EXPECT_MSG_EQ_TOL(table->GetChannelGainDb(Seconds(20), 1),
+                              second,
+                              1e-6,
+                              "Wrong wrap around");
+    // No interpolation between the last and the first sample
+    double last = table->GetChannelGainDb(Seconds(20) - MilliSeconds(1), 0);
+    NS_TEST_EXPECT_MSG_EQ_TOL(table->GetChannelGainDb(Seconds(20) - MicroSeconds(500), 0),
+                              last,
+                              1e-6,
+                              "The last sample should be held until the wrap around");
+
+    // A model with the same configuration and stream shares the table
+    Ptr<JakesPropagationLossModel> otherModel = CreateObject<JakesPropagationLossModel>();
+    otherModel->AssignStreams(1);
+    NS_TEST_EXPECT_MSG_EQ(otherModel->GetFadingTable(), table, "The table should be shared");
+
+    // A model with a different stream has its own realization
+    Ptr<JakesPropagationLossModel> streamModel = CreateObject<JakesPropagationLossModel>();
+    streamModel->AssignStreams(2);
+    NS_TEST_EXPECT_MSG_NE(streamModel->GetFadingTable(), table, "The table should not be shared");
+    NS_TEST_EXPECT_MSG_NE(streamModel->GetFadingTable()->GetChannelGainDb(Seconds(3), 0),
+                          table->GetChannelGainDb(Seconds(3), 0),
+                          "Different streams should give different realizations");
+
+    Simulator::Schedule(Seconds(1),
+                        &JakesFadingTableTestCase::CheckLinks,
+                        this,
+                        lossModel,
+                        a,
+                        b,
+                        c);
+    Simulator::Run();
+
+    // A table saved into a file can be loaded back
+    std::string filename = CreateTempDirFilename("jakes-fading-table.bin");
+    NS_TEST_ASSERT_MSG_EQ(table->Save(filename, 80, 20), true, "Unable to save the table");
+    Ptr<JakesFadingTable> loaded =
+        JakesFadingTable::Load(filename, 80, 20, table->GetResolution(), table->GetNSamples());
+    NS_TEST_ASSERT_MSG_NE(loaded, nullptr, "Unable to load the table");
+    NS_TEST_EXPECT_MSG_EQ(loaded->GetChannelGainDb(Seconds(3), 7),
+                          table->GetChannelGainDb(Seconds(3), 7),
+                          "The loaded table differs from the saved one");
+    NS_TEST_EXPECT_MSG_EQ(
+        JakesFadingTable::Load(filename, 10, 20, table->GetResolution(), table->GetNSamples()),
+        nullptr,
+        "A table with a different configuration should not be loaded");
+
+    Simulator::Destroy();
+
+    // The tables are released by Simulator::Destroy, a new simulation with the same seed,
+    // run and stream generates the same realization again
+    Ptr<JakesPropagationLossModel> newModel = CreateObject<JakesPropagationLossModel>();
+    newModel->AssignStreams(1);
+    Ptr<const JakesFadingTable> newTable = newModel->GetFadingTable();
+    NS_TEST_EXPECT_MSG_NE(newTable, table, "The table should have been released");
+    NS_TEST_EXPECT_MSG_EQ(newTable->GetChannelGainDb(Seconds(3), 7),
+                          table->GetChannelGainDb(Seconds(3), 7),
+                          "The same stream should give the same realization");
+
+    // A different run generates a different realization
+    uint64_t run = RngSeedManager::GetRun();
+    RngSeedManager::SetRun(run + 1);
+    Ptr<JakesPropagationLossModel> runModel = CreateObject<JakesPropagationLossModel>();
+    runModel->AssignStreams(1);
+    NS_TEST_EXPECT_MSG_NE(runModel->GetFadingTable()->GetChannelGainDb(Seconds(3), 7),
+                          table->GetChannelGainDb(Seconds(3), 7),
+                          "A different run should give a different realization");
+    RngSeedManager::SetRun(run);
+
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup propagation-tests
  *
@@ -489,6 +645,7 @@ RangePropagationLossModelTestCase::DoRun()
  *   - LogDistancePropagationLossModel
  *   - MatrixPropagationLossModel
  *   - RangePropagationLossModel
+ *   - JakesPropagationLossModel with a shared fading table
  */
 class PropagationLossModelsTestSuite : public TestSuite
 {
@@ -504,6 +661,7 @@ PropagationLossModelsTestSuite::PropagationLossModelsTestSuite()
     AddTestCase(new LogDistancePropagationLossModelTestCase, TestCase::Duration::QUICK);
     AddTestCase(new MatrixPropagationLossModelTestCase, TestCase::Duration::QUICK);
     AddTestCase(new RangePropagationLossModelTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new JakesFadingTableTestCase, TestCase::Duration::QUICK);
 }
 
 /// Static variable for test initialization
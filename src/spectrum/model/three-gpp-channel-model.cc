@@ -1127,6 +1127,14 @@ ThreeGppChannelModel::GetTypeId()
                           TimeValue(MilliSeconds(0)),
                           MakeTimeAccessor(&ThreeGppChannelModel::m_updatePeriod),
                           MakeTimeChecker())
+            .AddAttribute("IncrementalUpdate",
+                          "If true, when the UpdatePeriod expires and the channel condition did "
+                          "not change, the channel parameters are evolved by applying the "
+                          "intra-cluster Doppler phase shifts accumulated since the last update, "
+                          "instead of generating a new independent realization",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&ThreeGppChannelModel::m_incrementalUpdate),
+                          MakeBooleanChecker())
             // attributes for the blockage model
             .AddAttribute("Blockage",
                           "Enable blockage model A (sec 7.6.4.1)",
@@ -2472,16 +2480,61 @@ ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
 {
     NS_LOG_FUNCTION(this);
 
+    // retrieve the channel condition
+    Ptr<const ChannelCondition> condition =
+        m_channelConditionModel->GetChannelCondition(aMob, bMob);
+
+    Ptr<const ParamsTable> table3gpp;
+    return DoGetChannel(aMob, bMob, aAntenna, bAntenna, condition, table3gpp);
+}
+
+std::vector<Ptr<const MatrixBasedChannelModel::ChannelMatrix>>
+ThreeGppChannelModel::GetChannels(const std::vector<ChannelLink>& links)
+{
+    NS_LOG_FUNCTION(this << links.size());
+
+    // channel condition and 3GPP table of each pair of nodes involved in this batch
+    std::unordered_map<uint64_t, std::pair<Ptr<const ChannelCondition>, Ptr<const ParamsTable>>>
+        nodePairInfo;
+
+    std::vector<Ptr<const ChannelMatrix>> channels;
+    channels.reserve(links.size());
+    for (const auto& link : links)
+    {
+        uint64_t channelParamsKey = GetKey(link.aMob->GetObject<Node>()->GetId(),
+                                           link.bMob->GetObject<Node>()->GetId());
+        auto it = nodePairInfo.find(channelParamsKey);
+        if (it == nodePairInfo.end())
+        {
+            auto condition = m_channelConditionModel->GetChannelCondition(link.aMob, link.bMob);
+            it = nodePairInfo.emplace(channelParamsKey, std::make_pair(condition, nullptr)).first;
+        }
+        channels.push_back(DoGetChannel(link.aMob,
+                                        link.bMob,
+                                        link.aAntenna,
+                                        link.bAntenna,
+                                        it->second.first,
+                                        it->second.second));
+    }
+    return channels;
+}
+
+Ptr<const MatrixBasedChannelModel::ChannelMatrix>
+ThreeGppChannelModel::DoGetChannel(Ptr<const MobilityModel> aMob,
+                                   Ptr<const MobilityModel> bMob,
+                                   Ptr<const PhasedArrayModel> aAntenna,
+                                   Ptr<const PhasedArrayModel> bAntenna,
+                                   Ptr<const ChannelCondition> condition,
+                                   Ptr<const ParamsTable>& table3gpp)
+{
+    NS_LOG_FUNCTION(this);
+
     // Compute the channel params key. The key is reciprocal, i.e., key (a, b) = key (b, a)
     uint64_t channelParamsKey =
         GetKey(aMob->GetObject<Node>()->GetId(), bMob->GetObject<Node>()->GetId());
     // Compute the channel matrix key. The key is reciprocal, i.e., key (a, b) = key (b, a)
     uint64_t channelMatrixKey = GetKey(aAntenna->GetId(), bAntenna->GetId());
 
-    // retrieve the channel condition
-    Ptr<const ChannelCondition> condition =
-        m_channelConditionModel->GetChannelCondition(aMob, bMob);
-
     // Check if the channel is present in the map and return it, otherwise
     // generate a new channel
     bool updateParams = false;
@@ -2503,10 +2556,24 @@ ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
         notFoundParams = true;
     }
 
-    // get the 3GPP parameters
-    Ptr<const ParamsTable> table3gpp = GetThreeGppTable(aMob, bMob, condition);
+    // the 3GPP parameters are needed only if a new channel has to be generated,
+    // hence they are computed lazily
+    auto getTable = [&]() {
+        if (!table3gpp)
+        {
+            table3gpp = GetThreeGppTable(aMob, bMob, condition);
+        }
+        return table3gpp;
+    };
 
-    if (notFoundParams || updateParams)
+    if (updateParams && m_incrementalUpdate &&
+        condition->IsEqual(channelParams->m_losCondition, channelParams->m_o2iCondition))
+    {
+        // the update is due to the expiration of the update period only, evolve the
+        // current realization instead of generating a new one
+        UpdateChannelParameters(channelParams, aMob, bMob);
+    }
+    else if (notFoundParams || updateParams)
     {
         // Step 4: Generate large scale parameters. All LSPS are uncorrelated.
         // Step 5: Generate Delays.
@@ -2516,7 +2583,7 @@ ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
         // shuffle all the arrays to perform random coupling
         // Step 9: Generate the cross polarization power ratios
         // Step 10: Draw initial phases
-        channelParams = GenerateChannelParameters(condition, table3gpp, aMob, bMob);
+        channelParams = GenerateChannelParameters(condition, getTable(), aMob, bMob);
         // store or replace the channel parameters
         m_channelParamsMap[channelParamsKey] = channelParams;
     }
@@ -2540,7 +2607,8 @@ ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
     if (notFoundMatrix || updateMatrix)
     {
         // channel matrix not found or has to be updated, generate a new one
-        channelMatrix = GetNewChannel(channelParams, table3gpp, aMob, bMob, aAntenna, bAntenna);
+        channelMatrix =
+            GetNewChannel(channelParams, getTable(), aMob, bMob, aAntenna, bAntenna);
         channelMatrix->m_antennaPair =
             std::make_pair(aAntenna->GetId(),
                            bAntenna->GetId()); // save antenna pair, with the exact order of s and u
@@ -3223,6 +3291,59 @@ ThreeGppChannelModel::GenerateChannelParameters(const Ptr<const ChannelCondition
     return channelParams;
 }
 
+void
+ThreeGppChannelModel::UpdateChannelParameters(Ptr<ThreeGppChannelParams> channelParams,
+                                              const Ptr<const MobilityModel> aMob,
+                                              const Ptr<const MobilityModel> bMob) const
+{
+    NS_LOG_FUNCTION(this);
+
+    // the angles of arrival refer to the u node, the angles of departure to the s node
+    bool isSameDirection = (channelParams->m_nodeIds.first == aMob->GetObject<Node>()->GetId());
+    Vector sSpeed = isSameDirection ? aMob->GetVelocity() : bMob->GetVelocity();
+    Vector uSpeed = isSameDirection ? bMob->GetVelocity() : aMob->GetVelocity();
+
+    double deltaT = (Simulator::Now() - channelParams->m_generatedTime).GetSeconds();
+    double factor = 2 * M_PI * deltaT * m_frequency / 3e8;
+
+    using MBCM = MatrixBasedChannelModel;
+    const auto& cachedAngleSincos = channelParams->m_cachedAngleSincos;
+    for (uint8_t nIndex = 0; nIndex < channelParams->m_reducedClusterNumber; nIndex++)
+    {
+        // projection of the speeds on the direction of the cluster center, i.e., the
+        // Doppler term applied by the spectrum propagation loss model
+        const auto& zoa = cachedAngleSincos[MBCM::ZOA_INDEX][nIndex];
+        const auto& aoa = cachedAngleSincos[MBCM::AOA_INDEX][nIndex];
+        const auto& zod = cachedAngleSincos[MBCM::ZOD_INDEX][nIndex];
+        const auto& aod = cachedAngleSincos[MBCM::AOD_INDEX][nIndex];
+        double clusterDoppler = zoa.first * aoa.second * uSpeed.x +
+                                zoa.first * aoa.first * uSpeed.y + zoa.second * uSpeed.z +
+                                zod.first * aod.second * sSpeed.x +
+                                zod.first * aod.first * sSpeed.y + zod.second * sSpeed.z;
+
+        for (size_t mIndex = 0; mIndex < channelParams->m_clusterPhase[nIndex].size(); mIndex++)
+        {
+            double sinRayZoa = sin(channelParams->m_rayZoaRadian[nIndex][mIndex]);
+            double sinRayZod = sin(channelParams->m_rayZodRadian[nIndex][mIndex]);
+            double rayDoppler =
+                sinRayZoa * cos(channelParams->m_rayAoaRadian[nIndex][mIndex]) * uSpeed.x +
+                sinRayZoa * sin(channelParams->m_rayAoaRadian[nIndex][mIndex]) * uSpeed.y +
+                cos(channelParams->m_rayZoaRadian[nIndex][mIndex]) * uSpeed.z +
+                sinRayZod * cos(channelParams->m_rayAodRadian[nIndex][mIndex]) * sSpeed.x +
+                sinRayZod * sin(channelParams->m_rayAodRadian[nIndex][mIndex]) * sSpeed.y +
+                cos(channelParams->m_rayZodRadian[nIndex][mIndex]) * sSpeed.z;
+
+            double deltaPhase = factor * (rayDoppler - clusterDoppler);
+            for (auto& phase : channelParams->m_clusterPhase[nIndex][mIndex])
+            {
+                phase = WrapToPi(phase + deltaPhase);
+            }
+        }
+    }
+
+    channelParams->m_generatedTime = Simulator::Now();
+}
+
 Ptr<MatrixBasedChannelModel::ChannelMatrix>
 ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelParams,
                                     Ptr<const ParamsTable> table3gpp,
@@ -3402,6 +3523,50 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
         }
     }
 
+    // The phase differences of each ray at the receiver (transmitter) depend only on the
+    // index of the receiving (transmitting) element. Compute them once per element and store
+    // the corresponding phasors in contiguous arrays (rays x elements x clusters), so that the
+    // loops over the pairs of elements only involve complex multiplications
+    ComplexMatrixArray uPhasors(table3gpp->m_raysPerCluster,
+                                uSize,
+                                channelParams->m_reducedClusterNumber);
+    ComplexMatrixArray sPhasors(table3gpp->m_raysPerCluster,
+                                sSize,
+                                channelParams->m_reducedClusterNumber);
+    for (size_t uIndex = 0; uIndex < uSize; uIndex++)
+    {
+        Vector uLoc = uAntenna->GetElementLocation(uIndex);
+        for (uint8_t nIndex = 0; nIndex < channelParams->m_reducedClusterNumber; nIndex++)
+        {
+            for (uint8_t mIndex = 0; mIndex < table3gpp->m_raysPerCluster; mIndex++)
+            {
+                // lambda_0 is accounted in the antenna spacing uLoc and sLoc.
+                double rxPhaseDiff =
+                    2 * M_PI *
+                    (sinCosA[nIndex][mIndex] * uLoc.x + sinSinA[nIndex][mIndex] * uLoc.y +
+                     cosZoA[nIndex][mIndex] * uLoc.z);
+                uPhasors(mIndex, uIndex, nIndex) =
+                    std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff));
+            }
+        }
+    }
+    for (size_t sIndex = 0; sIndex < sSize; sIndex++)
+    {
+        Vector sLoc = sAntenna->GetElementLocation(sIndex);
+        for (uint8_t nIndex = 0; nIndex < channelParams->m_reducedClusterNumber; nIndex++)
+        {
+            for (uint8_t mIndex = 0; mIndex < table3gpp->m_raysPerCluster; mIndex++)
+            {
+                double txPhaseDiff =
+                    2 * M_PI *
+                    (sinCosD[nIndex][mIndex] * sLoc.x + sinSinD[nIndex][mIndex] * sLoc.y +
+                     cosZoD[nIndex][mIndex] * sLoc.z);
+                sPhasors(mIndex, sIndex, nIndex) =
+                    std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
+            }
+        }
+    }
+
     // The following for loops computes the channel coefficients
     // Keeps track of how many sub-clusters have been added up to now
     uint8_t numSubClustersAdded = 0;
@@ -3409,11 +3574,10 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
     {
         for (size_t uIndex = 0; uIndex < uSize; uIndex++)
         {
-            Vector uLoc = uAntenna->GetElementLocation(uIndex);
-
             for (size_t sIndex = 0; sIndex < sSize; sIndex++)
             {
-                Vector sLoc = sAntenna->GetElementLocation(sIndex);
+                const auto& raysPol = raysPreComp[std::make_pair(sAntenna->GetElemPol(sIndex),
+                                                                 uAntenna->GetElemPol(uIndex))];
                 // Compute the N-2 weakest cluster, assuming 0 slant angle and a
                 // polarization slant angle configured in the array (7.5-22)
                 if (nIndex != channelParams->m_cluster1st && nIndex != channelParams->m_cluster2nd)
@@ -3421,23 +3585,10 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
                     std::complex<double> rays(0, 0);
                     for (uint8_t mIndex = 0; mIndex < table3gpp->m_raysPerCluster; mIndex++)
                     {
-                        // lambda_0 is accounted in the antenna spacing uLoc and sLoc.
-                        double rxPhaseDiff =
-                            2 * M_PI *
-                            (sinCosA[nIndex][mIndex] * uLoc.x + sinSinA[nIndex][mIndex] * uLoc.y +
-                             cosZoA[nIndex][mIndex] * uLoc.z);
-
-                        double txPhaseDiff =
-                            2 * M_PI *
-                            (sinCosD[nIndex][mIndex] * sLoc.x + sinSinD[nIndex][mIndex] * sLoc.y +
-                             cosZoD[nIndex][mIndex] * sLoc.z);
                         // NOTE Doppler is computed in the CalcBeamformingGain function and is
                         // simplified to only account for the center angle of each cluster.
-                        rays += raysPreComp[std::make_pair(sAntenna->GetElemPol(sIndex),
-                                                           uAntenna->GetElemPol(uIndex))](nIndex,
-                                                                                          mIndex) *
-                                std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff)) *
-                                std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
+                        rays += raysPol(nIndex, mIndex) * uPhasors(mIndex, uIndex, nIndex) *
+                                sPhasors(mIndex, sIndex, nIndex);
                     }
                     rays *=
                         sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
@@ -3453,22 +3604,9 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
                     {
                         // ZML:Just remind me that the angle offsets for the 3 subclusters were not
                         // generated correctly.
-                        double rxPhaseDiff =
-                            2 * M_PI *
-                            (sinCosA[nIndex][mIndex] * uLoc.x + sinSinA[nIndex][mIndex] * uLoc.y +
-                             cosZoA[nIndex][mIndex] * uLoc.z);
-
-                        double txPhaseDiff =
-                            2 * M_PI *
-                            (sinCosD[nIndex][mIndex] * sLoc.x + sinSinD[nIndex][mIndex] * sLoc.y +
-                             cosZoD[nIndex][mIndex] * sLoc.z);
-
-                        std::complex<double> raySub =
-                            raysPreComp[std::make_pair(sAntenna->GetElemPol(sIndex),
-                                                       uAntenna->GetElemPol(uIndex))](nIndex,
-                                                                                      mIndex) *
-                            std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff)) *
-                            std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
+                        std::complex<double> raySub = raysPol(nIndex, mIndex) *
+                                                      uPhasors(mIndex, uIndex, nIndex) *
+                                                      sPhasors(mIndex, sIndex, nIndex);
 
                         switch (mIndex)
                         {
@@ -108,6 +108,29 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
                                         Ptr<const PhasedArrayModel> aAntenna,
                                         Ptr<const PhasedArrayModel> bAntenna) override;
 
+    /**
+     * Describes one link for which a channel matrix is requested through GetChannels
+     */
+    struct ChannelLink
+    {
+        Ptr<const MobilityModel> aMob;        //!< mobility model of the a device
+        Ptr<const MobilityModel> bMob;        //!< mobility model of the b device
+        Ptr<const PhasedArrayModel> aAntenna; //!< antenna of the a device
+        Ptr<const PhasedArrayModel> bAntenna; //!< antenna of the b device
+    };
+
+    /**
+     * Batched version of GetChannel. The channel matrices of all the links are
+     * retrieved (and generated or updated, if needed) in a single pass. The channel
+     * condition and the 3GPP parameters table are computed only once per pair of
+     * nodes, even if several antenna pairs (e.g., multiple panels) share the same
+     * pair of nodes.
+     *
+     * \param links the links for which the channel matrix is requested
+     * \return the channel matrices, in the same order as links
+     */
+    std::vector<Ptr<const ChannelMatrix>> GetChannels(const std::vector<ChannelLink>& links);
+
     /**
      * Looks for the channel params associated to the aMob and bMob pair in
      * m_channelParamsMap. If not found it will return a nullptr.
@@ -290,6 +313,24 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
         const Ptr<const MobilityModel> aMob,
         const Ptr<const MobilityModel> bMob) const;
 
+    /**
+     * Incrementally update the channel parameters between the nodes a and b, instead
+     * of generating a new realization. The large and small scale parameters (delays,
+     * powers, angles, cross polarization ratios) are kept, while the initial phase of each
+     * ray is advanced by the intra-cluster Doppler shift accumulated since the last update,
+     * i.e., the difference between the Doppler of the ray and the Doppler of the center of its
+     * cluster (the latter is applied by the spectrum propagation loss model).
+     * This is a simplified version of the spatial consistency procedure described in
+     * 3GPP TR 38.901, Sec. 7.6.3.
+     *
+     * \param channelParams the channel parameters to be updated
+     * \param aMob the a node mobility model
+     * \param bMob the b node mobility model
+     */
+    void UpdateChannelParameters(Ptr<ThreeGppChannelParams> channelParams,
+                                 const Ptr<const MobilityModel> aMob,
+                                 const Ptr<const MobilityModel> bMob) const;
+
     /**
      * Compute the channel matrix between two nodes a and b, and their
      * antenna arrays aAntenna and bAntenna using the procedure
@@ -353,6 +394,28 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
                              Ptr<const PhasedArrayModel> bAntenna,
                              Ptr<const ChannelMatrix> channelMatrix);
 
+    /**
+     * Retrieve the channel matrix between aAntenna and bAntenna, generating or
+     * updating it if needed. This is the implementation shared by GetChannel and
+     * GetChannels.
+     *
+     * \param aMob mobility model of the a device
+     * \param bMob mobility model of the b device
+     * \param aAntenna antenna of the a device
+     * \param bAntenna antenna of the b device
+     * \param condition the channel condition between a and b
+     * \param table3gpp the 3GPP parameters table between a and b. If it is a nullptr, it
+     * is computed only if a new channel has to be generated, and it is returned to the
+     * caller so that it can be reused for other links between the same nodes
+     * \return the channel matrix
+     */
+    Ptr<const ChannelMatrix> DoGetChannel(Ptr<const MobilityModel> aMob,
+                                          Ptr<const MobilityModel> bMob,
+                                          Ptr<const PhasedArrayModel> aAntenna,
+                                          Ptr<const PhasedArrayModel> bAntenna,
+                                          Ptr<const ChannelCondition> condition,
+                                          Ptr<const ParamsTable>& table3gpp);
+
     std::unordered_map<uint64_t, Ptr<ChannelMatrix>>
         m_channelMatrixMap; //!< map containing the channel realizations per pair of
                             //!< PhasedAntennaArray instances, the key of this map is reciprocal
@@ -362,6 +425,8 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
                             //!< key of this map is reciprocal and uniquely identifies a pair of
                             //!< nodes
     Time m_updatePeriod;    //!< the channel update period
+    bool m_incrementalUpdate; //!< if true, the channel params are evolved instead of regenerated
+                              //!< when the update period expires
     double m_frequency;     //!< the operating frequency
     std::string m_scenario; //!< the 3GPP scenario
     Ptr<ChannelConditionModel> m_channelConditionModel; //!< the channel condition model
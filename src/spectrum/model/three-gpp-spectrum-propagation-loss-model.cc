@@ -20,6 +20,7 @@
 #include "ns3/pointer.h"
 #include "ns3/simulator.h"
 #include "ns3/string.h"
+#include "ns3/uinteger.h"
 
 #include <map>
 
@@ -44,6 +45,8 @@ void
 ThreeGppSpectrumPropagationLossModel::DoDispose()
 {
     m_longTermMap.clear();
+    m_longTermCache.clear();
+    m_longTermLru.clear();
     m_channelModel->Dispose();
     m_channelModel = nullptr;
 }
@@ -62,7 +65,14 @@ ThreeGppSpectrumPropagationLossModel::GetTypeId()
                 StringValue("ns3::ThreeGppChannelModel"),
                 MakePointerAccessor(&ThreeGppSpectrumPropagationLossModel::SetChannelModel,
                                     &ThreeGppSpectrumPropagationLossModel::GetChannelModel),
-                MakePointerChecker<MatrixBasedChannelModel>());
+                MakePointerChecker<MatrixBasedChannelModel>())
+            .AddAttribute("LongTermCacheSize",
+                          "The maximum number of long term components computed for pairs of "
+                          "codebook beams that are cached for later reuse (0 disables the cache)",
+                          UintegerValue(256),
+                          MakeUintegerAccessor(
+                              &ThreeGppSpectrumPropagationLossModel::m_longTermCacheSize),
+                          MakeUintegerChecker<uint32_t>());
     return tid;
 }
 
@@ -308,11 +318,9 @@ ThreeGppSpectrumPropagationLossModel::CalcBeamformingGain(
         // HxP (rxPorts,txStreams, numRbs)
         MatrixBasedChannelModel::Complex3DVector hP =
             *rxParams->spectrumChannelMatrix * (*rxParams->precodingMatrix);
-        // (HxP)^h dimensions are (txStreams, rxPorts, numRbs)
-        MatrixBasedChannelModel::Complex3DVector hPHerm = hP.HermitianTranspose();
-
-        // Finally, (HxP)^h x (HxP) = PSD (txStreams, txStreams, numRbs)
-        MatrixBasedChannelModel::Complex3DVector psd = hPHerm * hP;
+        // Finally, (HxP)^h x (HxP) = PSD (txStreams, txStreams, numRbs),
+        // computed without explicitly transposing HxP
+        MatrixBasedChannelModel::Complex3DVector psd = hP.HermitianTransposeMultiply(hP);
         // Update rxParams->Psd
         for (uint32_t rbIdx = 0; rbIdx < rxParams->psd->GetValuesN(); ++rbIdx)
         {
@@ -472,14 +480,45 @@ ThreeGppSpectrumPropagationLossModel::GetLongTerm(
 
     if (update || notFound)
     {
-        NS_LOG_DEBUG("compute the long term");
-        // compute the long term component
-        longTerm = CalcLongTerm(channelMatrix, sAntenna, uAntenna);
-        Ptr<LongTerm> longTermItem = Create<LongTerm>();
-        longTermItem->m_longTerm = longTerm;
-        longTermItem->m_channel = channelMatrix;
-        longTermItem->m_sW = std::move(sW);
-        longTermItem->m_uW = std::move(uW);
+        // if both the beams were selected from a codebook, the long term component may
+        // have been computed already for the same channel matrix and pair of beams
+        auto sBeamId = sAntenna->GetBeamId();
+        auto uBeamId = uAntenna->GetBeamId();
+        bool useCache = m_longTermCacheSize > 0 && sBeamId && uBeamId;
+        LongTermCacheKey cacheKey;
+        Ptr<const LongTerm> longTermItem;
+
+        if (useCache)
+        {
+            cacheKey = std::make_tuple(PeekPointer(channelMatrix),
+                                       sAntenna->GetCodebookId(),
+                                       *sBeamId,
+                                       uAntenna->GetCodebookId(),
+                                       *uBeamId);
+            longTermItem = LookupLongTermCache(cacheKey);
+        }
+
+        if (longTermItem)
+        {
+            NS_LOG_DEBUG("long term component found in the cache of the codebook beams");
+            longTerm = longTermItem->m_longTerm;
+        }
+        else
+        {
+            NS_LOG_DEBUG("compute the long term");
+            // compute the long term component
+            longTerm = CalcLongTerm(channelMatrix, sAntenna, uAntenna);
+            Ptr<LongTerm> newLongTermItem = Create<LongTerm>();
+            newLongTermItem->m_longTerm = longTerm;
+            newLongTermItem->m_channel = channelMatrix;
+            newLongTermItem->m_sW = std::move(sW);
+            newLongTermItem->m_uW = std::move(uW);
+            longTermItem = newLongTermItem;
+            if (useCache)
+            {
+                AddToLongTermCache(cacheKey, longTermItem);
+            }
+        }
         // store the long term to reduce computation load
         // only the small scale fading needs to be updated if the large scale parameters and antenna
         // weights remain unchanged.
@@ -489,6 +528,37 @@ ThreeGppSpectrumPropagationLossModel::GetLongTerm(
     return longTerm;
 }
 
+Ptr<const ThreeGppSpectrumPropagationLossModel::LongTerm>
+ThreeGppSpectrumPropagationLossModel::LookupLongTermCache(const LongTermCacheKey& key) const
+{
+    auto it = m_longTermCache.find(key);
+    if (it == m_longTermCache.end())
+    {
+        return nullptr;
+    }
+    // move the entry to the front of the list, as it is now the most recently used
+    m_longTermLru.splice(m_longTermLru.begin(), m_longTermLru, it->second);
+    return it->second->second;
+}
+
+void
+ThreeGppSpectrumPropagationLossModel::AddToLongTermCache(const LongTermCacheKey& key,
+                                                         Ptr<const LongTerm> longTerm) const
+{
+    NS_ASSERT(m_longTermCache.find(key) == m_longTermCache.end());
+    if (m_longTermLru.size() >= m_longTermCacheSize)
+    {
+        // evict the least recently used entry
+        m_longTermCache.erase(m_longTermLru.back().first);
+        m_longTermLru.pop_back();
+    }
+    // each entry holds a reference to the channel matrix it was computed for, hence the
+    // address used in the key cannot be reused by another channel matrix while the entry
+    // is in the cache
+    m_longTermLru.emplace_front(key, longTerm);
+    m_longTermCache[key] = m_longTermLru.begin();
+}
+
 Ptr<SpectrumSignalParameters>
 ThreeGppSpectrumPropagationLossModel::DoCalcRxPowerSpectralDensity(
     Ptr<const SpectrumSignalParameters> spectrumSignalParams,
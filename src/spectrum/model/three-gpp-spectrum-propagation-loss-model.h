@@ -16,10 +16,13 @@
 #include "ns3/random-variable-stream.h"
 
 #include <complex.h>
+#include <list>
 #include <map>
+#include <tuple>
 #include <unordered_map>
 
 class ThreeGppCalcLongTermMultiPortTest;
+class ThreeGppLongTermCacheTest;
 class ThreeGppMimoPolarizationTest;
 
 namespace ns3
@@ -44,6 +47,7 @@ class NetDevice;
 class ThreeGppSpectrumPropagationLossModel : public PhasedArraySpectrumPropagationLossModel
 {
     friend class ::ThreeGppCalcLongTermMultiPortTest;
+    friend class ::ThreeGppLongTermCacheTest;
     friend class ::ThreeGppMimoPolarizationTest;
 
   public:
@@ -105,7 +109,10 @@ class ThreeGppSpectrumPropagationLossModel : public PhasedArraySpectrumPropagati
      * the propagation delay.
      * To reduce the computational load, the long term component associated with
      * a certain channel is cached and recomputed only when the channel realization
-     * is updated, or when the beamforming vectors change.
+     * is updated, or when the beamforming vectors change. Moreover, if both the
+     * beamforming vectors were selected from the codebooks of the antenna arrays,
+     * the long term component is stored in a bounded LRU cache, so that it can be
+     * reused whenever the same pair of beams is selected again (e.g., during a beam sweep).
      *
      * \param spectrumSignalParams spectrum signal tx parameters
      * \param a first node mobility model
@@ -235,8 +242,42 @@ class ThreeGppSpectrumPropagationLossModel : public PhasedArraySpectrumPropagati
 
     int64_t DoAssignStreams(int64_t stream) override;
 
+    /**
+     * Key of the long term components cached for codebook beams, made of the channel
+     * matrix, the s codebook ID, the s beam ID, the u codebook ID and the u beam ID.
+     * The codebook IDs change whenever a codebook is set, hence the beam IDs of a
+     * previous codebook do not match the cached entries
+     */
+    using LongTermCacheKey = std::tuple<const MatrixBasedChannelModel::ChannelMatrix*,
+                                        uint64_t,
+                                        uint32_t,
+                                        uint64_t,
+                                        uint32_t>;
+
+    /**
+     * Look for the long term component computed for the given channel matrix and pair
+     * of codebook beams in the LRU cache
+     * \param key the key of the long term component
+     * \return the long term component, or a nullptr if not found
+     */
+    Ptr<const LongTerm> LookupLongTermCache(const LongTermCacheKey& key) const;
+
+    /**
+     * Store the long term component computed for the given channel matrix and pair
+     * of codebook beams in the LRU cache, evicting the least recently used entry
+     * if the cache is full
+     * \param key the key of the long term component
+     * \param longTerm the long term component
+     */
+    void AddToLongTermCache(const LongTermCacheKey& key, Ptr<const LongTerm> longTerm) const;
+
     mutable std::unordered_map<uint64_t, Ptr<const LongTerm>>
         m_longTermMap;                           //!< map containing the long term components
+    uint32_t m_longTermCacheSize; //!< maximum number of entries of the long term LRU cache
+    mutable std::list<std::pair<LongTermCacheKey, Ptr<const LongTerm>>>
+        m_longTermLru; //!< long term components of codebook beams, most recently used first
+    mutable std::map<LongTermCacheKey, decltype(m_longTermLru)::iterator>
+        m_longTermCache; //!< index of the entries of m_longTermLru
     Ptr<MatrixBasedChannelModel> m_channelModel; //!< the model to generate the channel matrix
 };
 } // namespace ns3
@@ -6,9 +6,11 @@
 
 #include "ns3/abort.h"
 #include "ns3/angles.h"
+#include "ns3/boolean.h"
 #include "ns3/channel-condition-model.h"
 #include "ns3/config.h"
 #include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
 #include "ns3/double.h"
 #include "ns3/ism-spectrum-value-helper.h"
 #include "ns3/isotropic-antenna-model.h"
@@ -27,6 +29,7 @@
 #include "ns3/uinteger.h"
 #include "ns3/uniform-planar-array.h"
 
+#include <complex>
 #include <valarray>
 
 using namespace ns3;
@@ -713,6 +716,172 @@ ThreeGppAntennaSetupChangedTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup spectrum-tests
+ *
+ * Test case for the incremental update mode and the batched channel retrieval
+ * of the ThreeGppChannelModel class.
+ * 1) checks that, when the update period expires, the channel parameters are evolved
+ *    (same delays and cluster powers) and the channel matrix is recomputed
+ * 2) checks that the ray phases rotated by two successive updates match the phases
+ *    computed from the initial ones over the whole interval at once
+ * 3) checks that GetChannels returns the same channel matrices as GetChannel
+ */
+class ThreeGppChannelIncrementalUpdateTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     */
+    ThreeGppChannelIncrementalUpdateTest();
+
+  private:
+    /**
+     * Build the test scenario
+     */
+    void DoRun() override;
+
+    /**
+     * Gives access to the 3GPP specific channel parameters
+     */
+    class ChannelModelAccess : public ThreeGppChannelModel
+    {
+      public:
+        /**
+         * \param params the channel parameters returned by GetParams
+         * 
+eturn the 3GPP channel parameters
+         */
+        static Ptr<const ThreeGppChannelParams> GetThreeGppParams(
+            Ptr<const ChannelParams> params)
+        {
+            return DynamicCast<const ThreeGppChannelParams>(params);
+        }
+    };
+};
+
+ThreeGppChannelIncrementalUpdateTest::ThreeGppChannelIncrementalUpdateTest()
+    : TestCase("Check the incremental update of the channel realizations and the batched "
+               "channel retrieval")
+{
+}
+
+void
+ThreeGppChannelIncrementalUpdateTest::DoRun()
+{
+    uint32_t updatePeriodMs = 10; // update period in ms
+
+    Ptr<ThreeGppChannelModel> channelModel = CreateObject<ThreeGppChannelModel>();
+    channelModel->SetAttribute("Frequency", DoubleValue(28.0e9));
+    channelModel->SetAttribute("Scenario", StringValue("UMi-StreetCanyon"));
+    channelModel->SetAttribute("ChannelConditionModel",
+                               PointerValue(CreateObject<AlwaysLosChannelConditionModel>()));
+    channelModel->SetAttribute("UpdatePeriod", TimeValue(MilliSeconds(updatePeriodMs)));
+    channelModel->SetAttribute("IncrementalUpdate", BooleanValue(true));
+
+    // create the tx and rx nodes, the rx node is moving
+    NodeContainer nodes;
+    nodes.Create(2);
+    Ptr<MobilityModel> txMob = CreateObject<ConstantPositionMobilityModel>();
+    txMob->SetPosition(Vector(0.0, 0.0, 10.0));
+    Ptr<ConstantVelocityMobilityModel> rxMob = CreateObject<ConstantVelocityMobilityModel>();
+    rxMob->SetPosition(Vector(50.0, 0.0, 1.6));
+    rxMob->SetVelocity(Vector(0.0, 20.0, 0.0));
+    nodes.Get(0)->AggregateObject(txMob);
+    nodes.Get(1)->AggregateObject(rxMob);
+
+    Ptr<PhasedArrayModel> txAntenna = CreateObjectWithAttributes<UniformPlanarArray>(
+        "NumColumns",
+        UintegerValue(4),
+        "NumRows",
+        UintegerValue(4),
+        "AntennaElement",
+        PointerValue(CreateObject<IsotropicAntennaModel>()));
+    Ptr<PhasedArrayModel> rxAntenna = CreateObjectWithAttributes<UniformPlanarArray>(
+        "NumColumns",
+        UintegerValue(2),
+        "NumRows",
+        UintegerValue(2),
+        "AntennaElement",
+        PointerValue(CreateObject<IsotropicAntennaModel>()));
+
+    Ptr<const ThreeGppChannelModel::ChannelMatrix> firstChannel;
+    MatrixBasedChannelModel::DoubleVector firstDelays;
+    MatrixBasedChannelModel::Double3DVector firstPhases;
+
+    Simulator::Schedule(MilliSeconds(1), [&]() {
+        firstChannel = channelModel->GetChannel(txMob, rxMob, txAntenna, rxAntenna);
+        firstDelays = channelModel->GetParams(txMob, rxMob)->m_delay;
+        firstPhases = ChannelModelAccess::GetThreeGppParams(channelModel->GetParams(txMob, rxMob))
+                          ->m_clusterPhase;
+    });
+
+    // intermediate update, the ray phases are rotated a first time
+    Simulator::Schedule(MilliSeconds(2 + updatePeriodMs), [&]() {
+        channelModel->GetChannel(txMob, rxMob, txAntenna, rxAntenna);
+    });
+
+    Simulator::Schedule(MilliSeconds(3 + 2 * updatePeriodMs), [&]() {
+        auto channel = channelModel->GetChannel(txMob, rxMob, txAntenna, rxAntenna);
+        auto params = channelModel->GetParams(txMob, rxMob);
+
+        // compute the ray phases from the initial ones over the whole interval: the tx node
+        // (s node) is static and the rx node (u node) moves at a constant velocity
+        auto threeGppParams = ChannelModelAccess::GetThreeGppParams(params);
+        const auto speed = rxMob->GetVelocity();
+        const double factor = 2 * M_PI * (Simulator::Now() - MilliSeconds(1)).GetSeconds() *
+                              28.0e9 / 3e8;
+        for (std::size_t n = 0; n < threeGppParams->m_reducedClusterNumber; n++)
+        {
+            const auto& zoa = params->m_cachedAngleSincos[MatrixBasedChannelModel::ZOA_INDEX][n];
+            const auto& aoa = params->m_cachedAngleSincos[MatrixBasedChannelModel::AOA_INDEX][n];
+            const double clusterDoppler = zoa.first * aoa.second * speed.x +
+                                          zoa.first * aoa.first * speed.y + zoa.second * speed.z;
+            for (std::size_t m = 0; m < firstPhases[n].size(); m++)
+            {
+                const double rayZoa = threeGppParams->m_rayZoaRadian[n][m];
+                const double rayAoa = threeGppParams->m_rayAoaRadian[n][m];
+                const double rayDoppler = sin(rayZoa) * cos(rayAoa) * speed.x +
+                                          sin(rayZoa) * sin(rayAoa) * speed.y +
+                                          cos(rayZoa) * speed.z;
+                for (std::size_t i = 0; i < firstPhases[n][m].size(); i++)
+                {
+                    const double expected =
+                        WrapToPi(firstPhases[n][m][i] + factor * (rayDoppler - clusterDoppler));
+                    // compare the phases on the unit circle, to ignore the wrapping
+                    const double phase = threeGppParams->m_clusterPhase[n][m][i];
+                    NS_TEST_ASSERT_MSG_EQ_TOL(std::abs(std::polar(1.0, phase) -
+                                                       std::polar(1.0, expected)),
+                                              0.0,
+                                              1e-6,
+                                              "Unexpected phase of ray " << m << " of cluster "
+                                                                         << n);
+                }
+            }
+        }
+        NS_TEST_ASSERT_MSG_EQ((firstChannel->m_channel != channel->m_channel),
+                              true,
+                              "The channel matrix should have been recomputed");
+        NS_TEST_ASSERT_MSG_EQ((params->m_delay == firstDelays),
+                              true,
+                              "The cluster delays should be kept by the incremental update");
+        NS_TEST_ASSERT_MSG_EQ(params->m_generatedTime,
+                              Simulator::Now(),
+                              "The channel params generation time should be updated");
+
+        // the batched retrieval returns the cached channel matrices, in both directions
+        auto channels =
+            channelModel->GetChannels({{txMob, rxMob, txAntenna, rxAntenna},
+                                       {rxMob, txMob, rxAntenna, txAntenna}});
+        NS_TEST_ASSERT_MSG_EQ(channels.size(), 2, "Unexpected number of channel matrices");
+        NS_TEST_ASSERT_MSG_EQ(channels[0], channel, "GetChannels and GetChannel differ");
+        NS_TEST_ASSERT_MSG_EQ(channels[1], channel, "GetChannels and GetChannel differ");
+    });
+
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup spectrum-tests
  * \brief A structure that holds the parameters for the function
@@ -1215,6 +1384,132 @@ struct MimoPolarizationAntennaParams
     }
 };
 
+/**
+ * \ingroup spectrum-tests
+ *
+ * Test case for the cache of the long term components computed for pairs of
+ * codebook beams in ThreeGppSpectrumPropagationLossModel.
+ * 1) checks that the long term component of a pair of codebook beams is reused when
+ *    the same pair of beams is selected again
+ * 2) checks that the cached long term component is equal to the one computed from scratch
+ * 3) checks that the least recently used entry is evicted when the cache is full
+ * 4) checks that the cached long term components are not reused after the codebook
+ *    is changed, even if the beam IDs are the same
+ */
+class ThreeGppLongTermCacheTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     */
+    ThreeGppLongTermCacheTest();
+
+  private:
+    /**
+     * Build the test scenario
+     */
+    void DoRun() override;
+};
+
+ThreeGppLongTermCacheTest::ThreeGppLongTermCacheTest()
+    : TestCase("Check the cache of the long term components of codebook beams")
+{
+}
+
+void
+ThreeGppLongTermCacheTest::DoRun()
+{
+    Ptr<ThreeGppChannelModel> channelModel = CreateObject<ThreeGppChannelModel>();
+    channelModel->SetAttribute("Frequency", DoubleValue(28.0e9));
+    channelModel->SetAttribute("Scenario", StringValue("UMa"));
+    channelModel->SetAttribute("ChannelConditionModel",
+                               PointerValue(CreateObject<AlwaysLosChannelConditionModel>()));
+
+    NodeContainer nodes;
+    nodes.Create(2);
+    Ptr<MobilityModel> txMob = CreateObject<ConstantPositionMobilityModel>();
+    txMob->SetPosition(Vector(0.0, 0.0, 10.0));
+    Ptr<MobilityModel> rxMob = CreateObject<ConstantPositionMobilityModel>();
+    rxMob->SetPosition(Vector(100.0, 0.0, 1.6));
+    nodes.Get(0)->AggregateObject(txMob);
+    nodes.Get(1)->AggregateObject(rxMob);
+
+    Ptr<PhasedArrayModel> txAntenna = CreateObjectWithAttributes<UniformPlanarArray>(
+        "NumColumns",
+        UintegerValue(4),
+        "NumRows",
+        UintegerValue(4),
+        "AntennaElement",
+        PointerValue(CreateObject<IsotropicAntennaModel>()));
+    Ptr<PhasedArrayModel> rxAntenna = CreateObjectWithAttributes<UniformPlanarArray>(
+        "NumColumns",
+        UintegerValue(2),
+        "NumRows",
+        UintegerValue(2),
+        "AntennaElement",
+        PointerValue(CreateObject<IsotropicAntennaModel>()));
+
+    // codebooks made of three beams, equally spaced in azimuth
+    std::vector<Angles> directions{Angles(-M_PI / 3, M_PI / 2),
+                                   Angles(0, M_PI / 2),
+                                   Angles(M_PI / 3, M_PI / 2)};
+    txAntenna->SetCodebook(directions);
+    rxAntenna->SetCodebook(directions);
+    NS_TEST_ASSERT_MSG_EQ(txAntenna->GetCodebookSize(), 3, "Unexpected codebook size");
+
+    auto channelMatrix = channelModel->GetChannel(txMob, rxMob, txAntenna, rxAntenna);
+
+    Ptr<ThreeGppSpectrumPropagationLossModel> lossModel =
+        CreateObject<ThreeGppSpectrumPropagationLossModel>();
+    lossModel->SetAttribute("LongTermCacheSize", UintegerValue(2));
+
+    txAntenna->SetBeamformingVectorFromCodebook(0);
+    rxAntenna->SetBeamformingVectorFromCodebook(0);
+    NS_TEST_ASSERT_MSG_EQ(txAntenna->GetBeamId().value(), 0, "Unexpected beam ID");
+    auto longTerm00 = lossModel->GetLongTerm(channelMatrix, txAntenna, rxAntenna);
+
+    txAntenna->SetBeamformingVectorFromCodebook(1);
+    auto longTerm10 = lossModel->GetLongTerm(channelMatrix, txAntenna, rxAntenna);
+    NS_TEST_ASSERT_MSG_NE(longTerm10, longTerm00, "Different beams should not share long terms");
+
+    // sweep back to the first pair of beams, the long term component is reused
+    txAntenna->SetBeamformingVectorFromCodebook(0);
+    auto longTerm00Again = lossModel->GetLongTerm(channelMatrix, txAntenna, rxAntenna);
+    NS_TEST_ASSERT_MSG_EQ(longTerm00Again, longTerm00, "The long term should have been reused");
+
+    // the cached long term component is the same that would be computed from scratch
+    auto expected = lossModel->CalcLongTerm(channelMatrix, txAntenna, rxAntenna);
+    NS_TEST_ASSERT_MSG_EQ((*longTerm00Again == *expected),
+                          true,
+                          "The cached long term component is not correct");
+
+    // a third pair of beams evicts the least recently used one, i.e., (1, 0)
+    rxAntenna->SetBeamformingVectorFromCodebook(2);
+    lossModel->GetLongTerm(channelMatrix, txAntenna, rxAntenna);
+    txAntenna->SetBeamformingVectorFromCodebook(1);
+    rxAntenna->SetBeamformingVectorFromCodebook(0);
+    auto longTerm10Again = lossModel->GetLongTerm(channelMatrix, txAntenna, rxAntenna);
+    NS_TEST_ASSERT_MSG_NE(longTerm10Again, longTerm10, "The entry should have been evicted");
+
+    // beamforming vectors set directly are not associated with a codebook beam
+    txAntenna->SetBeamformingVector(txAntenna->GetCodebookEntry(0));
+    NS_TEST_ASSERT_MSG_EQ(txAntenna->GetBeamId().has_value(), false, "Unexpected beam ID");
+
+    // change the tx codebook: the same beam IDs now refer to different beamforming vectors
+    txAntenna->SetCodebook(std::vector<Angles>{Angles(M_PI / 3, M_PI / 2),
+                                               Angles(M_PI / 2, M_PI / 2),
+                                               Angles(2 * M_PI / 3, M_PI / 2)});
+    // (1, 0) is in the cache, but it was computed with the previous codebook
+    txAntenna->SetBeamformingVectorFromCodebook(1);
+    auto longTermNew10 = lossModel->GetLongTerm(channelMatrix, txAntenna, rxAntenna);
+    expected = lossModel->CalcLongTerm(channelMatrix, txAntenna, rxAntenna);
+    NS_TEST_ASSERT_MSG_EQ((*longTermNew10 == *expected),
+                          true,
+                          "The long term of the previous codebook should not be reused");
+
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup spectrum-tests
  * This test tests that the channel matrix is correctly generated when dual-polarized
@@ -1457,6 +1752,7 @@ ThreeGppChannelTestSuite::ThreeGppChannelTestSuite()
     AddTestCase(new ThreeGppChannelMatrixUpdateTest(2, 4, 2, 2), TestCase::Duration::QUICK);
     AddTestCase(new ThreeGppChannelMatrixUpdateTest(2, 2, 2, 2), TestCase::Duration::QUICK);
     AddTestCase(new ThreeGppAntennaSetupChangedTest(), TestCase::Duration::QUICK);
+    AddTestCase(new ThreeGppChannelIncrementalUpdateTest(), TestCase::Duration::QUICK);
     AddTestCase(new ThreeGppSpectrumPropagationLossModelTest(4, 4, 1, 1),
                 TestCase::Duration::QUICK);
     AddTestCase(new ThreeGppSpectrumPropagationLossModelTest(4, 4, 2, 2),
@@ -1466,6 +1762,7 @@ ThreeGppChannelTestSuite::ThreeGppChannelTestSuite()
     AddTestCase(new ThreeGppSpectrumPropagationLossModelTest(4, 2, 2, 1),
                 TestCase::Duration::QUICK);
     AddTestCase(new ThreeGppCalcLongTermMultiPortTest(), TestCase::Duration::QUICK);
+    AddTestCase(new ThreeGppLongTermCacheTest(), TestCase::Duration::QUICK);
 
     /**
      *  The TX and RX antennas are configured face-to-face.
@@ -16,6 +16,7 @@
 #include "uan-transducer.h"
 #include "uan-tx-mode.h"
 
+#include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/mobility-model.h"
 #include "ns3/net-device.h"
@@ -49,7 +50,15 @@ UanChannel::GetTypeId()
                                           "A pointer to the model of the channel ambient noise.",
                                           StringValue("ns3::UanNoiseModelDefault"),
                                           MakePointerAccessor(&UanChannel::m_noise),
-                                          MakePointerChecker<UanNoiseModel>());
+                                          MakePointerChecker<UanNoiseModel>())
+                            .AddAttribute("MaxRange",
+                                          "Maximum distance (m) between the transmitter and the "
+                                          "receivers of a packet. Farther receivers are skipped "
+                                          "without evaluating the propagation model. "
+                                          "0 means no limit.",
+                                          DoubleValue(0.0),
+                                          MakeDoubleAccessor(&UanChannel::m_maxRange),
+                                          MakeDoubleChecker<double>(0.0));
 
     return tid;
 }
@@ -57,7 +66,8 @@ UanChannel::GetTypeId()
 UanChannel::UanChannel()
     : Channel(),
       m_prop(nullptr),
-      m_cleared(false)
+      m_cleared(false),
+      m_maxRange(0.0)
 {
 }
 
@@ -88,6 +98,7 @@ UanChannel::Clear()
         }
     }
     m_devList.clear();
+    m_mobility.clear();
     if (m_prop)
     {
         m_prop->Clear();
@@ -131,6 +142,17 @@ UanChannel::AddDevice(Ptr<UanNetDevice> dev, Ptr<UanTransducer> trans)
 {
     NS_LOG_DEBUG("Adding dev/trans pair number " << m_devList.size());
     m_devList.emplace_back(dev, trans);
+    m_mobility.emplace_back(nullptr);
+}
+
+Ptr<MobilityModel>
+UanChannel::GetMobility(uint32_t i)
+{
+    if (!m_mobility[i])
+    {
+        m_mobility[i] = m_devList[i].first->GetNode()->GetObject<MobilityModel>();
+    }
+    return m_mobility[i];
 }
 
 void
@@ -139,11 +161,11 @@ UanChannel::TxPacket(Ptr<UanTransducer> src, Ptr<Packet> packet, double txPowerD
     Ptr<MobilityModel> senderMobility = nullptr;
 
     NS_LOG_DEBUG("Channel scheduling");
-    for (auto i = m_devList.begin(); i != m_devList.end(); i++)
+    for (uint32_t j = 0; j < m_devList.size(); j++)
     {
-        if (src == i->second)
+        if (src == m_devList[j].second)
         {
-            senderMobility = i->first->GetNode()->GetObject<MobilityModel>();
+            senderMobility = GetMobility(j);
             break;
         }
     }
@@ -154,8 +176,14 @@ UanChannel::TxPacket(Ptr<UanTransducer> src, Ptr<Packet> packet, double txPowerD
     {
         if (src != i->second)
         {
+            Ptr<MobilityModel> rcvrMobility = GetMobility(j);
+            if (m_maxRange > 0 && senderMobility->GetDistanceFrom(rcvrMobility) > m_maxRange)
+            {
+                NS_LOG_DEBUG("Skipping " << i->first->GetMac()->GetAddress() << ", out of range");
+                j++;
+                continue;
+            }
             NS_LOG_DEBUG("Scheduling " << i->first->GetMac()->GetAddress());
-            Ptr<MobilityModel> rcvrMobility = i->first->GetNode()->GetObject<MobilityModel>();
             Time delay = m_prop->GetDelay(senderMobility, rcvrMobility, txMode);
             UanPdp pdp = m_prop->GetPdp(senderMobility, rcvrMobility, txMode);
             double rxPowerDb =
@@ -109,6 +109,18 @@ class UanChannel : public Channel
     Ptr<UanNoiseModel> m_noise; //!< The noise model.
     /** Has Clear ever been called on the channel. */
     bool m_cleared;
+    /** Maximum distance of the receivers of a packet, in m (0 means no limit). */
+    double m_maxRange;
+    /** Mobility models of the devices, in the same order as m_devList. */
+    std::vector<Ptr<MobilityModel>> m_mobility;
+
+    /**
+     * Get the mobility model of a device, caching it after the first lookup.
+     *
+     * \param i Device number.
+     * \return The mobility model of the node of the device.
+     */
+    Ptr<MobilityModel> GetMobility(uint32_t i);
 
     /**
      * Send a packet up to the receiving UanTransducer.
@@ -20,6 +20,8 @@ NS_LOG_COMPONENT_DEFINE("UanPropModelThorp");
 NS_OBJECT_ENSURE_REGISTERED(UanPropModelThorp);
 
 UanPropModelThorp::UanPropModelThorp()
+    : m_lastFreqKhz(-1.0),
+      m_lastAttenDbKm(0.0)
 {
 }
 
@@ -73,6 +75,12 @@ UanPropModelThorp::GetAttenDbKyd(double freqKhz)
 double
 UanPropModelThorp::GetAttenDbKm(double freqKhz)
 {
+    // Channels typically use a single frequency, hence only the last value is cached
+    if (freqKhz == m_lastFreqKhz)
+    {
+        return m_lastAttenDbKm;
+    }
+
     double fsq = freqKhz * freqKhz;
     double atten;
 
@@ -85,6 +93,8 @@ UanPropModelThorp::GetAttenDbKm(double freqKhz)
         atten = 0.002 + 0.11 * (fsq / (1 + fsq)) + 0.011 * fsq;
     }
 
+    m_lastFreqKhz = freqKhz;
+    m_lastAttenDbKm = atten;
     return atten;
 }
 
@@ -56,6 +56,9 @@ class UanPropModelThorp : public UanPropModel
 
     double m_SpreadCoef; //!< Spreading coefficient used in calculation of Thorp's approximation.
 
+    double m_lastFreqKhz;   //!< Frequency of the last attenuation computed, in kHz.
+    double m_lastAttenDbKm; //!< Last attenuation computed, in dB / km.
+
 }; // class UanPropModelThorp
 
 } // namespace ns3
@@ -7,7 +7,9 @@
  */
 
 #include "ns3/callback.h"
+#include "ns3/config.h"
 #include "ns3/constant-position-mobility-model.h"
+#include "ns3/double.h"
 #include "ns3/node.h"
 #include "ns3/object-factory.h"
 #include "ns3/pointer.h"
@@ -188,6 +190,18 @@ UanTest::DoPhyTests()
                                        0,
                                        "Expected collision resulting in loss of both packets");
 
+    // Collision with a farther interferer (Lose both packets)
+    NS_TEST_ASSERT_MSG_EQ_RETURNS_BOOL(DoOnePhyTest(Seconds(1.0), Seconds(2.9), 50, 100, prop),
+                                       0,
+                                       "Expected collision resulting in loss of both packets");
+
+    // The interferer is beyond the maximum range of the channel (Get 1 packet)
+    Config::SetDefault("ns3::UanChannel::MaxRange", DoubleValue(75));
+    NS_TEST_ASSERT_MSG_EQ_RETURNS_BOOL(DoOnePhyTest(Seconds(1.0), Seconds(2.9), 50, 100, prop),
+                                       17,
+                                       "Should have received 17 bytes, interferer out of range");
+    Config::SetDefault("ns3::UanChannel::MaxRange", DoubleValue(0));
+
     // Phy Gen / FH-FSK SINR check
 
     Ptr<UanPhyCalcSinrFhFsk> sinrFhfsk = CreateObject<UanPhyCalcSinrFhFsk>();
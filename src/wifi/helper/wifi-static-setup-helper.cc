@@ -0,0 +1,201 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "wifi-static-setup-helper.h"
+
+#include "ns3/abort.h"
+#include "ns3/ap-wifi-mac.h"
+#include "ns3/block-ack-manager.h"
+#include "ns3/frame-exchange-manager.h"
+#include "ns3/log.h"
+#include "ns3/mac-rx-middle.h"
+#include "ns3/mac-tx-middle.h"
+#include "ns3/mgt-action-headers.h"
+#include "ns3/mgt-headers.h"
+#include "ns3/net-device-container.h"
+#include "ns3/node.h"
+#include "ns3/qos-txop.h"
+#include "ns3/simulator.h"
+#include "ns3/sta-wifi-mac.h"
+#include "ns3/status-code.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/wifi-remote-station-manager.h"
+
+#include <algorithm>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("WifiStaticSetupHelper");
+
+void
+WifiStaticSetupHelper::SetStaticAssociation(Ptr<WifiNetDevice> apDev,
+                                            const NetDeviceContainer& clientDevs,
+                                            bool suppressBeacons)
+{
+    NS_LOG_FUNCTION(apDev << suppressBeacons);
+    NS_ASSERT(apDev);
+    auto apMac = DynamicCast<ApWifiMac>(apDev->GetMac());
+    NS_ABORT_MSG_IF(!apMac, "The given device is not an AP");
+    NS_ABORT_MSG_IF(apMac->GetNLinks() > 1, "Multi-link devices are not supported");
+
+    if (suppressBeacons)
+    {
+        apMac->SetBeaconGeneration(false);
+        // capture a plain pointer to avoid a reference cycle between the AP and the callback
+        auto ap = PeekPointer(apMac);
+        Callback<void, uint16_t, Mac48Address> resumeBeacons(
+            [ap](uint16_t /* aid */, Mac48Address address) {
+                NS_LOG_DEBUG("Station " << address << " disassociated, resume beaconing");
+                ap->SetBeaconGeneration(true);
+            });
+        apMac->m_deAssocLogger.ConnectWithoutContext(resumeBeacons);
+    }
+
+    for (auto it = clientDevs.Begin(); it != clientDevs.End(); ++it)
+    {
+        auto dev = DynamicCast<WifiNetDevice>(*it);
+        NS_ASSERT(dev);
+        auto staMac = DynamicCast<StaWifiMac>(dev->GetMac());
+        NS_ABORT_MSG_IF(!staMac, "Device " << dev->GetAddress() << " is not a non-AP STA");
+        // devices are initialized at time zero by their node, so the events scheduled
+        // here are executed after the initialization (which starts scanning)
+        Simulator::ScheduleWithContext(dev->GetNode()->GetId(),
+                                       Seconds(0),
+                                       &WifiStaticSetupHelper::DoStaticAssociation,
+                                       apMac,
+                                       staMac);
+    }
+}
+
+void
+WifiStaticSetupHelper::SetStaticBlockAck(Ptr<WifiNetDevice> apDev,
+                                         const NetDeviceContainer& clientDevs,
+                                         const std::set<uint8_t>& tids,
+                                         WifiDirection direction)
+{
+    NS_LOG_FUNCTION(apDev << direction);
+    NS_ASSERT(apDev);
+    Ptr<WifiMac> apMac = apDev->GetMac();
+
+    for (auto it = clientDevs.Begin(); it != clientDevs.End(); ++it)
+    {
+        auto dev = DynamicCast<WifiNetDevice>(*it);
+        NS_ASSERT(dev);
+        Ptr<WifiMac> staMac = dev->GetMac();
+
+        for (const auto tid : tids)
+        {
+            NS_ABORT_MSG_IF(tid > 7, "Invalid TID " << +tid);
+            if (direction != WifiDirection::UPLINK)
+            {
+                Simulator::ScheduleWithContext(apDev->GetNode()->GetId(),
+                                               Seconds(0),
+                                               &WifiStaticSetupHelper::DoStaticBlockAck,
+                                               apMac,
+                                               staMac,
+                                               tid);
+            }
+            if (direction != WifiDirection::DOWNLINK)
+            {
+                Simulator::ScheduleWithContext(dev->GetNode()->GetId(),
+                                               Seconds(0),
+                                               &WifiStaticSetupHelper::DoStaticBlockAck,
+                                               staMac,
+                                               apMac,
+                                               tid);
+            }
+        }
+    }
+}
+
+void
+WifiStaticSetupHelper::DoStaticAssociation(Ptr<ApWifiMac> apMac, Ptr<StaWifiMac> staMac)
+{
+    NS_LOG_FUNCTION(apMac << staMac);
+    NS_ABORT_MSG_IF(staMac->GetNLinks() > 1, "Multi-link devices are not supported");
+
+    const uint8_t linkId = SINGLE_LINK_OP_ID;
+    const auto apAddr = apMac->GetFrameExchangeManager(linkId)->GetAddress();
+    const auto staAddr = staMac->GetFrameExchangeManager(linkId)->GetAddress();
+
+    // the station learns about the AP as if it had received a Probe Response during scanning
+    staMac->UpdateApInfo(apMac->GetProbeResp(linkId), apAddr, apAddr, linkId);
+    staMac->GetLink(linkId).bssid = apAddr;
+
+    // the AP processes the Association Request and the Association Response is acknowledged
+    auto assocReq = std::get<MgtAssocRequestHeader>(staMac->GetAssociationRequest(false, linkId));
+    NS_ABORT_MSG_IF(!apMac->ReceiveAssocRequest(assocReq, staAddr, linkId),
+                    "Association of " << staAddr << " refused by " << apAddr);
+    auto assocResp = apMac->GetAssocResp(staAddr, linkId);
+    apMac->SetAid(assocResp, apMac->GetLinkIdStaAddrMap(assocResp, staAddr, linkId));
+    apMac->GetWifiRemoteStationManager(linkId)->RecordGotAssocTxOk(staAddr);
+
+    // the station processes the Association Response. Setting the state to ASSOCIATED
+    // also makes the station ignore the end of the scanning procedure started at
+    // initialization. The beacon watchdog is not started, hence the station does not
+    // disassociate if the AP does not transmit Beacon frames.
+    staMac->m_aid = assocResp.GetAssociationId();
+    staMac->UpdateApInfo(assocResp, apAddr, apAddr, linkId);
+    staMac->SetBssid(apAddr, linkId);
+    staMac->SetState(StaWifiMac::ASSOCIATED);
+    NS_LOG_DEBUG("Station " << staAddr << " associated with AP " << apAddr << " (AID "
+                            << staMac->m_aid << ")");
+    staMac->m_assocLogger(apAddr);
+    if (!staMac->m_linkUp.IsNull())
+    {
+        staMac->m_linkUp();
+    }
+}
+
+void
+WifiStaticSetupHelper::DoStaticBlockAck(Ptr<WifiMac> originator,
+                                        Ptr<WifiMac> recipient,
+                                        uint8_t tid)
+{
+    NS_LOG_FUNCTION(originator << recipient << +tid);
+
+    const auto originatorAddr = originator->GetAddress();
+    const auto recipientAddr = recipient->GetAddress();
+    NS_ABORT_MSG_IF(!originator->GetHtSupported(recipientAddr) ||
+                        !recipient->GetHtSupported(originatorAddr),
+                    "Block Ack agreements require HT support at both "
+                        << originatorAddr << " and " << recipientAddr);
+
+    const auto startingSeq =
+        originator->m_txMiddle->GetNextSeqNumberByTidAndAddress(tid, recipientAddr);
+
+    // the ADDBA Request and ADDBA Response frames are built as by HtFrameExchangeManager
+    MgtAddBaRequestHeader reqHdr;
+    reqHdr.SetAmsduSupport(true);
+    reqHdr.SetImmediateBlockAck();
+    reqHdr.SetTid(tid);
+    reqHdr.SetBufferSize(0);
+    reqHdr.SetTimeout(0);
+    reqHdr.SetStartingSequence(startingSeq);
+
+    MgtAddBaResponseHeader respHdr;
+    StatusCode code;
+    code.SetSuccess();
+    respHdr.SetStatusCode(code);
+    respHdr.SetAmsduSupport(reqHdr.IsAmsduSupported());
+    respHdr.SetImmediateBlockAck();
+    respHdr.SetTid(tid);
+    respHdr.SetBufferSize(
+        std::min(recipient->GetMpduBufferSize(), recipient->GetMaxBaBufferSize(originatorAddr)));
+    respHdr.SetTimeout(reqHdr.GetTimeout());
+
+    recipient->GetQosTxop(tid)->GetBaManager()->CreateRecipientAgreement(respHdr,
+                                                                         originatorAddr,
+                                                                         startingSeq,
+                                                                         recipient->m_rxMiddle);
+
+    auto qosTxop = originator->GetQosTxop(tid);
+    qosTxop->GetBaManager()->CreateOriginatorAgreement(reqHdr, recipientAddr);
+    qosTxop->GotAddBaResponse(respHdr, recipientAddr);
+    NS_LOG_DEBUG("Block Ack agreement established between originator "
+                 << originatorAddr << " and recipient " << recipientAddr << " for TID " << +tid);
+}
+
+} // namespace ns3
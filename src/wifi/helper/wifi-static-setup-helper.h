@@ -0,0 +1,96 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef WIFI_STATIC_SETUP_HELPER_H
+#define WIFI_STATIC_SETUP_HELPER_H
+
+#include "ns3/ptr.h"
+#include "ns3/wifi-utils.h"
+
+#include <set>
+
+namespace ns3
+{
+
+class ApWifiMac;
+class NetDeviceContainer;
+class StaWifiMac;
+class WifiMac;
+class WifiNetDevice;
+
+/**
+ * \ingroup wifi
+ *
+ * Helper to bring a BSS to its steady state without exchanging management frames
+ * over the air. This is useful for large topologies, where scanning, association
+ * and Block Ack agreement establishment would otherwise take a significant amount
+ * of simulated time (and of events) before the measurements can start.
+ *
+ * The helper schedules the setup at time zero, after the initialization of the
+ * devices (hence, its methods must be called after the devices have been installed
+ * and before the simulation starts):
+ *
+ * - SetStaticAssociation() associates non-AP STAs with an AP: the stations stop
+ *   scanning, the AP and the stations record the capabilities of each other in their
+ *   remote station managers (from the Probe Response and the (Re)Association frames
+ *   that would have been exchanged) and an AID is assigned to every station;
+ * - SetStaticBlockAck() establishes Block Ack agreements between an AP and its
+ *   (statically) associated stations, for the given TIDs.
+ *
+ * Only single link devices are supported. Stations are associated in active mode and
+ * the agreements have no inactivity timeout.
+ */
+class WifiStaticSetupHelper
+{
+  public:
+    /**
+     * Associate the given non-AP STAs with the given AP at the beginning of the simulation.
+     * If beacons are suppressed, the AP does not transmit Beacon frames until a station
+     * disassociates, so that statically associated stations never miss beacons.
+     *
+     * \param apDev the AP device
+     * \param clientDevs the non-AP STA devices
+     * \param suppressBeacons whether the AP transmits Beacon frames only after the first
+     *                        disassociation
+     */
+    static void SetStaticAssociation(Ptr<WifiNetDevice> apDev,
+                                     const NetDeviceContainer& clientDevs,
+                                     bool suppressBeacons = false);
+
+    /**
+     * Establish Block Ack agreements between the given AP and the given non-AP STAs at the
+     * beginning of the simulation. This method must be called after SetStaticAssociation().
+     *
+     * \param apDev the AP device
+     * \param clientDevs the non-AP STA devices
+     * \param tids the TIDs for which agreements are established
+     * \param direction the direction of the agreements (downlink if the AP is the originator)
+     */
+    static void SetStaticBlockAck(Ptr<WifiNetDevice> apDev,
+                                  const NetDeviceContainer& clientDevs,
+                                  const std::set<uint8_t>& tids,
+                                  WifiDirection direction = WifiDirection::BOTH_DIRECTIONS);
+
+  private:
+    /**
+     * Associate the given non-AP STA with the given AP.
+     *
+     * \param apMac the MAC of the AP
+     * \param staMac the MAC of the non-AP STA
+     */
+    static void DoStaticAssociation(Ptr<ApWifiMac> apMac, Ptr<StaWifiMac> staMac);
+
+    /**
+     * Establish a Block Ack agreement for the given TID between the given devices.
+     *
+     * \param originator the MAC of the originator
+     * \param recipient the MAC of the recipient
+     * \param tid the TID
+     */
+    static void DoStaticBlockAck(Ptr<WifiMac> originator, Ptr<WifiMac> recipient, uint8_t tid);
+};
+
+} // namespace ns3
+
+#endif /* WIFI_STATIC_SETUP_HELPER_H */
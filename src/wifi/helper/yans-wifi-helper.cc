@@ -89,6 +89,12 @@ YansWifiPhyHelper::SetChannel(std::string channelName)
     m_channel = channel;
 }
 
+void
+YansWifiPhyHelper::SetLinkAbstraction(bool enable)
+{
+    m_phys.front().SetTypeId(enable ? "ns3::LinkAbstractionWifiPhy" : "ns3::YansWifiPhy");
+}
+
 std::vector<Ptr<WifiPhy>>
 YansWifiPhyHelper::Create(Ptr<Node> node, Ptr<WifiNetDevice> device) const
 {
@@ -125,6 +125,15 @@ class YansWifiPhyHelper : public WifiPhyHelper
      * Every PHY created by a call to Install is associated to this channel.
      */
     void SetChannel(std::string channelName);
+    /**
+     * \param enable whether to create LinkAbstractionWifiPhy objects instead of
+     *        YansWifiPhy objects
+     *
+     * The LinkAbstractionWifiPhy replaces the per-PPDU signal processing by SINR
+     * to PER lookups and a simplified collision model. The attributes previously set
+     * through Set() are kept.
+     */
+    void SetLinkAbstraction(bool enable);
 
   private:
     /**
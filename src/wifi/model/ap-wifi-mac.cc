@@ -1045,18 +1045,9 @@ ApWifiMac::GetEhtOperation(uint8_t linkId) const
     return operation;
 }
 
-void
-ApWifiMac::SendProbeResp(Mac48Address to, uint8_t linkId)
+MgtProbeResponseHeader
+ApWifiMac::GetProbeResp(uint8_t linkId)
 {
-    NS_LOG_FUNCTION(this << to << +linkId);
-    WifiMacHeader hdr;
-    hdr.SetType(WIFI_MAC_MGT_PROBE_RESPONSE);
-    hdr.SetAddr1(to);
-    hdr.SetAddr2(GetLink(linkId).feManager->GetAddress());
-    hdr.SetAddr3(GetLink(linkId).feManager->GetAddress());
-    hdr.SetDsNotFrom();
-    hdr.SetDsNotTo();
-    Ptr<Packet> packet = Create<Packet>();
     MgtProbeResponseHeader probe;
     probe.Get<Ssid>() = GetSsid();
     auto supportedRates = GetSupportedRates(linkId);
@@ -1134,7 +1125,22 @@ ApWifiMac::SendProbeResp(Mac48Address to, uint8_t linkId)
                 GetMultiLinkElement(linkId, WIFI_MAC_MGT_PROBE_RESPONSE);
         }
     }
-    packet->AddHeader(probe);
+    return probe;
+}
+
+void
+ApWifiMac::SendProbeResp(Mac48Address to, uint8_t linkId)
+{
+    NS_LOG_FUNCTION(this << to << +linkId);
+    WifiMacHeader hdr;
+    hdr.SetType(WIFI_MAC_MGT_PROBE_RESPONSE);
+    hdr.SetAddr1(to);
+    hdr.SetAddr2(GetLink(linkId).feManager->GetAddress());
+    hdr.SetAddr3(GetLink(linkId).feManager->GetAddress());
+    hdr.SetDsNotFrom();
+    hdr.SetDsNotTo();
+    Ptr<Packet> packet = Create<Packet>();
+    packet->AddHeader(GetProbeResp(linkId));
 
     if (!GetQosSupported())
     {
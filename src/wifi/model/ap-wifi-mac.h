@@ -41,6 +41,7 @@ class UniformRandomVariable;
 class MgtAssocRequestHeader;
 class MgtReassocRequestHeader;
 class MgtAssocResponseHeader;
+class MgtProbeResponseHeader;
 class MgtEmlOmn;
 class ApEmlsrManager;
 
@@ -62,6 +63,9 @@ using AssocReqRefVariant = std::variant<std::reference_wrapper<MgtAssocRequestHe
 class ApWifiMac : public WifiMac
 {
   public:
+    /// Allow the static setup helper to associate stations
+    friend class WifiStaticSetupHelper;
+
     /**
      * \brief Get the type ID.
      * \return the object TypeId
@@ -343,6 +347,13 @@ class ApWifiMac : public WifiMac
      * \param linkId the ID of the given link
      */
     void SendProbeResp(Mac48Address to, uint8_t linkId);
+    /**
+     * Get the Probe Response frame to send on a given link.
+     *
+     * \param linkId the ID of the given link
+     * \return the Probe Response frame
+     */
+    MgtProbeResponseHeader GetProbeResp(uint8_t linkId);
     /**
      * Get the Association Response frame to send on a given link. The returned frame
      * never includes a Multi-Link Element.
@@ -9,21 +9,91 @@
 #include "error-rate-model.h"
 
 #include "wifi-tx-vector.h"
+#include "wifi-utils.h"
 
+#include "ns3/boolean.h"
+#include "ns3/double.h"
 #include "ns3/dsss-error-rate-model.h"
+#include "ns3/log.h"
+#include "ns3/string.h"
+
+#include <bit>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
 
 namespace ns3
 {
 
+NS_LOG_COMPONENT_DEFINE("ErrorRateModel");
+
 NS_OBJECT_ENSURE_REGISTERED(ErrorRateModel);
 
 TypeId
 ErrorRateModel::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::ErrorRateModel").SetParent<Object>().SetGroupName("Wifi");
+    static TypeId tid =
+        TypeId("ns3::ErrorRateModel")
+            .SetParent<Object>()
+            .SetGroupName("Wifi")
+            .AddAttribute("UseLookupTable",
+                          "If true, chunk success rates are interpolated from lookup tables "
+                          "generated at first use, instead of being computed for every chunk.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&ErrorRateModel::m_useLookupTable),
+                          MakeBooleanChecker())
+            .AddAttribute("LookupTableMinSnrDb",
+                          "The minimum SNR (dB) of the lookup tables. Chunks with a lower SNR "
+                          "are not looked up.",
+                          DoubleValue(-10.0),
+                          MakeDoubleAccessor(&ErrorRateModel::m_lookupMinSnrDb),
+                          MakeDoubleChecker<double>())
+            .AddAttribute("LookupTableMaxSnrDb",
+                          "The maximum SNR (dB) of the lookup tables. Chunks with a higher SNR "
+                          "are not looked up.",
+                          DoubleValue(60.0),
+                          MakeDoubleAccessor(&ErrorRateModel::m_lookupMaxSnrDb),
+                          MakeDoubleChecker<double>())
+            .AddAttribute("LookupTableSnrStepDb",
+                          "The SNR step (dB) of the lookup tables.",
+                          DoubleValue(0.05),
+                          MakeDoubleAccessor(&ErrorRateModel::m_lookupSnrStepDb),
+                          MakeDoubleChecker<double>(0.001))
+            .AddAttribute("LookupTableFile",
+                          "If not empty, the lookup tables are loaded from this file at first "
+                          "use and saved into it when the model is disposed.",
+                          StringValue(""),
+                          MakeStringAccessor(&ErrorRateModel::m_lookupFile),
+                          MakeStringChecker());
     return tid;
 }
 
+ErrorRateModel::ErrorRateModel()
+    : m_useLookupTable(false),
+      m_lookupMinSnrDb(-10.0),
+      m_lookupMaxSnrDb(60.0),
+      m_lookupSnrStepDb(0.05),
+      m_lookupLoaded(false),
+      m_lookupModified(false)
+{
+}
+
+void
+ErrorRateModel::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_lookupModified && !m_lookupFile.empty())
+    {
+        SaveLookupTables();
+    }
+    m_lookupTables.clear();
+    m_loadedLookupTables.clear();
+    m_lookupModes.clear();
+    Object::DoDispose();
+}
+
 double
 ErrorRateModel::CalculateSnr(const WifiTxVector& txVector, double ber) const
 {
@@ -58,6 +128,243 @@ ErrorRateModel::GetChunkSuccessRate(WifiMode mode,
                                     uint8_t numRxAntennas,
                                     WifiPpduField field,
                                     uint16_t staId) const
+{
+    if (!m_useLookupTable || nbits == 0 || snr <= 0)
+    {
+        return ComputeChunkSuccessRate(mode, txVector, snr, nbits, numRxAntennas, field, staId);
+    }
+    const auto nSnrPoints = GetNSnrPoints();
+    const auto pos = (RatioToDb(snr) - m_lookupMinSnrDb) / m_lookupSnrStepDb;
+    if (pos < 0 || pos > nSnrPoints - 1)
+    {
+        return ComputeChunkSuccessRate(mode, txVector, snr, nbits, numRxAntennas, field, staId);
+    }
+    if (!m_lookupLoaded)
+    {
+        LoadLookupTables();
+    }
+
+    const bool muCommon = txVector.IsMu() && (staId == SU_STA_ID);
+    const LookupTableKey key{
+        mode.GetUid(),
+        static_cast<uint8_t>(field),
+        static_cast<uint16_t>(txVector.GetChannelWidth()),
+        txVector.GetGuardInterval().GetNanoSeconds(),
+        txVector.IsLdpc(),
+        numRxAntennas,
+        muCommon ? 0 : txVector.GetNss(staId),
+        (txVector.IsMu() && !muCommon) ? static_cast<uint8_t>(txVector.GetRu(staId).GetRuType())
+                                       : 0,
+        !muCommon && txVector.GetModeInitialized() && (mode == txVector.GetMode(staId))};
+    auto it = m_lookupTables.find(key);
+    if (it == m_lookupTables.end())
+    {
+        m_lookupModes.emplace(mode.GetUid(), mode);
+        it = m_lookupTables.emplace(key, LookupTables(std::numeric_limits<uint64_t>::digits))
+                 .first;
+        // reuse the tables loaded from file, if any
+        if (auto loaded = m_loadedLookupTables.find(LookupTableKeyToString(key));
+            loaded != m_loadedLookupTables.end())
+        {
+            it->second = std::move(loaded->second);
+            m_loadedLookupTables.erase(loaded);
+        }
+    }
+
+    // interpolate in SNR within the bucket of chunk sizes including nbits
+    const auto snrIndex = static_cast<std::size_t>(pos);
+    const auto nextSnrIndex = std::min(snrIndex + 1, nSnrPoints - 1);
+    const auto snrWeight = pos - snrIndex;
+    const std::size_t bucket = std::bit_width(nbits) - 1;
+    auto interpolateSnr = [&](std::size_t b) {
+        const auto low = GetLogSuccessRatePerBit(it->second,
+                                                 b,
+                                                 snrIndex,
+                                                 mode,
+                                                 txVector,
+                                                 numRxAntennas,
+                                                 field,
+                                                 staId);
+        const auto high = GetLogSuccessRatePerBit(it->second,
+                                                  b,
+                                                  nextSnrIndex,
+                                                  mode,
+                                                  txVector,
+                                                  numRxAntennas,
+                                                  field,
+                                                  staId);
+        return low + snrWeight * (high - low);
+    };
+    auto logSuccessRatePerBit = interpolateSnr(bucket);
+
+    // then interpolate in chunk size between the bounds of the bucket
+    const uint64_t bucketSize = uint64_t{1} << bucket;
+    if (nbits > bucketSize && bucket + 1 < it->second.size())
+    {
+        const auto sizeWeight = static_cast<double>(nbits - bucketSize) / bucketSize;
+        logSuccessRatePerBit += sizeWeight * (interpolateSnr(bucket + 1) - logSuccessRatePerBit);
+    }
+    return std::exp(logSuccessRatePerBit * nbits);
+}
+
+double
+ErrorRateModel::GetLogSuccessRatePerBit(LookupTables& tables,
+                                        std::size_t bucket,
+                                        std::size_t snrIndex,
+                                        WifiMode mode,
+                                        const WifiTxVector& txVector,
+                                        uint8_t numRxAntennas,
+                                        WifiPpduField field,
+                                        uint16_t staId) const
+{
+    auto& table = tables.at(bucket);
+    if (table.empty())
+    {
+        const uint64_t nbits = uint64_t{1} << bucket;
+        NS_LOG_DEBUG("Generating lookup table for mode " << mode << " and chunks of " << nbits
+                                                         << " bits");
+        const auto nSnrPoints = GetNSnrPoints();
+        table.resize(nSnrPoints);
+        for (std::size_t i = 0; i < nSnrPoints; ++i)
+        {
+            const auto snr = DbToRatio(m_lookupMinSnrDb + i * m_lookupSnrStepDb);
+            const auto csr =
+                ComputeChunkSuccessRate(mode, txVector, snr, nbits, numRxAntennas, field, staId);
+            // bound the success rate to keep the logarithm finite
+            table[i] = std::log(std::max(csr, std::numeric_limits<double>::min())) / nbits;
+        }
+        m_lookupModified = true;
+    }
+    return table[snrIndex];
+}
+
+std::size_t
+ErrorRateModel::GetNSnrPoints() const
+{
+    return static_cast<std::size_t>(
+               std::floor((m_lookupMaxSnrDb - m_lookupMinSnrDb) / m_lookupSnrStepDb + 1e-9)) +
+           1;
+}
+
+std::string
+ErrorRateModel::LookupTableKeyToString(const LookupTableKey& key) const
+{
+    const auto& [uid, field, width, gi, ldpc, nRx, nss, ruType, payload] = key;
+    std::ostringstream oss;
+    oss << m_lookupModes.at(uid).GetUniqueName() << " " << +field << " " << width << " " << gi
+        << " " << ldpc << " " << +nRx << " " << +nss << " " << +ruType << " " << payload;
+    return oss.str();
+}
+
+void
+ErrorRateModel::LoadLookupTables() const
+{
+    NS_LOG_FUNCTION(this << m_lookupFile);
+    m_lookupLoaded = true;
+    if (m_lookupFile.empty())
+    {
+        return;
+    }
+    std::ifstream is(m_lookupFile);
+    if (!is.is_open())
+    {
+        return;
+    }
+    std::string typeName;
+    double minSnr;
+    double maxSnr;
+    double step;
+    is >> typeName >> minSnr >> maxSnr >> step;
+    if (typeName != GetInstanceTypeId().GetName() || minSnr != m_lookupMinSnrDb ||
+        maxSnr != m_lookupMaxSnrDb || step != m_lookupSnrStepDb)
+    {
+        NS_LOG_DEBUG("The file " << m_lookupFile << " does not match the configuration");
+        return;
+    }
+    const auto nSnrPoints = GetNSnrPoints();
+    std::string line;
+    while (std::getline(is, line))
+    {
+        std::istringstream iss(line);
+        std::string mode;
+        uint32_t values[8];
+        std::size_t bucket;
+        if (!(iss >> mode))
+        {
+            continue;
+        }
+        for (auto& value : values)
+        {
+            iss >> value;
+        }
+        iss >> bucket;
+        std::vector<double> table(nSnrPoints);
+        for (auto& value : table)
+        {
+            iss >> value;
+        }
+        if (iss.fail() || bucket >= std::numeric_limits<uint64_t>::digits)
+        {
+            NS_LOG_DEBUG("Ignoring malformed line in " << m_lookupFile);
+            continue;
+        }
+        std::ostringstream key;
+        key << mode;
+        for (const auto value : values)
+        {
+            key << " " << value;
+        }
+        auto& tables = m_loadedLookupTables[key.str()];
+        tables.resize(std::numeric_limits<uint64_t>::digits);
+        tables[bucket] = std::move(table);
+    }
+}
+
+void
+ErrorRateModel::SaveLookupTables() const
+{
+    NS_LOG_FUNCTION(this << m_lookupFile);
+    std::ofstream os(m_lookupFile);
+    if (!os.is_open())
+    {
+        NS_LOG_WARN("Unable to save the lookup tables into " << m_lookupFile);
+        return;
+    }
+    os << GetInstanceTypeId().GetName() << " " << std::setprecision(17) << m_lookupMinSnrDb << " "
+       << m_lookupMaxSnrDb << " " << m_lookupSnrStepDb << "\n";
+    auto saveTables = [&os](const std::string& key, const LookupTables& tables) {
+        for (std::size_t bucket = 0; bucket < tables.size(); ++bucket)
+        {
+            if (tables[bucket].empty())
+            {
+                continue;
+            }
+            os << key << " " << bucket;
+            for (const auto value : tables[bucket])
+            {
+                os << " " << value;
+            }
+            os << "\n";
+        }
+    };
+    for (const auto& [key, tables] : m_lookupTables)
+    {
+        saveTables(LookupTableKeyToString(key), tables);
+    }
+    for (const auto& [key, tables] : m_loadedLookupTables)
+    {
+        saveTables(key, tables);
+    }
+}
+
+double
+ErrorRateModel::ComputeChunkSuccessRate(WifiMode mode,
+                                        const WifiTxVector& txVector,
+                                        double snr,
+                                        uint64_t nbits,
+                                        uint8_t numRxAntennas,
+                                        WifiPpduField field,
+                                        uint16_t staId) const
 {
     if (mode.GetModulationClass() == WIFI_MOD_CLASS_DSSS ||
         mode.GetModulationClass() == WIFI_MOD_CLASS_HR_DSSS)
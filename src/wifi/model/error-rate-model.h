@@ -13,6 +13,11 @@
 
 #include "ns3/object.h"
 
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
 namespace ns3
 {
 
@@ -20,6 +25,19 @@ namespace ns3
  * \ingroup wifi
  * \brief the interface for Wifi's error models
  *
+ * If the UseLookupTable attribute is set to true, the chunk success rates computed by
+ * the model are cached in lookup tables, which are generated lazily: for every combination
+ * of mode and TXVECTOR parameters, and for every bucket of chunk sizes (powers of two),
+ * the success rate is computed once for every SNR value of a grid (in dB). Subsequent
+ * queries are answered by interpolating the tables, both in SNR and in chunk size.
+ * Specifically, the tables store the logarithm of the success rate per bit, which is
+ * independent of the chunk size for models where bit errors are independent (such as
+ * NistErrorRateModel and YansErrorRateModel), hence the interpolation in chunk size is exact
+ * for these models. SNR values outside the grid are handled by the model itself.
+ *
+ * The tables can be saved into a file when the model is disposed and loaded from it at
+ * first use (see the LookupTableFile attribute), so that they are generated only once
+ * across simulation runs.
  */
 class ErrorRateModel : public Object
 {
@@ -30,6 +48,8 @@ class ErrorRateModel : public Object
      */
     static TypeId GetTypeId();
 
+    ErrorRateModel();
+
     /**
      * \param txVector a specific transmission vector including WifiMode
      * \param ber a target BER
@@ -91,7 +111,106 @@ class ErrorRateModel : public Object
      */
     virtual int64_t AssignStreams(int64_t stream);
 
+  protected:
+    void DoDispose() override;
+
   private:
+    /**
+     * Compute the chunk success rate without using the lookup tables.
+     *
+     * \param mode the Wi-Fi mode applicable to this chunk
+     * \param txVector TXVECTOR of the overall transmission
+     * \param snr the SNR of the chunk
+     * \param nbits the number of bits in this chunk
+     * \param numRxAntennas the number of active RX antennas
+     * \param field the PPDU field to which the chunk belongs to
+     * \param staId the station ID for MU
+     *
+     * \return probability of successfully receiving the chunk
+     */
+    double ComputeChunkSuccessRate(WifiMode mode,
+                                   const WifiTxVector& txVector,
+                                   double snr,
+                                   uint64_t nbits,
+                                   uint8_t numRxAntennas,
+                                   WifiPpduField field,
+                                   uint16_t staId) const;
+
+    /**
+     * Identifier of a set of lookup tables: mode UID, PPDU field, channel width (MHz), guard
+     * interval (ns), LDPC, number of RX antennas, number of spatial streams (0 for the common
+     * part of MU PPDUs), RU type (for MU PPDUs) and whether the mode is the payload mode of the
+     * TXVECTOR.
+     */
+    using LookupTableKey =
+        std::tuple<uint32_t, uint8_t, uint16_t, int64_t, bool, uint8_t, uint8_t, uint8_t, bool>;
+
+    /**
+     * Lookup tables of a given key: for each bucket of chunk sizes, the logarithm of the
+     * success rate per bit at each SNR of the grid (empty if not computed yet).
+     */
+    using LookupTables = std::vector<std::vector<double>>;
+
+    /**
+     * Get the logarithm of the success rate per bit from the lookup table of a given
+     * bucket of chunk sizes, computing the table if needed.
+     *
+     * \param tables the lookup tables to which the table belongs
+     * \param bucket the bucket of chunk sizes (the chunk size is 2^bucket bits)
+     * \param snrIndex the index of the SNR grid point
+     * \param mode the Wi-Fi mode applicable to this chunk
+     * \param txVector TXVECTOR of the overall transmission
+     * \param numRxAntennas the number of active RX antennas
+     * \param field the PPDU field to which the chunk belongs to
+     * \param staId the station ID for MU
+     *
+     * \return the logarithm of the success rate per bit
+     */
+    double GetLogSuccessRatePerBit(LookupTables& tables,
+                                   std::size_t bucket,
+                                   std::size_t snrIndex,
+                                   WifiMode mode,
+                                   const WifiTxVector& txVector,
+                                   uint8_t numRxAntennas,
+                                   WifiPpduField field,
+                                   uint16_t staId) const;
+
+    /**
+     * Get a textual representation of a lookup table key, used in the file storing the
+     * lookup tables.
+     *
+     * \param key the lookup table key
+     * \return the textual representation of the key
+     */
+    std::string LookupTableKeyToString(const LookupTableKey& key) const;
+
+    /**
+     * Load the lookup tables from the file set through the LookupTableFile attribute.
+     */
+    void LoadLookupTables() const;
+
+    /**
+     * Save the lookup tables into the file set through the LookupTableFile attribute.
+     */
+    void SaveLookupTables() const;
+
+    /**
+     * \return the number of points of the SNR grid
+     */
+    std::size_t GetNSnrPoints() const;
+
+    bool m_useLookupTable;       //!< whether to use lookup tables
+    double m_lookupMinSnrDb;     //!< minimum SNR of the grid (dB)
+    double m_lookupMaxSnrDb;     //!< maximum SNR of the grid (dB)
+    double m_lookupSnrStepDb;    //!< step of the SNR grid (dB)
+    std::string m_lookupFile;    //!< file storing the lookup tables
+    mutable bool m_lookupLoaded; //!< whether the lookup tables have been loaded from file
+    mutable std::map<LookupTableKey, LookupTables> m_lookupTables; //!< the lookup tables
+    mutable std::map<uint32_t, WifiMode> m_lookupModes; //!< the modes indexed by their UID
+    mutable std::map<std::string, LookupTables>
+        m_loadedLookupTables;      //!< tables loaded from file and not used yet, by textual key
+    mutable bool m_lookupModified; //!< whether new tables have been computed
+
     /**
      * A pure virtual method that must be implemented in the subclass.
      *
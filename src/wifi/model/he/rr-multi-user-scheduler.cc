@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <optional>
 
 namespace ns3
 {
@@ -175,15 +176,12 @@ RrMultiUserScheduler::GetTxVectorForUlMu(std::function<bool(const MasterInfo&)>
     NS_LOG_FUNCTION(this);
 
     // determine RUs to allocate to stations
-    auto count = std::min<std::size_t>(m_nStations, m_staListUl.size());
-    std::size_t nCentral26TonesRus;
-    HeRu::GetEqualSizedRusForStations(m_allowedWidth, count, nCentral26TonesRus);
+    const auto& ruAllocation =
+        GetRuAllocation(std::min<std::size_t>(m_nStations, m_staListUl.size()));
+    auto count = ruAllocation.nRusAssigned;
     NS_ASSERT(count >= 1);
-
-    if (!m_useCentral26TonesRus)
-    {
-        nCentral26TonesRus = 0;
-    }
+    std::size_t nCentral26TonesRus =
+        (m_useCentral26TonesRus ? ruAllocation.nCentral26TonesRus : 0);
 
     Ptr<HeConfiguration> heConfiguration = m_apMac->GetHeConfiguration();
     NS_ASSERT(heConfiguration);
@@ -656,17 +654,13 @@ RrMultiUserScheduler::TrySendingDlMuPpdu()
         return TxFormat::SU_TX;
     }
 
-    std::size_t count =
-        std::min(static_cast<std::size_t>(m_nStations), m_staListDl[primaryAc].size());
-    std::size_t nCentral26TonesRus;
-    HeRu::RuType ruType =
-        HeRu::GetEqualSizedRusForStations(m_allowedWidth, count, nCentral26TonesRus);
+    const auto& ruAllocation = GetRuAllocation(
+        std::min(static_cast<std::size_t>(m_nStations), m_staListDl[primaryAc].size()));
+    std::size_t count = ruAllocation.nRusAssigned;
+    HeRu::RuType ruType = ruAllocation.ruType;
     NS_ASSERT(count >= 1);
-
-    if (!m_useCentral26TonesRus)
-    {
-        nCentral26TonesRus = 0;
-    }
+    std::size_t nCentral26TonesRus =
+        (m_useCentral26TonesRus ? ruAllocation.nCentral26TonesRus : 0);
 
     uint8_t currTid = wifiAcList.at(primaryAc).GetHighTid();
 
@@ -758,7 +752,15 @@ RrMultiUserScheduler::TrySendingDlMuPpdu()
                         GetWifiRemoteStationManager(m_linkId)->GetDataTxVector(mpdu->GetHeader(),
                                                                                m_allowedWidth);
 
-                    WifiTxVector txVectorCopy = m_txParams.m_txVector;
+                    // The TX vector is only copied for the first candidate STA, which may
+                    // change the preamble type. Afterwards, only the user info of the
+                    // current STA needs to be removed if the MPDU cannot be added, which
+                    // avoids copying the user info of all the candidate stations every time.
+                    std::optional<WifiTxVector> txVectorCopy;
+                    if (m_candidates.empty())
+                    {
+                        txVectorCopy = m_txParams.m_txVector;
+                    }
 
                     // the first candidate STA determines the preamble type for the DL MU PPDU
                     if (m_candidates.empty() &&
@@ -776,7 +778,14 @@ RrMultiUserScheduler::TrySendingDlMuPpdu()
                     if (!GetHeFem(m_linkId)->TryAddMpdu(mpdu, m_txParams, actualAvailableTime))
                     {
                         NS_LOG_DEBUG("Adding the peeked frame violates the time constraints");
-                        m_txParams.m_txVector = txVectorCopy;
+                        if (txVectorCopy)
+                        {
+                            m_txParams.m_txVector = *txVectorCopy;
+                        }
+                        else
+                        {
+                            m_txParams.m_txVector.GetHeMuUserInfoMap().erase(staIt->aid);
+                        }
                     }
                     else
                     {
@@ -822,12 +831,12 @@ RrMultiUserScheduler::FinalizeTxVector(WifiTxVector& txVector)
     NS_ASSERT(txVector.GetHeMuUserInfoMap().size() == m_candidates.size());
 
     // compute how many stations can be granted an RU and the RU size
-    std::size_t nRusAssigned = m_candidates.size();
+    const auto& ruAllocation = GetRuAllocation(m_candidates.size());
+    std::size_t nRusAssigned = ruAllocation.nRusAssigned;
     std::size_t nCentral26TonesRus;
-    HeRu::RuType ruType =
-        HeRu::GetEqualSizedRusForStations(m_allowedWidth, nRusAssigned, nCentral26TonesRus);
 
-    NS_LOG_DEBUG(nRusAssigned << " stations are being assigned a " << ruType << " RU");
+    NS_LOG_DEBUG(nRusAssigned << " stations are being assigned a " << ruAllocation.ruType
+                              << " RU");
 
     if (!m_useCentral26TonesRus || m_candidates.size() == nRusAssigned)
     {
@@ -835,7 +844,8 @@ RrMultiUserScheduler::FinalizeTxVector(WifiTxVector& txVector)
     }
     else
     {
-        nCentral26TonesRus = std::min(m_candidates.size() - nRusAssigned, nCentral26TonesRus);
+        nCentral26TonesRus =
+            std::min(m_candidates.size() - nRusAssigned, ruAllocation.nCentral26TonesRus);
         NS_LOG_DEBUG(nCentral26TonesRus << " stations are being assigned a 26-tones RU");
     }
 
@@ -844,11 +854,9 @@ RrMultiUserScheduler::FinalizeTxVector(WifiTxVector& txVector)
     std::swap(heMuUserInfoMap, txVector.GetHeMuUserInfoMap());
 
     auto candidateIt = m_candidates.begin(); // iterator over the list of candidate receivers
-    auto ruSet = HeRu::GetRusOfType(m_allowedWidth, ruType);
-    auto ruSetIt = ruSet.begin();
-    auto central26TonesRus = HeRu::GetCentral26TonesRus(m_allowedWidth, ruType);
-    auto central26TonesRusIt = central26TonesRus.begin();
 
+    // the RUs of the cached allocation are the equal-sized RUs followed by the central
+    // 26-tone RUs, hence they can be assigned in order
     for (std::size_t i = 0; i < nRusAssigned + nCentral26TonesRus; i++)
     {
         NS_ASSERT(candidateIt != m_candidates.end());
@@ -856,9 +864,7 @@ RrMultiUserScheduler::FinalizeTxVector(WifiTxVector& txVector)
         NS_ASSERT(mapIt != heMuUserInfoMap.end());
 
         txVector.SetHeMuUserInfo(mapIt->first,
-                                 {(i < nRusAssigned ? *ruSetIt++ : *central26TonesRusIt++),
-                                  mapIt->second.mcs,
-                                  mapIt->second.nss});
+                                 {ruAllocation.rus[i], mapIt->second.mcs, mapIt->second.nss});
         candidateIt++;
     }
 
@@ -866,6 +872,33 @@ RrMultiUserScheduler::FinalizeTxVector(WifiTxVector& txVector)
     m_candidates.erase(candidateIt, m_candidates.end());
 }
 
+const RrMultiUserScheduler::RuAllocation&
+RrMultiUserScheduler::GetRuAllocation(std::size_t nStations)
+{
+    NS_LOG_FUNCTION(this << nStations);
+
+    auto [it, inserted] = m_ruAllocations.try_emplace({m_allowedWidth, nStations});
+
+    if (inserted)
+    {
+        auto& ruAllocation = it->second;
+        ruAllocation.nRusAssigned = nStations;
+        ruAllocation.ruType =
+            HeRu::GetEqualSizedRusForStations(m_allowedWidth,
+                                              ruAllocation.nRusAssigned,
+                                              ruAllocation.nCentral26TonesRus);
+        ruAllocation.rus = HeRu::GetRusOfType(m_allowedWidth, ruAllocation.ruType);
+        NS_ASSERT(ruAllocation.rus.size() == ruAllocation.nRusAssigned);
+        auto central26TonesRus = HeRu::GetCentral26TonesRus(m_allowedWidth, ruAllocation.ruType);
+        NS_ASSERT(central26TonesRus.size() == ruAllocation.nCentral26TonesRus);
+        ruAllocation.rus.insert(ruAllocation.rus.end(),
+                                central26TonesRus.cbegin(),
+                                central26TonesRus.cend());
+    }
+
+    return it->second;
+}
+
 void
 RrMultiUserScheduler::UpdateCredits(std::list<MasterInfo>& staList,
                                     Time txDuration,
@@ -13,6 +13,8 @@
 
 #include <functional>
 #include <list>
+#include <map>
+#include <vector>
 
 namespace ns3
 {
@@ -159,6 +161,29 @@ class RrMultiUserScheduler : public MultiUserScheduler
      */
     typedef std::pair<std::list<MasterInfo>::iterator, Ptr<WifiMpdu>> CandidateInfo;
 
+    /**
+     * Equal-sized RU allocation for a given channel width and a given number of stations.
+     */
+    struct RuAllocation
+    {
+        HeRu::RuType ruType;            //!< the type of the equal-sized RUs
+        std::size_t nRusAssigned;       //!< the number of equal-sized RUs
+        std::size_t nCentral26TonesRus; //!< the number of central 26-tone RUs
+        std::vector<HeRu::RuSpec> rus;  //!< the equal-sized RUs followed by the central
+                                        //!< 26-tone RUs
+    };
+
+    /**
+     * Get the RU allocation to use when the given number of stations are to be
+     * served on the current channel width (i.e., m_allowedWidth). RU allocations
+     * are computed once and cached, so that the RU tables of HeRu are not walked
+     * every time a DL or UL MU PPDU is prepared.
+     *
+     * \param nStations the number of stations to serve
+     * \return the RU allocation (regardless of whether central 26-tone RUs are allowed)
+     */
+    const RuAllocation& GetRuAllocation(std::size_t nStations);
+
     uint8_t m_nStations;         //!< Number of stations/slots to fill
     bool m_enableTxopSharing;    //!< allow A-MPDUs of different TIDs in a DL MU PPDU
     bool m_forceDlOfdma;         //!< return DL_OFDMA even if no DL MU PPDU was built
@@ -174,6 +199,8 @@ class RrMultiUserScheduler : public MultiUserScheduler
     CtrlTriggerHeader m_trigger;           //!< Trigger Frame to send
     WifiMacHeader m_triggerMacHdr;         //!< MAC header for Trigger Frame
     WifiTxParameters m_txParams;           //!< TX parameters
+    std::map<std::pair<MHz_u, std::size_t>, RuAllocation>
+        m_ruAllocations; //!< RU allocations indexed by channel width and number of stations
 };
 
 } // namespace ns3
@@ -163,7 +163,8 @@ InterferenceHelper::NiChange::GetEvent() const
 
 InterferenceHelper::InterferenceHelper()
     : m_errorRateModel(nullptr),
-      m_numRxAntennas(1)
+      m_numRxAntennas(1),
+      m_backgroundWindow(MilliSeconds(1))
 {
     NS_LOG_FUNCTION(this);
 }
@@ -187,12 +188,13 @@ void
 InterferenceHelper::DoDispose()
 {
     NS_LOG_FUNCTION(this);
-    for (auto it : m_niChanges)
+    for (auto& it : m_niChanges)
     {
         it.second.clear();
     }
     m_niChanges.clear();
     m_firstPowers.clear();
+    m_backgroundInterference.clear();
     m_errorRateModel = nullptr;
 }
 
@@ -224,6 +226,51 @@ InterferenceHelper::AddForeignSignal(Time duration,
     Add(fakePpdu, duration, rxPowerW, freqRange);
 }
 
+void
+InterferenceHelper::AddBackgroundInterference(Time duration,
+                                              const RxPowerWattPerChannelBand& rxPower)
+{
+    NS_LOG_FUNCTION(this << duration);
+    for (const auto& [band, power] : rxPower)
+    {
+        if (!HasBand(band))
+        {
+            continue;
+        }
+        auto& background = m_backgroundInterference[band];
+        UpdateBackgroundInterference(background);
+        background.energy += power * duration.GetSeconds();
+    }
+}
+
+Watt_u
+InterferenceHelper::GetBackgroundInterference(const WifiSpectrumBandInfo& band) const
+{
+    auto it = m_backgroundInterference.find(band);
+    if (it == m_backgroundInterference.end())
+    {
+        return 0.0;
+    }
+    UpdateBackgroundInterference(it->second);
+    return it->second.power;
+}
+
+void
+InterferenceHelper::UpdateBackgroundInterference(BackgroundInterference& background) const
+{
+    const auto elapsed = Simulator::Now() - background.windowStart;
+    if (elapsed < m_backgroundWindow)
+    {
+        return;
+    }
+    const auto nWindows = elapsed.GetTimeStep() / m_backgroundWindow.GetTimeStep();
+    // if the current window is not the one following the last window, no signal has been
+    // added during the last complete window
+    background.power = (nWindows == 1) ? background.energy / m_backgroundWindow.GetSeconds() : 0.0;
+    background.energy = 0;
+    background.windowStart += m_backgroundWindow * nWindows;
+}
+
 bool
 InterferenceHelper::HasBands() const
 {
@@ -256,6 +303,7 @@ InterferenceHelper::RemoveBand(const WifiSpectrumBandInfo& band)
     NS_LOG_FUNCTION(this << band);
     NS_ASSERT(m_firstPowers.count(band) != 0);
     m_firstPowers.erase(band);
+    m_backgroundInterference.erase(band);
     auto it = m_niChanges.find(band);
     NS_ASSERT(it != std::end(m_niChanges));
     it->second.clear();
@@ -305,6 +353,14 @@ InterferenceHelper::SetNoiseFigure(double value)
     m_noiseFigure = value;
 }
 
+void
+InterferenceHelper::SetBackgroundInterferenceWindow(Time window)
+{
+    NS_LOG_FUNCTION(this << window);
+    NS_ASSERT(window.IsStrictlyPositive());
+    m_backgroundWindow = window;
+}
+
 void
 InterferenceHelper::SetErrorRateModel(const Ptr<ErrorRateModel> rate)
 {
@@ -350,6 +406,7 @@ InterferenceHelper::AppendEvent(Ptr<Event> event,
                                 bool isStartHePortionRxing)
 {
     NS_LOG_FUNCTION(this << event << freqRange << isStartHePortionRxing);
+    m_maxEventDuration = Max(m_maxEventDuration, event->GetDuration());
     for (const auto& [band, power] : event->GetRxPowerPerBand())
     {
         auto niIt = m_niChanges.find(band);
@@ -363,19 +420,27 @@ InterferenceHelper::AppendEvent(Ptr<Event> event,
         {
             m_firstPowers.find(band)->second = previousPowerStart;
             // Always leave the first zero power noise event in the list
-            niIt->second.erase(++(niIt->second.begin()), ++previousPowerPosition);
+            niIt->second.erase(niIt->second.begin() + 1, previousPowerPosition + 1);
         }
-        else if (isStartHePortionRxing)
+        else
         {
-            // When the first HE portion is received, we need to set m_firstPowerPerBand
-            // so that it takes into account interferences that arrived between the start of the
-            // HE TB PPDU transmission and the start of HE TB payload.
-            m_firstPowers.find(band)->second = previousPowerStart;
+            if (isStartHePortionRxing)
+            {
+                // When the first HE portion is received, we need to set m_firstPowerPerBand
+                // so that it takes into account interferences that arrived between the start of
+                // the HE TB PPDU transmission and the start of HE TB payload.
+                m_firstPowers.find(band)->second = previousPowerStart;
+            }
+            // Events under reception started at most m_maxEventDuration ago: older NI changes
+            // are no longer needed (a margin is kept for events processed at their end)
+            PruneNiChanges(event->GetStartTime() - 2 * m_maxEventDuration, niIt);
         }
         auto first =
             AddNiChangeEvent(event->GetStartTime(), NiChange(previousPowerStart, event), niIt);
+        // the insertion of the last NI change invalidates the iterator to the first one
+        const auto firstIndex = std::distance(niIt->second.begin(), first);
         auto last = AddNiChangeEvent(event->GetEndTime(), NiChange(previousPowerEnd, event), niIt);
-        for (auto i = first; i != last; ++i)
+        for (auto i = niIt->second.begin() + firstIndex; i != last; ++i)
         {
             i->second.AddPower(power);
         }
@@ -445,7 +510,7 @@ InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
     auto niIt = m_niChanges.find(band);
     NS_ABORT_IF(niIt == m_niChanges.end());
     const auto now = Simulator::Now();
-    auto it = niIt->second.find(event->GetStartTime());
+    auto it = FindFirstPosition(event->GetStartTime(), niIt->second);
     const auto muMimoPower = (event->GetPpdu()->GetType() == WIFI_PPDU_TYPE_UL_MU)
                                  ? CalculateMuMimoPowerW(event, band)
                                  : 0.0;
@@ -465,23 +530,26 @@ InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
             noiseInterference = 0.0;
         }
     }
-    it = niIt->second.find(event->GetStartTime());
+    it = FindFirstPosition(event->GetStartTime(), niIt->second);
     NS_ABORT_IF(it == niIt->second.end());
     for (; it != niIt->second.end() && it->second.GetEvent() != event; ++it)
     {
         ;
     }
+    NS_ABORT_IF(it == niIt->second.end());
+    // NI changes between the start and the end of the event are contiguous
+    auto end = std::find_if(std::next(it), niIt->second.end(), [&event](const auto& niChange) {
+        return niChange.second.GetEvent() == event;
+    });
     NiChanges ni;
-    ni.emplace(event->GetStartTime(), NiChange(0, event));
-    while (++it != niIt->second.end() && it->second.GetEvent() != event)
-    {
-        ni.insert(*it);
-    }
-    ni.emplace(event->GetEndTime(), NiChange(0, event));
-    nis.insert({band, ni});
+    ni.reserve(std::distance(it, end) + 1);
+    ni.emplace_back(event->GetStartTime(), NiChange(0, event));
+    ni.insert(ni.end(), std::next(it), end);
+    ni.emplace_back(event->GetEndTime(), NiChange(0, event));
+    nis.insert({band, std::move(ni)});
     NS_ASSERT_MSG(noiseInterference >= 0.0,
                   "CalculateNoiseInterferenceW returns negative value " << noiseInterference);
-    return noiseInterference;
+    return noiseInterference + GetBackgroundInterference(band);
 }
 
 Watt_u
@@ -596,13 +664,30 @@ InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
     NS_ABORT_IF(!m_firstPowers.contains(band));
     auto noiseInterference = m_firstPowers.at(band);
     auto power = event->GetRxPower(band);
+    const auto background = GetBackgroundInterference(band);
+    if (event->GetPpdu()->GetType() != WIFI_PPDU_TYPE_UL_MU)
+    {
+        // NI changes preceding the window start do not contribute to the PER, hence jump to
+        // the last NI change not later than the window start (no MU-MIMO power to accumulate)
+        auto k = std::prev(std::upper_bound(
+            niIt.cbegin(),
+            niIt.cend(),
+            windowStart,
+            [](Time moment, const auto& niChange) { return moment < niChange.first; }));
+        if (k != niIt.cbegin())
+        {
+            j = k;
+            previous = j->first;
+            noiseInterference = j->second.GetPower() - power;
+        }
+    }
     while (++j != niIt.cend())
     {
         Time current = j->first;
         NS_LOG_DEBUG("previous= " << previous << ", current=" << current);
         NS_ASSERT(current >= previous);
         const auto snr = CalculateSnr(power,
-                                      noiseInterference,
+                                      noiseInterference + background,
                                       channelWidth,
                                       event->GetPpdu()->GetTxVector().GetNss(staId));
         // Case 1: Both previous and current point to the windowed payload
@@ -655,8 +740,8 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
 {
     NS_LOG_FUNCTION(this << band);
     double psr = 1.0; /* Packet Success Rate */
-    auto niIt = nis->find(band)->second;
-    auto j = niIt.begin();
+    const auto& niIt = nis->find(band)->second;
+    auto j = niIt.cbegin();
 
     NS_ASSERT(!phyHeaderSections.empty());
     Time stopLastSection;
@@ -669,12 +754,13 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
     NS_ABORT_IF(!m_firstPowers.contains(band));
     auto noiseInterference = m_firstPowers.at(band);
     const auto power = event->GetRxPower(band);
-    while (++j != niIt.end())
+    const auto background = GetBackgroundInterference(band);
+    while (++j != niIt.cend())
     {
         auto current = j->first;
         NS_LOG_DEBUG("previous= " << previous << ", current=" << current);
         NS_ASSERT(current >= previous);
-        const auto snr = CalculateSnr(power, noiseInterference, channelWidth, 1);
+        const auto snr = CalculateSnr(power, noiseInterference + background, channelWidth, 1);
         for (const auto& section : phyHeaderSections)
         {
             const auto start = section.second.first.first;
@@ -717,7 +803,7 @@ InterferenceHelper::CalculatePhyHeaderPer(Ptr<const Event> event,
                                           WifiPpduField header) const
 {
     NS_LOG_FUNCTION(this << band << header);
-    auto niIt = nis->find(band)->second;
+    const auto& niIt = nis->find(band)->second;
     auto phyEntity =
         WifiPhy::GetStaticPhyEntity(event->GetPpdu()->GetTxVector().GetModulationClass());
 
@@ -794,10 +880,23 @@ InterferenceHelper::CalculatePhyHeaderSnrPer(Ptr<Event> event,
     return PhyEntity::SnrPer(snr, per);
 }
 
+InterferenceHelper::NiChanges::const_iterator
+InterferenceHelper::FindFirstPosition(Time moment, const NiChanges& niChanges) const
+{
+    auto it = std::lower_bound(niChanges.cbegin(),
+                               niChanges.cend(),
+                               moment,
+                               [](const auto& niChange, Time t) { return niChange.first < t; });
+    return (it != niChanges.cend() && it->first == moment) ? it : niChanges.cend();
+}
+
 InterferenceHelper::NiChanges::iterator
 InterferenceHelper::GetNextPosition(Time moment, NiChangesPerBand::iterator niIt)
 {
-    return niIt->second.upper_bound(moment);
+    return std::upper_bound(niIt->second.begin(),
+                            niIt->second.end(),
+                            moment,
+                            [](Time t, const auto& niChange) { return t < niChange.first; });
 }
 
 InterferenceHelper::NiChanges::iterator
@@ -816,6 +915,22 @@ InterferenceHelper::AddNiChangeEvent(Time moment, NiChange change, NiChangesPerB
     return niIt->second.insert(GetNextPosition(moment, niIt), {moment, change});
 }
 
+void
+InterferenceHelper::PruneNiChanges(Time moment, NiChangesPerBand::iterator niIt)
+{
+    if (!moment.IsStrictlyPositive())
+    {
+        return;
+    }
+    auto last = GetPreviousPosition(moment, niIt);
+    if (std::distance(niIt->second.begin(), last) > 1)
+    {
+        NS_LOG_DEBUG("Prune " << std::distance(niIt->second.begin(), last) - 1
+                              << " NI changes before " << moment);
+        niIt->second.erase(niIt->second.begin() + 1, last);
+    }
+}
+
 void
 InterferenceHelper::NotifyRxStart(const FrequencyRange& freqRange)
 {
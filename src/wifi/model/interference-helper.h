@@ -187,6 +187,13 @@ class InterferenceHelper : public Object
      * \param rx the number of RX antennas
      */
     void SetNumberOfReceiveAntennas(uint8_t rx);
+    /**
+     * Set the duration of the window over which the power of the background interference
+     * is averaged.
+     *
+     * \param window the averaging window
+     */
+    void SetBackgroundInterferenceWindow(Time window);
 
     /**
      * \param energy the minimum energy requested
@@ -225,6 +232,22 @@ class InterferenceHelper : public Object
     void AddForeignSignal(Time duration,
                           RxPowerWattPerChannelBand& rxPower,
                           const FrequencyRange& freqRange);
+    /**
+     * Add a signal to the background interference rather than tracking it as an event.
+     * The energy of the signal is accumulated on each band and the power of the background
+     * interference is the average power of the signals that started during the last
+     * complete averaging window. This power is added to the noise when computing the SNR
+     * and the PER of events, but it is not accounted for in the CCA.
+     *
+     * \param duration the duration of the signal
+     * \param rxPower received power per band (W)
+     */
+    void AddBackgroundInterference(Time duration, const RxPowerWattPerChannelBand& rxPower);
+    /**
+     * \param band the band
+     * \return the power of the background interference on the given band
+     */
+    Watt_u GetBackgroundInterference(const WifiSpectrumBandInfo& band) const;
     /**
      * Calculate the SNIR at the start of the payload and accumulate
      * all SNIR changes in the SNIR vector for each MPDU of an A-MPDU.
@@ -260,6 +283,20 @@ class InterferenceHelper : public Object
                         MHz_u channelWidth,
                         uint8_t nss,
                         const WifiSpectrumBandInfo& band) const;
+    /**
+     * Calculate SNR (linear ratio) from the given signal power and noise+interference power.
+     *
+     * \param signal signal power
+     * \param noiseInterference noise and interference power
+     * \param channelWidth signal width
+     * \param nss the number of spatial streams
+     *
+     * \return SNR in linear scale
+     */
+    double CalculateSnr(Watt_u signal,
+                        Watt_u noiseInterference,
+                        MHz_u channelWidth,
+                        uint8_t nss) const;
     /**
      * Calculate the SNIR at the start of the PHY header and accumulate
      * all SNIR changes in the SNIR vector.
@@ -300,20 +337,6 @@ class InterferenceHelper : public Object
   protected:
     void DoDispose() override;
 
-    /**
-     * Calculate SNR (linear ratio) from the given signal power and noise+interference power.
-     *
-     * \param signal signal power
-     * \param noiseInterference noise and interference power
-     * \param channelWidth signal width
-     * \param nss the number of spatial streams
-     *
-     * \return SNR in linear scale
-     */
-    double CalculateSnr(Watt_u signal,
-                        Watt_u noiseInterference,
-                        MHz_u channelWidth,
-                        uint8_t nss) const;
     /**
      * Calculate the success rate of the chunk given the SINR, duration, and TXVECTOR.
      * The duration and TXVECTOR are used to calculate how many bits are present in the chunk.
@@ -391,9 +414,11 @@ class InterferenceHelper : public Object
     };
 
     /**
-     * typedef for a multimap of NiChange
+     * Time-ordered vector of NiChange. NI changes with the same time are kept in insertion
+     * order. Since each NiChange stores the total power from its time onwards, the power at
+     * any time is found through a binary search.
      */
-    using NiChanges = std::multimap<Time, NiChange>;
+    using NiChanges = std::vector<std::pair<Time, NiChange>>;
 
     /**
      * Map of NiChanges per band
@@ -519,6 +544,37 @@ class InterferenceHelper : public Object
     Ptr<ErrorRateModel> m_errorRateModel; //!< error rate model
     uint8_t m_numRxAntennas;         //!< the number of RX antennas in the corresponding receiver
     FirstPowerPerBand m_firstPowers; //!< first power of each band
+    Time m_maxEventDuration;         //!< duration of the longest event added so far
+
+    /// Background interference accumulated on a band
+    struct BackgroundInterference
+    {
+        Time windowStart{0}; //!< start time of the current averaging window
+        double energy{0};    //!< energy (J) of the signals that started in the current window
+        Watt_u power{0};     //!< average power over the last complete window
+    };
+
+    /**
+     * Move the averaging window of the given background interference to the one
+     * including the current time, if needed.
+     *
+     * \param background the background interference on a band
+     */
+    void UpdateBackgroundInterference(BackgroundInterference& background) const;
+
+    mutable std::map<WifiSpectrumBandInfo, BackgroundInterference>
+        m_backgroundInterference; //!< background interference for each band
+    Time m_backgroundWindow;      //!< averaging window of the background interference
+
+    /**
+     * Returns an iterator to the first NiChange at the given time
+     *
+     * \param moment the time of the NiChange
+     * \param niChanges the list of NiChanges to search
+     * \returns an iterator to the list of NiChanges, or the end of the list if there is no
+     *          NiChange at the given time
+     */
+    NiChanges::const_iterator FindFirstPosition(Time moment, const NiChanges& niChanges) const;
 
     /**
      * Returns an iterator to the first NiChange that is later than moment
@@ -550,6 +606,16 @@ class InterferenceHelper : public Object
                                          NiChange change,
                                          NiChangesPerBand::iterator niIt);
 
+    /**
+     * Remove the NiChanges that are too old to be needed by any event that may still be
+     * under reception, i.e., those preceding the given time, except the last one (which holds
+     * the power at the given time) and the first zero power noise event.
+     *
+     * \param moment the time before which NiChanges can be removed
+     * \param niIt iterator of the band to prune
+     */
+    void PruneNiChanges(Time moment, NiChangesPerBand::iterator niIt);
+
     /**
      * Return whether another event is a MU-MIMO event that belongs to the same transmission and to
      * the same RU.
@@ -0,0 +1,404 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "link-abstraction-wifi-phy.h"
+
+#include "error-rate-model.h"
+#include "interference-helper.h"
+#include "phy-entity.h"
+#include "wifi-phy-state-helper.h"
+#include "wifi-ppdu.h"
+#include "wifi-psdu.h"
+#include "wifi-utils.h"
+
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/simulator.h"
+
+#include <algorithm>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LinkAbstractionWifiPhy");
+
+NS_OBJECT_ENSURE_REGISTERED(LinkAbstractionWifiPhy);
+
+TypeId
+LinkAbstractionWifiPhy::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::LinkAbstractionWifiPhy")
+            .SetParent<YansWifiPhy>()
+            .SetGroupName("Wifi")
+            .AddConstructor<LinkAbstractionWifiPhy>()
+            .AddAttribute("RxSinrThreshold",
+                          "The minimum SINR (dB) at the start of a PPDU for the PHY to "
+                          "synchronize on it. PPDUs received with a lower SINR are treated "
+                          "as interference.",
+                          DoubleValue(4.0),
+                          MakeDoubleAccessor(&LinkAbstractionWifiPhy::m_rxSinrThreshold),
+                          MakeDoubleChecker<double>())
+            .AddAttribute("UseLookupTable",
+                          "If true, the lookup tables of the error rate model are enabled "
+                          "when the PHY is initialized.",
+                          BooleanValue(true),
+                          MakeBooleanAccessor(&LinkAbstractionWifiPhy::m_useLookupTable),
+                          MakeBooleanChecker());
+    return tid;
+}
+
+LinkAbstractionWifiPhy::LinkAbstractionWifiPhy()
+    : m_rxPower(0),
+      m_rxInterferenceEnergy(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+LinkAbstractionWifiPhy::~LinkAbstractionWifiPhy()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+LinkAbstractionWifiPhy::DoInitialize()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_useLookupTable && m_interference && m_interference->GetErrorRateModel())
+    {
+        m_interference->GetErrorRateModel()->SetAttribute("UseLookupTable", BooleanValue(true));
+    }
+    YansWifiPhy::DoInitialize();
+}
+
+void
+LinkAbstractionWifiPhy::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_startRxPayloadEvent.Cancel();
+    m_endRxEvent.Cancel();
+    m_ccaUpdateEvent.Cancel();
+    m_rxPpdu = nullptr;
+    m_signals.clear();
+    YansWifiPhy::DoDispose();
+}
+
+void
+LinkAbstractionWifiPhy::DoChannelSwitch()
+{
+    NS_LOG_FUNCTION(this);
+    AbortReception(CHANNEL_SWITCHING);
+    m_signals.clear();
+    YansWifiPhy::DoChannelSwitch();
+}
+
+bool
+LinkAbstractionWifiPhy::CanReceive(Ptr<const WifiPpdu> ppdu) const
+{
+    const auto modulation = ppdu->GetModulation();
+    const auto it = m_phyEntities.find(modulation);
+    if (it == m_phyEntities.cend() || modulation > GetMaxModulationClassSupported())
+    {
+        NS_LOG_DEBUG("Unsupported modulation received (" << modulation << ")");
+        return false;
+    }
+    if (ppdu->GetType() != WIFI_PPDU_TYPE_SU)
+    {
+        NS_LOG_DEBUG("MU PPDUs are not supported");
+        return false;
+    }
+    return it->second->CanStartRx(ppdu);
+}
+
+Watt_u
+LinkAbstractionWifiPhy::UpdateSignals()
+{
+    const auto now = Simulator::Now();
+    std::erase_if(m_signals, [now](const Signal& signal) { return signal.end <= now; });
+    Watt_u total{0};
+    for (const auto& signal : m_signals)
+    {
+        total += signal.power;
+    }
+    return total;
+}
+
+Watt_u
+LinkAbstractionWifiPhy::GetBackgroundInterference(const RxPowerWattPerChannelBand& rxPowersW) const
+{
+    Watt_u background{0};
+    for (const auto& [band, power] : rxPowersW)
+    {
+        background += m_interference->GetBackgroundInterference(band);
+    }
+    return background;
+}
+
+void
+LinkAbstractionWifiPhy::StartReceivePreamble(Ptr<const WifiPpdu> ppdu,
+                                             RxPowerWattPerChannelBand& rxPowersW,
+                                             Time rxDuration)
+{
+    NS_LOG_FUNCTION(this << ppdu << rxDuration);
+    if (MaybeAddBackgroundInterference(rxPowersW, rxDuration))
+    {
+        return;
+    }
+    const auto now = Simulator::Now();
+    Watt_u rxPower{0};
+    for (const auto& [band, power] : rxPowersW)
+    {
+        rxPower += power;
+    }
+    const auto interference = UpdateSignals();
+    m_signals.push_back({now + rxDuration, rxPower});
+
+    if (m_rxPpdu)
+    {
+        // the signal interferes with the PPDU being received
+        const auto overlap = std::min(now + rxDuration, m_rxEnd) - now;
+        m_rxInterferenceEnergy += rxPower * overlap.GetSeconds();
+        NotifyRxPpduDrop(ppdu, RXING);
+        return;
+    }
+
+    switch (m_state->GetState())
+    {
+    case WifiPhyState::IDLE:
+    case WifiPhyState::CCA_BUSY:
+        break;
+    case WifiPhyState::TX:
+        NotifyRxPpduDrop(ppdu, TXING);
+        return;
+    case WifiPhyState::SWITCHING:
+        NotifyRxPpduDrop(ppdu, CHANNEL_SWITCHING);
+        return;
+    case WifiPhyState::SLEEP:
+        NotifyRxPpduDrop(ppdu, SLEEPING);
+        return;
+    case WifiPhyState::OFF:
+        NotifyRxPpduDrop(ppdu, POWERED_OFF);
+        return;
+    default:
+        NS_FATAL_ERROR("Unexpected PHY state " << m_state->GetState());
+    }
+
+    if (!CanReceive(ppdu))
+    {
+        NotifyRxPpduDrop(ppdu, UNSUPPORTED_SETTINGS);
+        UpdateCca();
+        return;
+    }
+
+    const auto& txVector = ppdu->GetTxVector();
+    const auto width = std::min(txVector.GetChannelWidth(), GetChannelWidth());
+    const auto background = GetBackgroundInterference(rxPowersW);
+    const auto sinr = m_interference->CalculateSnr(rxPower, interference + background, width, 1);
+    if (RatioToDb(sinr) < m_rxSinrThreshold)
+    {
+        NS_LOG_DEBUG("SINR too low to synchronize on the PPDU: " << RatioToDb(sinr) << " dB");
+        NotifyRxPpduDrop(ppdu, PREAMBLE_DETECT_FAILURE);
+        UpdateCca();
+        return;
+    }
+
+    NS_LOG_DEBUG("Start receiving PPDU with SINR " << RatioToDb(sinr) << " dB");
+    m_rxPpdu = ppdu;
+    m_rxPowersW = rxPowersW;
+    m_rxPower = rxPower;
+    m_rxStart = now;
+    m_rxEnd = now + rxDuration;
+    // the signals already present interfere with the reception until they end
+    m_rxInterferenceEnergy = 0;
+    for (auto it = m_signals.cbegin(); it != std::prev(m_signals.cend()); ++it)
+    {
+        m_rxInterferenceEnergy += it->power * (std::min(it->end, m_rxEnd) - now).GetSeconds();
+    }
+
+    const auto headerDuration = std::min(
+        GetPhyEntity(ppdu->GetModulation())->CalculatePhyPreambleAndHeaderDuration(txVector),
+        rxDuration);
+    NotifyCcaBusy(nullptr, headerDuration);
+    m_startRxPayloadEvent =
+        Simulator::Schedule(headerDuration, &LinkAbstractionWifiPhy::StartReceivePayload, this);
+}
+
+void
+LinkAbstractionWifiPhy::StartReceivePayload()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(m_rxPpdu);
+    if (!m_state->IsStateIdle() && !m_state->IsStateCcaBusy())
+    {
+        AbortReception(m_state->IsStateSleep() ? SLEEPING : POWERED_OFF);
+        return;
+    }
+    const auto& txVector = m_rxPpdu->GetTxVector();
+    const auto payloadDuration = m_rxEnd - Simulator::Now();
+    NotifyRxBegin(m_rxPpdu->GetPsdu(), m_rxPowersW);
+    NotifyRxPayloadBegin(txVector, payloadDuration);
+    m_state->SwitchToRx(payloadDuration);
+    m_endRxEvent = Simulator::Schedule(payloadDuration, &LinkAbstractionWifiPhy::EndReceive, this);
+}
+
+void
+LinkAbstractionWifiPhy::EndReceive()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(m_rxPpdu);
+    // the RX state ends now, hence only check that the PHY has not been put to sleep or off
+    if (m_state->IsStateSleep() || m_state->IsStateOff())
+    {
+        AbortReception(m_state->IsStateSleep() ? SLEEPING : POWERED_OFF);
+        return;
+    }
+    const auto ppdu = m_rxPpdu;
+    const auto psdu = ppdu->GetPsdu();
+    const auto& txVector = ppdu->GetTxVector();
+    const auto modulation = ppdu->GetModulation();
+
+    const auto width = std::min(txVector.GetChannelWidth(), GetChannelWidth());
+    const Watt_u interference = m_rxInterferenceEnergy / (m_rxEnd - m_rxStart).GetSeconds() +
+                                GetBackgroundInterference(m_rxPowersW);
+    const auto snr =
+        m_interference->CalculateSnr(m_rxPower, interference, width, txVector.GetNss());
+    const auto errorRateModel = m_interference->GetErrorRateModel();
+    const auto nRx = GetNumberOfAntennas();
+
+    // the PHY header is made of the L-SIG (24 bits) for OFDM PPDUs and of the PLCP header
+    // (48 bits) for DSSS PPDUs
+    const auto headerMode =
+        GetPhyEntity(modulation)->GetSigMode(WIFI_PPDU_FIELD_NON_HT_HEADER, txVector);
+    const uint64_t headerBits =
+        (modulation == WIFI_MOD_CLASS_DSSS || modulation == WIFI_MOD_CLASS_HR_DSSS) ? 48 : 24;
+    const auto headerSuccessRate =
+        errorRateModel->GetChunkSuccessRate(headerMode,
+                                            txVector,
+                                            snr,
+                                            headerBits,
+                                            nRx,
+                                            WIFI_PPDU_FIELD_NON_HT_HEADER,
+                                            SU_STA_ID);
+    const bool headerOk = m_random->GetValue() < headerSuccessRate;
+
+    RxSignalInfo rxSignalInfo;
+    rxSignalInfo.snr = snr;
+    rxSignalInfo.rssi = WToDbm(m_rxPower);
+
+    std::vector<bool> statusPerMpdu;
+    statusPerMpdu.reserve(psdu->GetNMpdus());
+    for (const auto& mpdu : *psdu)
+    {
+        const auto successRate = errorRateModel->GetChunkSuccessRate(txVector.GetMode(),
+                                                                     txVector,
+                                                                     snr,
+                                                                     mpdu->GetSize() * 8,
+                                                                     nRx,
+                                                                     WIFI_PPDU_FIELD_DATA,
+                                                                     SU_STA_ID);
+        const bool success = headerOk && (m_random->GetValue() < successRate);
+        statusPerMpdu.push_back(success);
+        if (success && psdu->GetNMpdus() > 1)
+        {
+            // only done for correct MPDU that is part of an A-MPDU
+            m_state->NotifyRxMpdu(Create<const WifiPsdu>(mpdu, false), rxSignalInfo, txVector);
+        }
+    }
+    NS_LOG_DEBUG("SNR=" << RatioToDb(snr) << "dB, header received=" << headerOk);
+
+    NotifyRxEnd(psdu);
+    const auto success = std::count(statusPerMpdu.cbegin(), statusPerMpdu.cend(), true) > 0;
+    if (success)
+    {
+        NotifyMonitorSniffRx(psdu,
+                             GetFrequency(),
+                             txVector,
+                             {rxSignalInfo.rssi, WToDbm(m_rxPower / snr)},
+                             statusPerMpdu,
+                             SU_STA_ID);
+        m_state->SwitchFromRxEndOk();
+        m_previouslyRxPpduUid = ppdu->GetUid();
+    }
+    else
+    {
+        m_state->SwitchFromRxEndError();
+    }
+    m_state->NotifyRxPpduOutcome(ppdu, rxSignalInfo, txVector, SU_STA_ID, statusPerMpdu);
+    m_rxPpdu = nullptr;
+    UpdateCca();
+
+    // notify the MAC as the last action, since the MAC may request a PHY state change
+    success ? m_state->NotifyRxPsduSucceeded(psdu, rxSignalInfo, txVector, SU_STA_ID, statusPerMpdu)
+            : m_state->NotifyRxPsduFailed(psdu, snr);
+}
+
+void
+LinkAbstractionWifiPhy::AbortReception(WifiPhyRxfailureReason reason)
+{
+    NS_LOG_FUNCTION(this << reason);
+    if (!m_rxPpdu)
+    {
+        return;
+    }
+    m_startRxPayloadEvent.Cancel();
+    m_endRxEvent.Cancel();
+    NotifyRxPpduDrop(m_rxPpdu, reason);
+    m_rxPpdu = nullptr;
+}
+
+void
+LinkAbstractionWifiPhy::StartTx(Ptr<const WifiPpdu> ppdu)
+{
+    NS_LOG_FUNCTION(this << ppdu);
+    AbortReception(RECEPTION_ABORTED_BY_TX);
+    YansWifiPhy::StartTx(ppdu);
+    // the signals received during the transmission may keep the medium busy afterwards
+    m_ccaUpdateEvent.Cancel();
+    m_ccaUpdateEvent =
+        Simulator::Schedule(ppdu->GetTxDuration(), &LinkAbstractionWifiPhy::UpdateCca, this);
+}
+
+void
+LinkAbstractionWifiPhy::UpdateCca()
+{
+    NS_LOG_FUNCTION(this);
+    if (!m_state->IsStateIdle() && !m_state->IsStateCcaBusy())
+    {
+        return;
+    }
+    auto total = UpdateSignals();
+    const auto now = Simulator::Now();
+    const auto ccaSensitivity = DbmToW(GetCcaSensitivityThreshold());
+    const auto ccaEdThreshold = DbmToW(GetCcaEdThreshold());
+    auto end = now;
+    // signals above the CCA sensitivity threshold keep the medium busy until they end
+    for (const auto& signal : m_signals)
+    {
+        if (signal.power >= ccaSensitivity)
+        {
+            end = std::max(end, signal.end);
+        }
+    }
+    // the medium is busy until the total power falls below the CCA-ED threshold
+    std::sort(m_signals.begin(), m_signals.end(), [](const Signal& a, const Signal& b) {
+        return a.end < b.end;
+    });
+    for (const auto& signal : m_signals)
+    {
+        if (total < ccaEdThreshold)
+        {
+            break;
+        }
+        end = std::max(end, signal.end);
+        total -= signal.power;
+    }
+    if (end > now)
+    {
+        NotifyCcaBusy(nullptr, end - now);
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,135 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef LINK_ABSTRACTION_WIFI_PHY_H
+#define LINK_ABSTRACTION_WIFI_PHY_H
+
+#include "yans-wifi-phy.h"
+
+#include "ns3/event-id.h"
+
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \brief Lightweight 802.11 PHY layer model for large scale studies
+ * \ingroup wifi
+ *
+ * This PHY shares the interface, the channel and the PPDU timing of YansWifiPhy, but it
+ * replaces the per-PPDU signal processing (preamble detection, PHY header and payload
+ * reception through the PHY entities, interference tracking through InterferenceHelper)
+ * with a link abstraction:
+ *
+ * - the PHY synchronizes on an incoming PPDU if it is idle (or CCA busy) and the SINR at the
+ *   start of the PPDU is at least RxSinrThreshold; otherwise the PPDU is treated as
+ *   interference. There is no frame capture;
+ * - the interference is the average power of the overlapping signals over the duration of the
+ *   PPDU being received, hence a single SINR value is computed per PPDU;
+ * - the PHY header and every MPDU are received with the success rate returned by the error
+ *   rate model for that SINR. By default, the error rate model interpolates the success rates
+ *   from lookup tables (see the UseLookupTable attribute of ErrorRateModel);
+ * - the CCA is busy as long as a signal above the CCA sensitivity threshold is present or
+ *   the total received power is above the CCA-ED threshold;
+ * - signals received below the BackgroundInterferenceThreshold of WifiPhy are added to the
+ *   background interference, whose power is added to the interference of the PPDUs.
+ *
+ * Only SU PPDUs are received; MU PPDUs (DL/UL OFDMA and MU-MIMO) are treated as
+ * interference. The post-reception error model, the OBSS PD spatial reuse and the
+ * PhyRxMacHeaderEnd trace source are not supported.
+ */
+class LinkAbstractionWifiPhy : public YansWifiPhy
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    LinkAbstractionWifiPhy();
+    ~LinkAbstractionWifiPhy() override;
+
+    void StartReceivePreamble(Ptr<const WifiPpdu> ppdu,
+                              RxPowerWattPerChannelBand& rxPowersW,
+                              Time rxDuration) override;
+    void StartTx(Ptr<const WifiPpdu> ppdu) override;
+
+  protected:
+    void DoInitialize() override;
+    void DoDispose() override;
+    void DoChannelSwitch() override;
+
+  private:
+    /**
+     * Check whether the given PPDU can be received by this PHY.
+     *
+     * \param ppdu the PPDU
+     * \return true if the PPDU can be received
+     */
+    bool CanReceive(Ptr<const WifiPpdu> ppdu) const;
+
+    /**
+     * Start receiving the payload of the PPDU being received, at the end of its PHY header.
+     */
+    void StartReceivePayload();
+
+    /**
+     * End the reception of the PPDU being received, draw the reception outcome of its MPDUs
+     * and notify the MAC.
+     */
+    void EndReceive();
+
+    /**
+     * Abort the reception of the PPDU being received, if any.
+     *
+     * \param reason the reason of the abort
+     */
+    void AbortReception(WifiPhyRxfailureReason reason);
+
+    /**
+     * Remove the signals that have ended and return the total power of the remaining ones.
+     *
+     * \return the total power of the ongoing signals
+     */
+    Watt_u UpdateSignals();
+
+    /**
+     * \param rxPowersW the received power per band of a PPDU
+     * \return the total power of the background interference on the bands of the PPDU
+     */
+    Watt_u GetBackgroundInterference(const RxPowerWattPerChannelBand& rxPowersW) const;
+
+    /**
+     * Switch to CCA busy if the ongoing signals keep the medium busy.
+     */
+    void UpdateCca();
+
+    /// A signal present on the medium
+    struct Signal
+    {
+        Time end;     //!< the end time of the signal
+        Watt_u power; //!< the received power of the signal
+    };
+
+    double m_rxSinrThreshold; //!< minimum SINR (dB) to synchronize on a PPDU
+    bool m_useLookupTable;    //!< whether to enable the lookup tables of the error rate model
+
+    std::vector<Signal> m_signals; //!< the ongoing signals, including the one being received
+
+    Ptr<const WifiPpdu> m_rxPpdu;          //!< the PPDU being received, if any
+    RxPowerWattPerChannelBand m_rxPowersW; //!< the received power of the PPDU being received
+    Watt_u m_rxPower;                      //!< the total received power of the PPDU
+    Time m_rxStart;                        //!< the start time of the PPDU being received
+    Time m_rxEnd;                          //!< the end time of the PPDU being received
+    double m_rxInterferenceEnergy;         //!< interference energy (J) during the reception
+    EventId m_startRxPayloadEvent;         //!< the start of the payload reception
+    EventId m_endRxEvent;                  //!< the end of the reception
+    EventId m_ccaUpdateEvent;              //!< the CCA update at the end of a transmission
+};
+
+} // namespace ns3
+
+#endif /* LINK_ABSTRACTION_WIFI_PHY_H */
@@ -60,7 +60,6 @@ struct MinstrelHtWifiRemoteStation : MinstrelWifiRemoteStation
     McsGroupData m_groupsTable; //!< Table of groups with stats.
     bool m_isHt;                //!< If the station is HT capable.
 
-    std::ofstream m_statsFile; //!< File where statistics table is written.
 };
 
 NS_OBJECT_ENSURE_REGISTERED(MinstrelHtWifiManager);
@@ -1316,7 +1315,7 @@ MinstrelHtWifiManager::FindRate(MinstrelHtWifiRemoteStation* station)
              * Also do not sample if the probability is already higher than 95%
              * to avoid wasting airtime.
              */
-            MinstrelHtRateInfo sampleRateInfo =
+            const auto& sampleRateInfo =
                 station->m_groupsTable[sampleGroupId].m_ratesTable[sampleRateId];
 
             NS_LOG_DEBUG("Use sample rate? MaxTpRate= "
@@ -1977,30 +1976,31 @@ MinstrelHtWifiManager::InitSampleTable(MinstrelHtWifiRemoteStation* station)
 void
 MinstrelHtWifiManager::PrintTable(MinstrelHtWifiRemoteStation* station)
 {
-    if (!station->m_statsFile.is_open())
+    if (!station->m_statsFile)
     {
         std::ostringstream tmp;
         tmp << "minstrel-ht-stats-" << station->m_state->m_address << ".txt";
-        station->m_statsFile.open(tmp.str(), std::ios::out);
+        station->m_statsFile = std::make_unique<std::ofstream>(tmp.str(), std::ios::out);
     }
+    auto& statsFile = *station->m_statsFile;
 
-    station->m_statsFile
+    statsFile
         << "               best   ____________rate__________    ________statistics________    "
            "________last_______    ______sum-of________\n"
         << " mode guard #  rate  [name   idx airtime  max_tp]  [avg(tp) avg(prob) sd(prob)]  "
            "[prob.|retry|suc|att]  [#success | #attempts]\n";
     for (uint8_t i = 0; i < m_numGroups; i++)
     {
-        StatsDump(station, i, station->m_statsFile);
+        StatsDump(station, i, statsFile);
     }
 
-    station->m_statsFile << "\nTotal packet count::    ideal "
-                         << Max(0, station->m_totalPacketsCount - station->m_samplePacketsCount)
-                         << "              lookaround " << station->m_samplePacketsCount << "\n";
-    station->m_statsFile << "Average # of aggregated frames per A-MPDU: " << station->m_avgAmpduLen
-                         << "\n\n";
+    statsFile << "\nTotal packet count::    ideal "
+              << Max(0, station->m_totalPacketsCount - station->m_samplePacketsCount)
+              << "              lookaround " << station->m_samplePacketsCount << "\n";
+    statsFile << "Average # of aggregated frames per A-MPDU: " << station->m_avgAmpduLen
+              << "\n\n";
 
-    station->m_statsFile.flush();
+    statsFile.flush();
 }
 
 void
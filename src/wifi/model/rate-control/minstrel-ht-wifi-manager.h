@@ -93,20 +93,16 @@ struct MinstrelHtWifiRemoteStation;
  */
 struct MinstrelHtRateInfo
 {
+    // The members are ordered by decreasing alignment to avoid padding, since a
+    // rate table is allocated for every group supported by every remote station.
+
     /**
      * Perfect transmission time calculation, or frame calculation.
      * Given a bit rate and a packet length n bytes.
      */
     Time perfectTxTime;
-    bool supported;      //!< If the rate is supported.
-    uint8_t mcsIndex;    //!< The index in the operationalMcsSet of the WifiRemoteStationManager.
-    uint32_t retryCount; //!< Retry limit.
-    uint32_t adjustedRetryCount; //!< Adjust the retry limit for this rate.
-    uint32_t numRateAttempt;     //!< Number of transmission attempts so far.
-    uint32_t numRateSuccess;     //!< Number of successful frames transmitted so far.
     double prob; //!< Current probability within last time interval. (# frame success )/(# total
                  //!< frames)
-    bool retryUpdated; //!< If number of retries was updated already.
     /**
      * Exponential weighted moving average of probability.
      * EWMA calculation:
@@ -114,13 +110,20 @@ struct MinstrelHtRateInfo
      */
     double ewmaProb;
     double ewmsdProb;            //!< Exponential weighted moving standard deviation of probability.
+    double throughput;           //!< Throughput of this rate (in packets per second).
+    uint64_t successHist;        //!< Aggregate of all transmission successes.
+    uint64_t attemptHist;        //!< Aggregate of all transmission attempts.
+    uint32_t retryCount;         //!< Retry limit.
+    uint32_t adjustedRetryCount; //!< Adjust the retry limit for this rate.
+    uint32_t numRateAttempt;     //!< Number of transmission attempts so far.
+    uint32_t numRateSuccess;     //!< Number of successful frames transmitted so far.
     uint32_t prevNumRateAttempt; //!< Number of transmission attempts with previous rate.
     uint32_t prevNumRateSuccess; //!< Number of successful frames transmitted with previous rate.
     uint32_t numSamplesSkipped;  //!< Number of times this rate statistics were not updated because
                                  //!< no attempts have been made.
-    uint64_t successHist;        //!< Aggregate of all transmission successes.
-    uint64_t attemptHist;        //!< Aggregate of all transmission attempts.
-    double throughput;           //!< Throughput of this rate (in packets per second).
+    uint8_t mcsIndex;  //!< The index in the operationalMcsSet of the WifiRemoteStationManager.
+    bool supported;    //!< If the rate is supported.
+    bool retryUpdated; //!< If number of retries was updated already.
 };
 
 /**
@@ -1108,14 +1108,15 @@ MinstrelWifiManager::PrintSampleTable(MinstrelWifiRemoteStation* station) const
 void
 MinstrelWifiManager::PrintTable(MinstrelWifiRemoteStation* station)
 {
-    if (!station->m_statsFile.is_open())
+    if (!station->m_statsFile)
     {
         std::ostringstream tmp;
         tmp << "minstrel-stats-" << station->m_state->m_address << ".txt";
-        station->m_statsFile.open(tmp.str(), std::ios::out);
+        station->m_statsFile = std::make_unique<std::ofstream>(tmp.str(), std::ios::out);
     }
+    auto& statsFile = *station->m_statsFile;
 
-    station->m_statsFile
+    statsFile
         << "best   _______________rate________________    ________statistics________    "
            "________last_______    ______sum-of________\n"
         << "rate  [      name       idx airtime max_tp]  [avg(tp) avg(prob) sd(prob)]  "
@@ -1131,46 +1132,46 @@ MinstrelWifiManager::PrintTable(MinstrelWifiRemoteStation* station)
 
         if (i == maxTpRate)
         {
-            station->m_statsFile << 'A';
+            statsFile << 'A';
         }
         else
         {
-            station->m_statsFile << ' ';
+            statsFile << ' ';
         }
         if (i == maxTpRate2)
         {
-            station->m_statsFile << 'B';
+            statsFile << 'B';
         }
         else
         {
-            station->m_statsFile << ' ';
+            statsFile << ' ';
         }
         if (i == maxProbRate)
         {
-            station->m_statsFile << 'P';
+            statsFile << 'P';
         }
         else
         {
-            station->m_statsFile << ' ';
+            statsFile << ' ';
         }
 
         float tmpTh = rate.throughput / 100000.0F;
-        station->m_statsFile << "   " << std::setw(17) << GetSupported(station, i) << "  "
-                             << std::setw(2) << i << "  " << std::setw(4)
-                             << rate.perfectTxTime.GetMicroSeconds() << std::setw(8)
-                             << "    -----    " << std::setw(8) << tmpTh << "    " << std::setw(3)
-                             << rate.ewmaProb / 180 << std::setw(3) << "       ---      "
-                             << std::setw(3) << rate.prob / 180 << "     " << std::setw(1)
-                             << rate.adjustedRetryCount << "   " << std::setw(3)
-                             << rate.prevNumRateSuccess << " " << std::setw(3)
-                             << rate.prevNumRateAttempt << "   " << std::setw(9) << rate.successHist
-                             << "   " << std::setw(9) << rate.attemptHist << "\n";
+        statsFile << "   " << std::setw(17) << GetSupported(station, i) << "  "
+                  << std::setw(2) << i << "  " << std::setw(4)
+                  << rate.perfectTxTime.GetMicroSeconds() << std::setw(8)
+                  << "    -----    " << std::setw(8) << tmpTh << "    " << std::setw(3)
+                  << rate.ewmaProb / 180 << std::setw(3) << "       ---      "
+                  << std::setw(3) << rate.prob / 180 << "     " << std::setw(1)
+                  << rate.adjustedRetryCount << "   " << std::setw(3)
+                  << rate.prevNumRateSuccess << " " << std::setw(3)
+                  << rate.prevNumRateAttempt << "   " << std::setw(9) << rate.successHist
+                  << "   " << std::setw(9) << rate.attemptHist << "\n";
     }
-    station->m_statsFile << "\nTotal packet count:    ideal "
-                         << station->m_totalPacketsCount - station->m_samplePacketsCount
-                         << "      lookaround " << station->m_samplePacketsCount << "\n\n";
+    statsFile << "\nTotal packet count:    ideal "
+              << station->m_totalPacketsCount - station->m_samplePacketsCount
+              << "      lookaround " << station->m_samplePacketsCount << "\n\n";
 
-    station->m_statsFile.flush();
+    statsFile.flush();
 }
 
 } // namespace ns3
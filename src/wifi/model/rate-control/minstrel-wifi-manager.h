@@ -15,6 +15,7 @@
 
 #include <fstream>
 #include <map>
+#include <memory>
 
 namespace ns3
 {
@@ -99,7 +100,7 @@ struct MinstrelWifiRemoteStation : public WifiRemoteStation
     bool m_initialized;           ///< for initializing tables
     MinstrelRate m_minstrelTable; ///< minstrel table
     SampleRate m_sampleTable;     ///< sample table
-    std::ofstream m_statsFile;    ///< stats file
+    std::unique_ptr<std::ofstream> m_statsFile; ///< stats file (only created if stats are printed)
 };
 
 /**
@@ -352,6 +352,11 @@ void
 StaWifiMac::SendProbeRequest(uint8_t linkId)
 {
     NS_LOG_FUNCTION(this << linkId);
+    if (m_state != SCANNING)
+    {
+        NS_LOG_DEBUG("Not scanning anymore (e.g., static association), do not send probe");
+        return;
+    }
     WifiMacHeader hdr;
     hdr.SetType(WIFI_MAC_MGT_PROBE_REQUEST);
     hdr.SetAddr1(Mac48Address::GetBroadcast());
@@ -777,6 +782,13 @@ StaWifiMac::ScanningTimeout(const std::optional<ApInfo>& bestAp)
 {
     NS_LOG_FUNCTION(this);
 
+    if (m_state != SCANNING)
+    {
+        // the station may have been associated in the meantime, e.g., by the static setup helper
+        NS_LOG_DEBUG("Not scanning anymore, ignore the end of scanning");
+        return;
+    }
+
     if (!bestAp.has_value())
     {
         NS_LOG_DEBUG("Exhausted list of candidate AP; restart scanning");
@@ -136,6 +136,8 @@ class StaWifiMac : public WifiMac
     friend class ::AmpduAggregationTest;
     /// Allow test cases to access private members
     friend class ::MultiLinkOperationsTestBase;
+    /// Allow the static setup helper to associate the station
+    friend class WifiStaticSetupHelper;
 
     /// type of the management frames used to get info about APs
     using MgtFrameType =
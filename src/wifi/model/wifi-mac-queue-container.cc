@@ -24,22 +24,24 @@ WifiMacQueueContainer::clear()
 {
     m_queues.clear();
     m_expiredQueue.clear();
-    m_nBytesPerQueue.clear();
+    m_expiryIndex.clear();
 }
 
 WifiMacQueueContainer::iterator
 WifiMacQueueContainer::insert(const_iterator pos, Ptr<WifiMpdu> item)
 {
     WifiContainerQueueId queueId = GetQueueId(item);
+    auto& info = m_queues[queueId];
 
-    NS_ABORT_MSG_UNLESS(pos == m_queues[queueId].cend() || GetQueueId(pos->mpdu) == queueId,
+    NS_ABORT_MSG_UNLESS(pos == info.queue.cend() || GetQueueId(pos->mpdu) == queueId,
                         "pos iterator does not point to the correct container queue");
     NS_ABORT_MSG_IF(!item->IsOriginal(), "Only the original copy of an MPDU can be inserted");
 
-    auto [it, ret] = m_nBytesPerQueue.insert({queueId, 0});
-    it->second += item->GetSize();
-
-    return m_queues[queueId].emplace(pos, item);
+    info.nBytes += item->GetSize();
+    auto it = info.queue.emplace(pos, item);
+    // the expiry time of the new MPDU is not known yet, scan the queue at the next extraction
+    UpdateExpiryIndex(info, Time{0});
+    return it;
 }
 
 WifiMacQueueContainer::iterator
@@ -50,13 +52,15 @@ WifiMacQueueContainer::erase(const_iterator pos)
         return m_expiredQueue.erase(pos);
     }
 
-    WifiContainerQueueId queueId = GetQueueId(pos->mpdu);
-    auto it = m_nBytesPerQueue.find(queueId);
-    NS_ASSERT(it != m_nBytesPerQueue.end());
-    NS_ASSERT(it->second >= pos->mpdu->GetSize());
-    it->second -= pos->mpdu->GetSize();
+    auto infoIt = m_queues.find(GetQueueId(pos->mpdu));
+    NS_ASSERT(infoIt != m_queues.end());
+    auto& info = infoIt->second;
+    NS_ASSERT(info.nBytes >= pos->mpdu->GetSize());
+    info.nBytes -= pos->mpdu->GetSize();
 
-    return m_queues[queueId].erase(pos);
+    auto it = info.queue.erase(pos);
+    UpdateExpiryIndex(info, Time{0});
+    return it;
 }
 
 Ptr<WifiMpdu>
@@ -91,32 +95,61 @@ WifiMacQueueContainer::GetQueueId(Ptr<const WifiMpdu> mpdu)
 const WifiMacQueueContainer::ContainerQueue&
 WifiMacQueueContainer::GetQueue(const WifiContainerQueueId& queueId) const
 {
-    return m_queues[queueId];
+    return m_queues[queueId].queue;
 }
 
 uint32_t
 WifiMacQueueContainer::GetNBytes(const WifiContainerQueueId& queueId) const
 {
-    if (auto it = m_queues.find(queueId); it == m_queues.end() || it->second.empty())
+    if (auto it = m_queues.find(queueId); it != m_queues.end())
+    {
+        return it->second.nBytes;
+    }
+    return 0;
+}
+
+void
+WifiMacQueueContainer::UpdateExpiryIndex(QueueInfo& info, Time scanTime) const
+{
+    if (info.expiryIt)
+    {
+        if (!info.queue.empty() && (*info.expiryIt)->first == scanTime)
+        {
+            return;
+        }
+        m_expiryIndex.erase(*info.expiryIt);
+        info.expiryIt.reset();
+    }
+    if (!info.queue.empty())
     {
-        return 0;
+        info.expiryIt = m_expiryIndex.emplace(scanTime, &info);
     }
-    return m_nBytesPerQueue.at(queueId);
 }
 
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
 WifiMacQueueContainer::ExtractExpiredMpdus(const WifiContainerQueueId& queueId) const
 {
-    return DoExtractExpiredMpdus(m_queues[queueId]);
+    auto& info = m_queues[queueId];
+    if (!info.expiryIt || (*info.expiryIt)->first > Simulator::Now())
+    {
+        // no MPDU can be extracted from this queue
+        return {m_expiredQueue.end(), m_expiredQueue.end()};
+    }
+    return DoExtractExpiredMpdus(info);
 }
 
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
-WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
+WifiMacQueueContainer::DoExtractExpiredMpdus(QueueInfo& info) const
 {
+    auto& queue = info.queue;
     std::optional<std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>> ret;
     auto firstExpiredIt = queue.begin();
     auto lastExpiredIt = firstExpiredIt;
     Time now = Simulator::Now();
+    // the earliest time at which an MPDU may have to be extracted from this queue, i.e., the
+    // expiry time of the first MPDU that is neither inflight nor expired, unless an inflight
+    // MPDU preceding it expires earlier (and hence can be extracted when no longer inflight)
+    Time scanTime = Time::Max();
 
     do
     {
@@ -125,6 +158,7 @@ WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
              firstExpiredIt != queue.end() && !firstExpiredIt->inflights.empty();
              ++firstExpiredIt, ++lastExpiredIt)
         {
+            scanTime = Min(scanTime, firstExpiredIt->expiryTime);
         }
 
         if (!ret)
@@ -142,11 +176,8 @@ WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
             lastExpiredIt->ac = AC_UNDEF;
             lastExpiredIt->deleter(lastExpiredIt->mpdu);
 
-            WifiContainerQueueId queueId = GetQueueId(lastExpiredIt->mpdu);
-            auto it = m_nBytesPerQueue.find(queueId);
-            NS_ASSERT(it != m_nBytesPerQueue.end());
-            NS_ASSERT(it->second >= lastExpiredIt->mpdu->GetSize());
-            it->second -= lastExpiredIt->mpdu->GetSize();
+            NS_ASSERT(info.nBytes >= lastExpiredIt->mpdu->GetSize());
+            info.nBytes -= lastExpiredIt->mpdu->GetSize();
 
             ++lastExpiredIt;
         }
@@ -160,6 +191,12 @@ WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
 
     } while (lastExpiredIt != firstExpiredIt);
 
+    if (lastExpiredIt != queue.end())
+    {
+        scanTime = Min(scanTime, lastExpiredIt->expiryTime);
+    }
+    UpdateExpiryIndex(info, scanTime);
+
     return *ret;
 }
 
@@ -168,9 +205,17 @@ WifiMacQueueContainer::ExtractAllExpiredMpdus() const
 {
     std::optional<WifiMacQueueContainer::iterator> firstExpiredIt;
 
-    for (auto& queue : m_queues)
+    // collect the queues to scan first, because scanning a queue updates the expiry index
+    std::vector<QueueInfo*> toScan;
+    const auto end = m_expiryIndex.upper_bound(Simulator::Now());
+    for (auto it = m_expiryIndex.begin(); it != end; ++it)
     {
-        auto [firstIt, lastIt] = DoExtractExpiredMpdus(queue.second);
+        toScan.push_back(it->second);
+    }
+
+    for (auto info : toScan)
+    {
+        auto [firstIt, lastIt] = DoExtractExpiredMpdus(*info);
 
         if (firstIt != lastIt && !firstExpiredIt)
         {
@@ -198,16 +243,20 @@ std::size_t
 std::hash<ns3::WifiContainerQueueId>::operator()(ns3::WifiContainerQueueId queueId) const
 {
     auto [type, addrType, address, tid] = queueId;
-    const std::size_t size = tid.has_value() ? 8 : 7;
 
-    std::vector<uint8_t> buffer(size);
-    buffer[0] = type;
-    address.CopyTo(&buffer[1]);
+    // pack all the fields in a 64-bit integer to avoid memory allocations
+    uint8_t buffer[6];
+    address.CopyTo(buffer);
+    uint64_t key = 0;
+    for (const auto byte : buffer)
+    {
+        key = (key << 8) | byte;
+    }
+    key |= static_cast<uint64_t>(type) << 48;
+    key |= static_cast<uint64_t>(addrType) << 50;
     if (tid.has_value())
     {
-        buffer[7] = *tid;
+        key |= static_cast<uint64_t>(*tid + 1) << 52;
     }
-
-    std::string s(buffer.begin(), buffer.end());
-    return std::hash<std::string>{}(s);
+    return std::hash<uint64_t>{}(key);
 }
@@ -12,8 +12,10 @@
 #include "wifi-mac-queue-elem.h"
 
 #include "ns3/mac48-address.h"
+#include "ns3/nstime.h"
 
 #include <list>
+#include <map>
 #include <optional>
 #include <tuple>
 #include <unordered_map>
@@ -98,6 +100,12 @@ namespace ns3
  *
  * This container holds multiple container queues organized in an hash table
  * whose keys are WifiContainerQueueId tuples identifying the container queues.
+ *
+ * In order to avoid scanning all the container queues every time the MPDUs with
+ * expired lifetime are extracted, non-empty container queues are kept in an expiry
+ * index, sorted by the earliest time at which they may hold an MPDU to extract. A
+ * container queue is scanned only when this time has been reached, which is reset
+ * whenever an MPDU is inserted in or erased from the container queue.
  */
 class WifiMacQueueContainer
 {
@@ -194,21 +202,43 @@ class WifiMacQueueContainer
     std::pair<iterator, iterator> GetAllExpiredMpdus() const;
 
   private:
+    struct QueueInfo;
+
+    /// Expiry index: container queues sorted by the time at which they must be scanned
+    using ExpiryIndex = std::multimap<Time, QueueInfo*>;
+
+    /// Information associated with a container queue
+    struct QueueInfo
+    {
+        ContainerQueue queue; //!< the container queue
+        uint32_t nBytes{0};   //!< size in bytes of the container queue
+        std::optional<ExpiryIndex::iterator>
+            expiryIt; //!< the entry in the expiry index, if the queue is not empty
+    };
+
     /**
      * Transfer non-inflight MPDUs with expired lifetime in the given container queue to the
      * container queue storing MPDUs with expired lifetime.
      *
-     * \param queue the given container queue
+     * \param info the information associated with the given container queue
      * \return the range [first, last) of iterators pointing to the MPDUs transferred
      *         to the container queue storing MPDUs with expired lifetime
      */
-    std::pair<iterator, iterator> DoExtractExpiredMpdus(ContainerQueue& queue) const;
+    std::pair<iterator, iterator> DoExtractExpiredMpdus(QueueInfo& info) const;
+
+    /**
+     * Update the entry of the given container queue in the expiry index. Empty container
+     * queues are removed from the expiry index.
+     *
+     * \param info the information associated with the given container queue
+     * \param scanTime the time at which the container queue must be scanned
+     */
+    void UpdateExpiryIndex(QueueInfo& info, Time scanTime) const;
 
-    mutable std::unordered_map<WifiContainerQueueId, ContainerQueue>
+    mutable std::unordered_map<WifiContainerQueueId, QueueInfo>
         m_queues;                          //!< the container queues
     mutable ContainerQueue m_expiredQueue; //!< queue storing MPDUs with expired lifetime
-    mutable std::unordered_map<WifiContainerQueueId, uint32_t>
-        m_nBytesPerQueue; //!< size in bytes of the container queues
+    mutable ExpiryIndex m_expiryIndex;     //!< the expiry index
 };
 
 } // namespace ns3
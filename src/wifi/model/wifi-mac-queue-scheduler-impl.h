@@ -24,6 +24,7 @@
 #include <vector>
 
 class WifiMacQueueDropOldestTest;
+class WifiMacQueueSchedulerLinkIndexTest;
 
 namespace ns3
 {
@@ -44,6 +45,8 @@ class WifiMacQueueSchedulerImpl : public WifiMacQueueScheduler
   public:
     /// allow WifiMacQueueDropOldestTest class access
     friend class ::WifiMacQueueDropOldestTest;
+    /// allow WifiMacQueueSchedulerLinkIndexTest class access
+    friend class ::WifiMacQueueSchedulerLinkIndexTest;
 
     /**
      * \brief Get the type ID.
@@ -137,6 +140,46 @@ class WifiMacQueueSchedulerImpl : public WifiMacQueueScheduler
      */
     using SortedQueues = std::multimap<Priority, std::reference_wrapper<QueueInfoPair>, Compare>;
 
+    /**
+     * Key of the per-link lists of sorted container queues: the priority of the container
+     * queue and the sequence number of the insertion of the container queue in the list
+     * of sorted queues. The latter breaks ties between container queues having the same
+     * priority, so that per-link lists are sorted in the same order as the list of sorted
+     * queues.
+     */
+    using LinkSortKey = std::pair<Priority, uint64_t>;
+
+    /**
+     * Function object to compare two LinkSortKey values.
+     */
+    struct LinkSortCompare
+    {
+        /**
+         * \param lhs the first key
+         * \param rhs the second key
+         * \return true if lhs precedes rhs
+         */
+        bool operator()(const LinkSortKey& lhs, const LinkSortKey& rhs) const
+        {
+            if (Compare{}(lhs.first, rhs.first))
+            {
+                return true;
+            }
+            if (Compare{}(rhs.first, lhs.first))
+            {
+                return false;
+            }
+            return lhs.second < rhs.second;
+        }
+    };
+
+    /**
+     * List of the container queues that are not empty and can be sent on a given link
+     * (i.e., the link is setup and not blocked), sorted in decreasing order of priority.
+     */
+    using LinkSortedQueues =
+        std::map<LinkSortKey, std::reference_wrapper<QueueInfoPair>, LinkSortCompare>;
+
     /**
      * Information associated with a container queue.
      */
@@ -149,6 +192,11 @@ class WifiMacQueueSchedulerImpl : public WifiMacQueueScheduler
                                               in this queue can be sent to a bitset indicating
                                               whether the link is blocked (at least one bit is
                                               non-zero) and for which reason */
+        uint64_t seqNo{0};               /**< sequence number of the last insertion of this
+                                              queue in the sorted list */
+        std::map<uint8_t, typename LinkSortedQueues::iterator>
+            linkPriorityIts; /**< iterators pointing to the entries for this queue in the
+                                  per-link sorted lists */
     };
 
     /**
@@ -159,6 +207,10 @@ class WifiMacQueueSchedulerImpl : public WifiMacQueueScheduler
         SortedQueues sortedQueues;      //!< sorted list of container queues
         QueueInfoMap queueInfoMap;      //!< information associated with container queues
         Ptr<WifiMacQueue> wifiMacQueue; //!< pointer to the WifiMacQueue object
+        std::map<uint8_t, LinkSortedQueues>
+            linkSortedQueues;  //!< per-link sorted lists of the container queues that can
+                               //!< be sent on each link
+        uint64_t nextSeqNo{0}; //!< sequence number of the next insertion in the sorted list
     };
 
     /**
@@ -208,6 +260,33 @@ class WifiMacQueueSchedulerImpl : public WifiMacQueueScheduler
                                                   std::optional<uint8_t> linkId,
                                                   typename SortedQueues::iterator sortedQueuesIt);
 
+    /**
+     * Get the next queue to serve on the given link. The search starts from the given queue
+     * in the sorted list of the container queues that can be sent on the given link, hence
+     * blocked queues and queues that cannot be sent on the given link are not visited. The
+     * returned queue is guaranteed to contain at least an MPDU whose lifetime has not expired.
+     *
+     * \param ac the Access Category that we want to serve
+     * \param linkId the ID of the link on which MPDUs contained in the returned queue must be
+     *               allowed to be sent
+     * \param sortedQueuesIt iterator pointing to the queue we start the search from
+     * \return the ID of the selected container queue (if any)
+     */
+    std::optional<WifiContainerQueueId> DoGetNextOnLink(
+        AcIndex ac,
+        uint8_t linkId,
+        typename LinkSortedQueues::iterator sortedQueuesIt);
+
+    /**
+     * Update the entries of the given container queue in the per-link sorted lists, based
+     * on its priority and on the links on which it can be sent. This function must be called
+     * every time the priority, the set of links or the link masks of a queue change.
+     *
+     * \param ac the Access Category of the container queue
+     * \param queueInfoPair the information associated with the container queue
+     */
+    void UpdateLinkSortedQueues(AcIndex ac, QueueInfoPair& queueInfoPair);
+
     /**
      * Check whether an MPDU has to be dropped before enqueuing the given MPDU.
      *
@@ -394,6 +473,7 @@ WifiMacQueueSchedulerImpl<Priority, Compare>::InitQueueInfo(AcIndex ac, Ptr<cons
         }
     }
 
+    UpdateLinkSortedQueues(ac, *queueInfoIt);
     return queueInfoIt;
 }
 
@@ -435,6 +515,66 @@ WifiMacQueueSchedulerImpl<Priority, Compare>::SetPriority(AcIndex ac,
     }
     // update the stored iterator
     queueInfoIt->second.priorityIt = sortedQueuesIt;
+    queueInfoIt->second.seqNo = m_perAcInfo[ac].nextSeqNo++;
+    UpdateLinkSortedQueues(ac, *queueInfoIt);
+}
+
+template <class Priority, class Compare>
+void
+WifiMacQueueSchedulerImpl<Priority, Compare>::UpdateLinkSortedQueues(AcIndex ac,
+                                                                     QueueInfoPair& queueInfoPair)
+{
+    auto& queueInfo = queueInfoPair.second;
+    auto& linkSortedQueues = m_perAcInfo[ac].linkSortedQueues;
+
+    // remove the entries for the links on which the queue can no longer be sent
+    for (auto it = queueInfo.linkPriorityIts.begin(); it != queueInfo.linkPriorityIts.end();)
+    {
+        const auto linkIt = queueInfo.linkIds.find(it->first);
+        if (!queueInfo.priorityIt.has_value() || linkIt == queueInfo.linkIds.cend() ||
+            linkIt->second.any())
+        {
+            linkSortedQueues[it->first].erase(it->second);
+            it = queueInfo.linkPriorityIts.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    if (!queueInfo.priorityIt.has_value())
+    {
+        return;
+    }
+
+    // add or update the entries for the links on which the queue can be sent
+    LinkSortKey key{queueInfo.priorityIt.value()->first, queueInfo.seqNo};
+    for (const auto& [linkId, mask] : queueInfo.linkIds)
+    {
+        if (mask.any())
+        {
+            continue;
+        }
+        auto& sortedQueues = linkSortedQueues[linkId];
+        if (auto it = queueInfo.linkPriorityIts.find(linkId); it != queueInfo.linkPriorityIts.end())
+        {
+            if (it->second->first.second == key.second)
+            {
+                // the queue has not been re-inserted in the sorted list since the last update
+                continue;
+            }
+            auto handle = sortedQueues.extract(it->second);
+            handle.key() = key;
+            it->second = sortedQueues.insert(std::move(handle)).position;
+        }
+        else
+        {
+            queueInfo.linkPriorityIts.emplace(
+                linkId,
+                sortedQueues.emplace(key, std::ref(queueInfoPair)).first);
+        }
+    }
 }
 
 template <class Priority, class Compare>
@@ -522,6 +662,7 @@ WifiMacQueueSchedulerImpl<Priority, Compare>::DoBlockQueues(
                 mask.set(static_cast<std::size_t>(reason), block);
             }
         }
+        UpdateLinkSortedQueues(ac, *queueInfoIt);
     }
 }
 
@@ -583,6 +724,11 @@ std::optional<WifiContainerQueueId>
 WifiMacQueueSchedulerImpl<Priority, Compare>::GetNext(AcIndex ac, std::optional<uint8_t> linkId)
 {
     NS_LOG_FUNCTION(this << +ac << linkId.has_value());
+    if (linkId.has_value())
+    {
+        auto& sortedQueues = m_perAcInfo[ac].linkSortedQueues[*linkId];
+        return DoGetNextOnLink(ac, *linkId, sortedQueues.begin());
+    }
     return DoGetNext(ac, linkId, m_perAcInfo[ac].sortedQueues.begin());
 }
 
@@ -598,12 +744,63 @@ WifiMacQueueSchedulerImpl<Priority, Compare>::GetNext(AcIndex ac,
     NS_ABORT_IF(queueInfoIt == m_perAcInfo[ac].queueInfoMap.end() ||
                 !queueInfoIt->second.priorityIt.has_value());
 
+    if (linkId.has_value())
+    {
+        const auto& linkPriorityIts = queueInfoIt->second.linkPriorityIts;
+        if (auto it = linkPriorityIts.find(*linkId); it != linkPriorityIts.cend())
+        {
+            return DoGetNextOnLink(ac, *linkId, std::next(it->second));
+        }
+        // the previous queue cannot be sent on the given link (it may have been blocked
+        // in the meantime), hence search the sorted list starting from that queue
+    }
+
     auto sortedQueuesIt = queueInfoIt->second.priorityIt.value();
     NS_ABORT_IF(sortedQueuesIt == m_perAcInfo[ac].sortedQueues.end());
 
     return DoGetNext(ac, linkId, ++sortedQueuesIt);
 }
 
+template <class Priority, class Compare>
+std::optional<WifiContainerQueueId>
+WifiMacQueueSchedulerImpl<Priority, Compare>::DoGetNextOnLink(
+    AcIndex ac,
+    uint8_t linkId,
+    typename LinkSortedQueues::iterator sortedQueuesIt)
+{
+    NS_LOG_FUNCTION(this << +ac << +linkId);
+    NS_ASSERT(static_cast<uint8_t>(ac) < AC_UNDEF);
+
+    auto& sortedQueues = m_perAcInfo[ac].linkSortedQueues[linkId];
+
+    while (sortedQueuesIt != sortedQueues.end())
+    {
+        const auto& queueInfoPair = sortedQueuesIt->second.get();
+
+        // Remove packets with expired lifetime from this queue. In case the queue becomes
+        // empty, the queue is removed from the sorted lists and sortedQueuesIt is invalidated;
+        // thus, store an iterator to the previous queue in the sorted list (if any) to resume
+        // the search afterwards.
+        std::optional<typename LinkSortedQueues::iterator> prevQueueIt;
+        if (sortedQueuesIt != sortedQueues.begin())
+        {
+            prevQueueIt = std::prev(sortedQueuesIt);
+        }
+
+        GetWifiMacQueue(ac)->ExtractExpiredMpdus(queueInfoPair.first);
+
+        if (GetWifiMacQueue(ac)->GetNBytes(queueInfoPair.first) == 0)
+        {
+            sortedQueuesIt =
+                (prevQueueIt.has_value() ? std::next(prevQueueIt.value()) : sortedQueues.begin());
+            continue;
+        }
+        return queueInfoPair.first;
+    }
+
+    return std::nullopt;
+}
+
 template <class Priority, class Compare>
 std::optional<WifiContainerQueueId>
 WifiMacQueueSchedulerImpl<Priority, Compare>::DoGetNext(
@@ -713,6 +910,7 @@ WifiMacQueueSchedulerImpl<Priority, Compare>::NotifyDequeue(AcIndex ac,
             {
                 m_perAcInfo[ac].sortedQueues.erase(queueInfoIt->second.priorityIt.value());
                 queueInfoIt->second.priorityIt.reset();
+                UpdateLinkSortedQueues(ac, *queueInfoIt);
             }
         }
     }
@@ -747,6 +945,7 @@ WifiMacQueueSchedulerImpl<Priority, Compare>::NotifyRemove(AcIndex ac,
             {
                 m_perAcInfo[ac].sortedQueues.erase(queueInfoIt->second.priorityIt.value());
                 queueInfoIt->second.priorityIt.reset();
+                UpdateLinkSortedQueues(ac, *queueInfoIt);
             }
         }
     }
@@ -88,6 +88,9 @@ typedef std::unordered_map<uint16_t /* staId */, Ptr<WifiPsdu> /* PSDU */> WifiP
 class WifiMac : public Object
 {
   public:
+    /// Allow the static setup helper to establish Block Ack agreements
+    friend class WifiStaticSetupHelper;
+
     /**
      * \brief Get the type ID.
      * \return the object TypeId
@@ -37,6 +37,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <unordered_map>
 
 #undef NS_LOG_APPEND_CONTEXT
 #define NS_LOG_APPEND_CONTEXT                                                                      \
@@ -202,6 +203,23 @@ WifiPhy::GetTypeId()
                 DoubleValue(7),
                 MakeDoubleAccessor(&WifiPhy::SetRxNoiseFigure),
                 MakeDoubleChecker<dB_u>())
+            .AddAttribute(
+                "BackgroundInterferenceThreshold",
+                "Signals whose received power (dBm) is below this threshold are not handled as "
+                "individual events, but their energy is added to a per-band background "
+                "interference term that is averaged over BackgroundInterferenceWindow and "
+                "added to the noise. Such signals do not contribute to the CCA. The default "
+                "value (-200 dBm), below the power of any received signal, disables the "
+                "background interference.",
+                DoubleValue(-200.0),
+                MakeDoubleAccessor(&WifiPhy::m_backgroundInterferenceThreshold),
+                MakeDoubleChecker<dBm_u>())
+            .AddAttribute("BackgroundInterferenceWindow",
+                          "The duration of the window over which the power of the background "
+                          "interference is averaged.",
+                          TimeValue(MilliSeconds(1)),
+                          MakeTimeAccessor(&WifiPhy::SetBackgroundInterferenceWindow),
+                          MakeTimeChecker(Time{1}))
             .AddAttribute("State",
                           "The state of the PHY layer.",
                           PointerValue(),
@@ -553,6 +571,17 @@ WifiPhy::SetRxNoiseFigure(dB_u noiseFigure)
     m_noiseFigure = noiseFigure;
 }
 
+void
+WifiPhy::SetBackgroundInterferenceWindow(Time window)
+{
+    NS_LOG_FUNCTION(this << window);
+    if (m_interference)
+    {
+        m_interference->SetBackgroundInterferenceWindow(window);
+    }
+    m_backgroundInterferenceWindow = window;
+}
+
 void
 WifiPhy::SetTxPowerStart(dBm_u start)
 {
@@ -675,6 +704,7 @@ WifiPhy::SetInterferenceHelper(const Ptr<InterferenceHelper> helper)
     m_interference = helper;
     m_interference->SetNoiseFigure(DbToRatio(m_noiseFigure));
     m_interference->SetNumberOfReceiveAntennas(m_numberOfAntennas);
+    m_interference->SetBackgroundInterferenceWindow(m_backgroundInterferenceWindow);
 }
 
 void
@@ -1568,18 +1598,287 @@ WifiPhy::CalculatePhyPreambleAndHeaderDuration(const WifiTxVector& txVector)
         ->CalculatePhyPreambleAndHeaderDuration(txVector);
 }
 
+namespace
+{
+
+/**
+ * The parameters determining the TX duration of a non-MU PPDU
+ */
+struct TxDurationCacheKey
+{
+    uint32_t size;                         //!< PSDU size in bytes
+    WifiPhyBand band;                      //!< frequency band
+    uint32_t modeUid;                      //!< UID of the mode
+    WifiPreamble preamble;                 //!< preamble type
+    uint16_t channelWidth;                 //!< channel width in MHz
+    int64_t guardInterval;                 //!< guard interval in nanoseconds
+    uint8_t nTx;                           //!< number of TX antennas
+    uint8_t nss;                           //!< number of spatial streams
+    uint8_t ness;                          //!< number of extension spatial streams
+    bool stbc;                             //!< whether STBC is used
+    bool ldpc;                             //!< whether LDPC is used
+    bool sigBCompression;                  //!< whether SIG-B compression is used
+    uint8_t ehtPpduType;                   //!< EHT PPDU type
+    std::vector<bool> inactiveSubchannels; //!< bitmap of punctured subchannels
+    RuAllocation ruAllocation;             //!< RU allocation (EHT SU PPDUs)
+
+    /// \return whether this key is equal to the given one
+    bool operator==(const TxDurationCacheKey&) const = default;
+};
+
+/**
+ * The arguments of a TX duration computation, used to look up the cache without
+ * building (and copying the vectors of) a TxDurationCacheKey
+ */
+struct TxDurationCacheLookup
+{
+    uint32_t size;                //!< PSDU size in bytes
+    WifiPhyBand band;             //!< frequency band
+    const WifiTxVector& txVector; //!< the TX vector
+
+    /// \return the key storing the parameters of this lookup
+    TxDurationCacheKey ToKey() const
+    {
+        return {size,
+                band,
+                txVector.GetMode().GetUid(),
+                txVector.GetPreambleType(),
+                static_cast<uint16_t>(txVector.GetChannelWidth()),
+                txVector.GetGuardInterval().GetNanoSeconds(),
+                txVector.GetNTx(),
+                txVector.GetNss(),
+                txVector.GetNess(),
+                txVector.IsStbc(),
+                txVector.IsLdpc(),
+                txVector.IsSigBCompression(),
+                txVector.GetEhtPpduType(),
+                txVector.GetInactiveSubchannels(),
+                IsEht(txVector.GetPreambleType()) ? txVector.GetRuAllocation(0) : RuAllocation{}};
+    }
+};
+
+/**
+ * Hash function for TxDurationCacheKey, which also accepts a TxDurationCacheLookup
+ */
+struct TxDurationCacheKeyHash
+{
+    using is_transparent = void; //!< enable the lookup by TxDurationCacheLookup
+
+    /**
+     * \param key the key
+     * \return the hash of the key
+     */
+    std::size_t operator()(const TxDurationCacheKey& key) const
+    {
+        return Hash(key.size,
+                    key.band,
+                    key.modeUid,
+                    key.preamble,
+                    key.channelWidth,
+                    key.guardInterval,
+                    key.nTx,
+                    key.nss,
+                    key.ness,
+                    key.stbc,
+                    key.ldpc,
+                    key.sigBCompression,
+                    key.ehtPpduType);
+    }
+
+    /**
+     * \param lookup the lookup arguments
+     * \return the hash of the key built from the lookup arguments
+     */
+    std::size_t operator()(const TxDurationCacheLookup& lookup) const
+    {
+        const auto& txVector = lookup.txVector;
+        return Hash(lookup.size,
+                    lookup.band,
+                    txVector.GetMode().GetUid(),
+                    txVector.GetPreambleType(),
+                    static_cast<uint16_t>(txVector.GetChannelWidth()),
+                    txVector.GetGuardInterval().GetNanoSeconds(),
+                    txVector.GetNTx(),
+                    txVector.GetNss(),
+                    txVector.GetNess(),
+                    txVector.IsStbc(),
+                    txVector.IsLdpc(),
+                    txVector.IsSigBCompression(),
+                    txVector.GetEhtPpduType());
+    }
+
+  private:
+    /**
+     * Combine the scalar parameters of a key into a hash value
+     * \param size the PSDU size in bytes
+     * \param band the frequency band
+     * \param modeUid the UID of the mode
+     * \param preamble the preamble type
+     * \param channelWidth the channel width in MHz
+     * \param guardInterval the guard interval in nanoseconds
+     * \param nTx the number of TX antennas
+     * \param nss the number of spatial streams
+     * \param ness the number of extension spatial streams
+     * \param stbc whether STBC is used
+     * \param ldpc whether LDPC is used
+     * \param sigBCompression whether SIG-B compression is used
+     * \param ehtPpduType the EHT PPDU type
+     * \return the hash value
+     */
+    static std::size_t Hash(uint32_t size,
+                            WifiPhyBand band,
+                            uint32_t modeUid,
+                            WifiPreamble preamble,
+                            uint16_t channelWidth,
+                            int64_t guardInterval,
+                            uint8_t nTx,
+                            uint8_t nss,
+                            uint8_t ness,
+                            bool stbc,
+                            bool ldpc,
+                            bool sigBCompression,
+                            uint8_t ehtPpduType)
+    {
+        std::size_t hash = std::hash<uint32_t>{}(size);
+        auto combine = [&hash](std::size_t value) {
+            hash ^= value + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2);
+        };
+        combine(modeUid);
+        combine(preamble);
+        combine(channelWidth);
+        combine(std::hash<int64_t>{}(guardInterval));
+        combine(band);
+        combine((nTx << 16) | (nss << 8) | ness);
+        combine((sigBCompression << 10) | (stbc << 9) | (ldpc << 8) | ehtPpduType);
+        return hash;
+    }
+};
+
+/**
+ * Equality of TxDurationCacheKeys, which also compares a key with a TxDurationCacheLookup
+ */
+struct TxDurationCacheKeyEqual
+{
+    using is_transparent = void; //!< enable the lookup by TxDurationCacheLookup
+
+    /**
+     * \param lhs the first key
+     * \param rhs the second key
+     * \return whether the keys are equal
+     */
+    bool operator()(const TxDurationCacheKey& lhs, const TxDurationCacheKey& rhs) const
+    {
+        return lhs == rhs;
+    }
+
+    /**
+     * \param key the key
+     * \param lookup the lookup arguments
+     * \return whether the key stores the parameters of the lookup
+     */
+    bool operator()(const TxDurationCacheKey& key, const TxDurationCacheLookup& lookup) const
+    {
+        const auto& txVector = lookup.txVector;
+        return key.size == lookup.size && key.band == lookup.band &&
+               key.modeUid == txVector.GetMode().GetUid() &&
+               key.preamble == txVector.GetPreambleType() &&
+               key.channelWidth == static_cast<uint16_t>(txVector.GetChannelWidth()) &&
+               key.guardInterval == txVector.GetGuardInterval().GetNanoSeconds() &&
+               key.nTx == txVector.GetNTx() && key.nss == txVector.GetNss() &&
+               key.ness == txVector.GetNess() && key.stbc == txVector.IsStbc() &&
+               key.ldpc == txVector.IsLdpc() &&
+               key.sigBCompression == txVector.IsSigBCompression() &&
+               key.ehtPpduType == txVector.GetEhtPpduType() &&
+               key.inactiveSubchannels == txVector.GetInactiveSubchannels() &&
+               (IsEht(key.preamble) ? key.ruAllocation == txVector.GetRuAllocation(0)
+                                    : key.ruAllocation.empty());
+    }
+
+    /**
+     * \param lookup the lookup arguments
+     * \param key the key
+     * \return whether the key stores the parameters of the lookup
+     */
+    bool operator()(const TxDurationCacheLookup& lookup, const TxDurationCacheKey& key) const
+    {
+        return (*this)(key, lookup);
+    }
+};
+
+/// Maximum number of entries of the cache of TX durations
+constexpr std::size_t TX_DURATION_CACHE_MAX_SIZE = 1 << 16;
+
+/**
+ * The cache of TX durations and its statistics
+ */
+struct TxDurationCache
+{
+    std::unordered_map<TxDurationCacheKey, Time, TxDurationCacheKeyHash, TxDurationCacheKeyEqual>
+        entries;                         //!< the cached TX durations
+    WifiPhy::TxDurationCacheStats stats; //!< the statistics of the cache
+};
+
+/**
+ * \return the cache of TX durations
+ */
+TxDurationCache&
+GetTxDurationCache()
+{
+    static TxDurationCache cache;
+    return cache;
+}
+
+} // namespace
+
 Time
 WifiPhy::CalculateTxDuration(uint32_t size,
                              const WifiTxVector& txVector,
                              WifiPhyBand band,
                              uint16_t staId)
 {
+    // the duration of MU PPDUs depends on the per-user information; these are not cached
+    const bool cacheable = !txVector.IsMu();
+    auto& cache = GetTxDurationCache();
+    const TxDurationCacheLookup lookup{size, band, txVector};
+    if (cacheable)
+    {
+        if (auto it = cache.entries.find(lookup); it != cache.entries.end())
+        {
+            ++cache.stats.hits;
+            return it->second;
+        }
+    }
+
     Time duration = CalculatePhyPreambleAndHeaderDuration(txVector) +
                     GetPayloadDuration(size, txVector, band, NORMAL_MPDU, staId);
     NS_ASSERT(duration.IsStrictlyPositive());
+
+    if (cacheable)
+    {
+        ++cache.stats.misses;
+        if (cache.entries.size() >= TX_DURATION_CACHE_MAX_SIZE)
+        {
+            cache.entries.clear();
+        }
+        cache.entries.emplace(lookup.ToKey(), duration);
+    }
     return duration;
 }
 
+WifiPhy::TxDurationCacheStats
+WifiPhy::GetTxDurationCacheStats()
+{
+    auto stats = GetTxDurationCache().stats;
+    stats.size = GetTxDurationCache().entries.size();
+    return stats;
+}
+
+void
+WifiPhy::ResetTxDurationCache()
+{
+    GetTxDurationCache() = TxDurationCache{};
+}
+
 Time
 WifiPhy::CalculateTxDuration(Ptr<const WifiPsdu> psdu,
                              const WifiTxVector& txVector,
@@ -1959,12 +2258,41 @@ WifiPhy::Reset()
     m_endTxEvent.Cancel();
 }
 
+bool
+WifiPhy::MaybeAddBackgroundInterference(const RxPowerWattPerChannelBand& rxPowersW,
+                                        Time rxDuration)
+{
+    NS_LOG_FUNCTION(this << rxDuration);
+    if (rxPowersW.empty())
+    {
+        return false;
+    }
+    const auto maxRxPower = std::max_element(rxPowersW.cbegin(),
+                                             rxPowersW.cend(),
+                                             [](const auto& p1, const auto& p2) {
+                                                 return p1.second < p2.second;
+                                             })
+                                ->second;
+    if (maxRxPower >= DbmToW(m_backgroundInterferenceThreshold))
+    {
+        return false;
+    }
+    NS_LOG_DEBUG("Received power (" << maxRxPower
+                                    << "W) below the background interference threshold");
+    m_interference->AddBackgroundInterference(rxDuration, rxPowersW);
+    return true;
+}
+
 void
 WifiPhy::StartReceivePreamble(Ptr<const WifiPpdu> ppdu,
                               RxPowerWattPerChannelBand& rxPowersW,
                               Time rxDuration)
 {
     NS_LOG_FUNCTION(this << ppdu << rxDuration);
+    if (MaybeAddBackgroundInterference(rxPowersW, rxDuration))
+    {
+        return;
+    }
     WifiModulationClass modulation = ppdu->GetModulation();
     NS_ASSERT(m_maxModClassSupported != WIFI_MOD_CLASS_UNKNOWN);
     if (auto it = m_phyEntities.find(modulation);
@@ -2210,6 +2538,13 @@ WifiPhy::NotifyCcaBusy(const Ptr<const WifiPpdu> ppdu, Time duration)
     GetLatestPhyEntity()->NotifyCcaBusy(ppdu, duration, WIFI_CHANLIST_PRIMARY);
 }
 
+void
+WifiPhy::NotifyRxPayloadBegin(const WifiTxVector& txVector, Time payloadDuration)
+{
+    NS_LOG_FUNCTION(this << txVector << payloadDuration);
+    m_phyRxPayloadBeginTrace(txVector, payloadDuration);
+}
+
 void
 WifiPhy::AbortCurrentReception(WifiPhyRxfailureReason reason)
 {
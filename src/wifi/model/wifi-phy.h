@@ -109,9 +109,9 @@ class WifiPhy : public Object
      * \param rxPowersW the receive power in W per band
      * \param rxDuration the duration of the PPDU
      */
-    void StartReceivePreamble(Ptr<const WifiPpdu> ppdu,
-                              RxPowerWattPerChannelBand& rxPowersW,
-                              Time rxDuration);
+    virtual void StartReceivePreamble(Ptr<const WifiPpdu> ppdu,
+                                      RxPowerWattPerChannelBand& rxPowersW,
+                                      Time rxDuration);
 
     /**
      * \return whether the PHY is busy decoding the PHY header fields of a PPDU
@@ -242,6 +242,29 @@ class WifiPhy : public Object
                                     const WifiTxVector& txVector,
                                     WifiPhyBand band,
                                     uint16_t staId = SU_STA_ID);
+
+    /**
+     * Statistics of the cache storing the TX durations of non-MU PPDUs, which are computed
+     * by CalculateTxDuration once for every combination of PSDU size, band and TXVECTOR
+     * parameters affecting the duration.
+     */
+    struct TxDurationCacheStats
+    {
+        uint64_t hits{0};    //!< number of TX durations found in the cache
+        uint64_t misses{0};  //!< number of TX durations computed and inserted in the cache
+        std::size_t size{0}; //!< number of entries currently in the cache
+    };
+
+    /**
+     * \return the statistics of the cache of TX durations
+     */
+    static TxDurationCacheStats GetTxDurationCacheStats();
+
+    /**
+     * Clear the cache of TX durations and reset its statistics.
+     */
+    static void ResetTxDurationCache();
+
     /**
      * This function is a wrapper for the CalculateTxDuration variant that accepts a
      * WifiConstPsduMap as first argument. This function inserts the given PSDU in a
@@ -819,6 +842,13 @@ class WifiPhy : public Object
      * \param noiseFigure noise figure
      */
     void SetRxNoiseFigure(dB_u noiseFigure);
+    /**
+     * Sets the duration of the window over which the power of the background interference
+     * (i.e., the signals received below the BackgroundInterferenceThreshold) is averaged.
+     *
+     * \param window the averaging window
+     */
+    void SetBackgroundInterferenceWindow(Time window);
     /**
      * Sets the minimum available transmission power level.
      *
@@ -1304,6 +1334,27 @@ class WifiPhy : public Object
      */
     void NotifyCcaBusy(const Ptr<const WifiPpdu> ppdu, Time duration);
 
+    /**
+     * Fire the PhyRxPayloadBegin trace source, which is the equivalent of the
+     * PHY-RXSTART.indication primitive.
+     *
+     * \param txVector the TXVECTOR of the PPDU whose payload is being received
+     * \param payloadDuration the duration of the payload
+     */
+    void NotifyRxPayloadBegin(const WifiTxVector& txVector, Time payloadDuration);
+
+    /**
+     * Add an incoming signal to the background interference if its received power is below
+     * the BackgroundInterferenceThreshold on every band.
+     *
+     * \param rxPowersW the received power per band
+     * \param rxDuration the duration of the signal
+     * \return true if the signal has been added to the background interference, in which
+     *         case it must not be handled any further
+     */
+    bool MaybeAddBackgroundInterference(const RxPowerWattPerChannelBand& rxPowersW,
+                                        Time rxDuration);
+
     /**
      * Add the PHY entity to the map of supported PHY entities for the
      * given modulation class for the WifiPhy instance.
@@ -1618,6 +1669,10 @@ class WifiPhy : public Object
 
     dB_u m_noiseFigure; //!< The noise figure
 
+    dBm_u m_backgroundInterferenceThreshold; //!< threshold below which received signals are
+                                             //!< added to the background interference
+    Time m_backgroundInterferenceWindow; //!< averaging window of the background interference
+
     Time m_channelSwitchDelay; //!< Time required to switch between channel
 
     Ptr<WifiNetDevice> m_device;   //!< Pointer to the device
@@ -18,6 +18,7 @@
 #include "wifi-tx-parameters.h"
 
 #include "ns3/boolean.h"
+#include "ns3/buffer.h"
 #include "ns3/eht-configuration.h"
 #include "ns3/enum.h"
 #include "ns3/erp-ofdm-phy.h"
@@ -1452,6 +1453,37 @@ WifiRemoteStationManager::Lookup(Mac48Address address) const
     return station;
 }
 
+template <class T>
+Ptr<const T>
+WifiRemoteStationManager::GetSharedCapabilities(const T& capabilities)
+{
+    NS_LOG_FUNCTION(this);
+
+    // the shared copies are indexed by their serialization, which determines their equality
+    Buffer buffer;
+    buffer.AddAtEnd(capabilities.GetSerializedSize());
+    capabilities.Serialize(buffer.Begin());
+    std::string key(reinterpret_cast<const char*>(buffer.PeekData()), buffer.GetSize());
+
+    if (auto it = m_sharedCapabilities.find(key); it != m_sharedCapabilities.end())
+    {
+        return StaticCast<const T>(it->second);
+    }
+
+    if (m_sharedCapabilities.size() >= m_sharedCapabilitiesPruneSize)
+    {
+        // drop the copies that are no longer referenced by the state of any station
+        std::erase_if(m_sharedCapabilities,
+                      [](const auto& item) { return item.second->GetReferenceCount() == 1; });
+        m_sharedCapabilitiesPruneSize =
+            std::max<std::size_t>(2 * m_sharedCapabilities.size(), SHARED_CAPABILITIES_MIN_PRUNE);
+    }
+
+    auto shared = Create<const T>(capabilities);
+    m_sharedCapabilities.emplace(std::move(key), shared);
+    return shared;
+}
+
 void
 WifiRemoteStationManager::SetAssociationId(Mac48Address remoteAddress, uint16_t aid)
 {
@@ -1495,7 +1527,7 @@ WifiRemoteStationManager::AddStationHtCapabilities(Mac48Address from, HtCapabili
             AddSupportedMcs(from, mcs);
         }
     }
-    state->m_htCapabilities = Create<const HtCapabilities>(htCapabilities);
+    state->m_htCapabilities = GetSharedCapabilities(htCapabilities);
 }
 
 void
@@ -1523,7 +1555,7 @@ WifiRemoteStationManager::AddStationVhtCapabilities(Mac48Address from,
             }
         }
     }
-    state->m_vhtCapabilities = Create<const VhtCapabilities>(vhtCapabilities);
+    state->m_vhtCapabilities = GetSharedCapabilities(vhtCapabilities);
 }
 
 void
@@ -1572,7 +1604,7 @@ WifiRemoteStationManager::AddStationHeCapabilities(Mac48Address from, HeCapabili
             AddSupportedMcs(from, mcs);
         }
     }
-    state->m_heCapabilities = Create<const HeCapabilities>(heCapabilities);
+    state->m_heCapabilities = GetSharedCapabilities(heCapabilities);
     SetQosSupport(from, true);
 }
 
@@ -1584,7 +1616,7 @@ WifiRemoteStationManager::AddStationHe6GhzCapabilities(
     // Used by all stations to record HE 6GHz band capabilities of remote stations
     NS_LOG_FUNCTION(this << from << he6GhzCapabilities);
     auto state = LookupState(from);
-    state->m_he6GhzBandCapabilities = Create<const He6GhzBandCapabilities>(he6GhzCapabilities);
+    state->m_he6GhzBandCapabilities = GetSharedCapabilities(he6GhzCapabilities);
     SetQosSupport(from, true);
 }
 
@@ -1606,7 +1638,7 @@ WifiRemoteStationManager::AddStationEhtCapabilities(Mac48Address from,
             }
         }
     }
-    state->m_ehtCapabilities = Create<const EhtCapabilities>(ehtCapabilities);
+    state->m_ehtCapabilities = GetSharedCapabilities(ehtCapabilities);
     SetQosSupport(from, true);
 }
 
@@ -1743,6 +1775,8 @@ WifiRemoteStationManager::Reset()
 {
     NS_LOG_FUNCTION(this);
     m_states.clear();
+    m_sharedCapabilities.clear();
+    m_sharedCapabilitiesPruneSize = SHARED_CAPABILITIES_MIN_PRUNE;
     for (auto& state : m_stations)
     {
         delete (state.second);
@@ -28,7 +28,9 @@
 #include <array>
 #include <memory>
 #include <optional>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -1448,6 +1450,21 @@ class WifiRemoteStationManager : public Object
      */
     WifiRemoteStation* Lookup(Mac48Address address) const;
 
+    /**
+     * Return a pointer to a copy of the given capabilities. Remote stations advertising
+     * identical capabilities share the same copy, so as to reduce the memory used by the
+     * state of each remote station in large BSSs. The copies are indexed by their
+     * serialization, and those no longer used by any remote station are released when
+     * the number of copies doubles.
+     *
+     * \tparam T \type{HtCapabilities}, \type{VhtCapabilities}, \type{HeCapabilities},
+     *           \type{He6GhzBandCapabilities} or \type{EhtCapabilities}
+     * \param capabilities the capabilities advertised by a remote station
+     * \return a pointer to the shared copy of the given capabilities
+     */
+    template <class T>
+    Ptr<const T> GetSharedCapabilities(const T& capabilities);
+
     /**
      * Actually sets the fragmentation threshold, it also checks the validity of
      * the given threshold.
@@ -1501,6 +1518,14 @@ class WifiRemoteStationManager : public Object
 
     StationStates m_states; //!< States of known stations
     Stations m_stations;    //!< Information for each known stations
+    std::unordered_map<std::string, Ptr<const WifiInformationElement>>
+        m_sharedCapabilities; //!< capabilities shared by the states of the known stations,
+                              //!< indexed by their serialization
+    /// minimum number of shared capabilities triggering the removal of the unused ones
+    static constexpr std::size_t SHARED_CAPABILITIES_MIN_PRUNE = 16;
+    std::size_t m_sharedCapabilitiesPruneSize{
+        SHARED_CAPABILITIES_MIN_PRUNE}; //!< number of shared capabilities triggering the
+                                        //!< removal of the unused ones
 
     uint32_t m_maxSsrc;                //!< Maximum STA short retry count (SSRC)
     uint32_t m_maxSlrc;                //!< Maximum STA long retry count (SLRC)
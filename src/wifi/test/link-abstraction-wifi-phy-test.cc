@@ -0,0 +1,430 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/double.h"
+#include "ns3/interference-helper.h"
+#include "ns3/link-abstraction-wifi-phy.h"
+#include "ns3/log.h"
+#include "ns3/nist-error-rate-model.h"
+#include "ns3/node.h"
+#include "ns3/ofdm-phy.h"
+#include "ns3/ofdm-ppdu.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include "ns3/wifi-mac-header.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/wifi-phy-state-helper.h"
+#include "ns3/wifi-psdu.h"
+#include "ns3/wifi-utils.h"
+#include "ns3/yans-wifi-phy.h"
+
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LinkAbstractionWifiPhyTest");
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Base class of the LinkAbstractionWifiPhy tests
+ *
+ * PPDUs are passed directly to the PHY under test, as done by the YansWifiChannel.
+ */
+class LinkAbstractionWifiPhyTestBase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param name the test name
+     */
+    LinkAbstractionWifiPhyTestBase(std::string name);
+
+  protected:
+    void DoTeardown() override;
+
+    /**
+     * Create the PHY under test and reset the counters.
+     *
+     * \param typeId the TypeId of the PHY
+     */
+    void CreatePhy(const std::string& typeId);
+
+    /**
+     * Make the PHY under test receive a 1000-byte PPDU.
+     *
+     * \param mode the mode used to transmit the PPDU
+     * \param rxPowerDbm the received power (dBm)
+     */
+    void Receive(WifiMode mode, dBm_u rxPowerDbm);
+
+    /**
+     * PHY receive success callback
+     *
+     * \param psdu the PSDU
+     * \param rxSignalInfo the info on the received signal
+     * \param txVector the transmit vector
+     * \param statusPerMpdu reception status per MPDU
+     */
+    void RxSuccess(Ptr<const WifiPsdu> psdu,
+                   RxSignalInfo rxSignalInfo,
+                   WifiTxVector txVector,
+                   std::vector<bool> statusPerMpdu);
+
+    /**
+     * PHY receive failure callback
+     *
+     * \param psdu the PSDU
+     */
+    void RxFailure(Ptr<const WifiPsdu> psdu);
+
+    Ptr<YansWifiPhy> m_phy; ///< the PHY under test
+    uint32_t m_rxSuccess;   ///< number of successfully received PSDUs
+    uint32_t m_rxFailure;   ///< number of PSDUs received with errors
+    uint64_t m_uid;         ///< the UID of the next PPDU
+};
+
+LinkAbstractionWifiPhyTestBase::LinkAbstractionWifiPhyTestBase(std::string name)
+    : TestCase(name),
+      m_rxSuccess(0),
+      m_rxFailure(0),
+      m_uid(0)
+{
+}
+
+void
+LinkAbstractionWifiPhyTestBase::CreatePhy(const std::string& typeId)
+{
+    if (m_phy)
+    {
+        m_phy->Dispose();
+    }
+    ObjectFactory factory(typeId);
+    auto node = CreateObject<Node>();
+    auto dev = CreateObject<WifiNetDevice>();
+    m_phy = factory.Create<YansWifiPhy>();
+    m_phy->SetInterferenceHelper(CreateObject<InterferenceHelper>());
+    m_phy->SetErrorRateModel(CreateObject<NistErrorRateModel>());
+    m_phy->SetDevice(dev);
+    m_phy->SetOperatingChannel(WifiPhy::ChannelTuple{36, 20, WIFI_PHY_BAND_5GHZ, 0});
+    m_phy->ConfigureStandard(WIFI_STANDARD_80211a);
+    m_phy->SetReceiveOkCallback(MakeCallback(&LinkAbstractionWifiPhyTestBase::RxSuccess, this));
+    m_phy->SetReceiveErrorCallback(MakeCallback(&LinkAbstractionWifiPhyTestBase::RxFailure, this));
+    dev->SetPhy(m_phy);
+    node->AddDevice(dev);
+    m_phy->Initialize();
+    m_rxSuccess = 0;
+    m_rxFailure = 0;
+}
+
+void
+LinkAbstractionWifiPhyTestBase::Receive(WifiMode mode, dBm_u rxPowerDbm)
+{
+    WifiTxVector txVector{mode, 0, WIFI_PREAMBLE_LONG, NanoSeconds(800), 1, 1, 0, 20, false};
+    WifiMacHeader hdr;
+    hdr.SetType(WIFI_MAC_QOSDATA);
+    hdr.SetQosTid(0);
+    auto psdu = Create<WifiPsdu>(Create<Packet>(1000), hdr);
+    auto ppdu = Create<OfdmPpdu>(psdu, txVector, m_phy->GetOperatingChannel(), m_uid++);
+    RxPowerWattPerChannelBand rxPowersW;
+    rxPowersW.insert({{{{0, 0}}, {{0, 0}}}, DbmToW(rxPowerDbm)}); // dummy band, as YANS
+    m_phy->StartReceivePreamble(ppdu, rxPowersW, ppdu->GetTxDuration());
+}
+
+void
+LinkAbstractionWifiPhyTestBase::RxSuccess(Ptr<const WifiPsdu> psdu,
+                                          RxSignalInfo rxSignalInfo,
+                                          WifiTxVector txVector,
+                                          std::vector<bool> statusPerMpdu)
+{
+    NS_LOG_FUNCTION(this << *psdu << rxSignalInfo << txVector);
+    m_rxSuccess++;
+}
+
+void
+LinkAbstractionWifiPhyTestBase::RxFailure(Ptr<const WifiPsdu> psdu)
+{
+    NS_LOG_FUNCTION(this << *psdu);
+    m_rxFailure++;
+}
+
+void
+LinkAbstractionWifiPhyTestBase::DoTeardown()
+{
+    m_phy->Dispose();
+    m_phy = nullptr;
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Compare the packet success rate of LinkAbstractionWifiPhy with the one of YansWifiPhy
+ *
+ * Isolated PPDUs are received at increasing SNRs by both PHYs. In the absence of
+ * interference, both PHYs evaluate the same error rate model at the same SNR, hence the
+ * packet success rates must match up to the accuracy of the lookup tables and the
+ * statistical uncertainty.
+ */
+class LinkAbstractionWifiPhyPsrTest : public LinkAbstractionWifiPhyTestBase
+{
+  public:
+    LinkAbstractionWifiPhyPsrTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Measure the packet success rate of a PHY.
+     *
+     * \param typeId the TypeId of the PHY
+     * \param rxPowerDbm the received power (dBm)
+     * \return the fraction of PPDUs received successfully
+     */
+    double MeasurePsr(const std::string& typeId, dBm_u rxPowerDbm);
+};
+
+LinkAbstractionWifiPhyPsrTest::LinkAbstractionWifiPhyPsrTest()
+    : LinkAbstractionWifiPhyTestBase("Check the packet success rate of LinkAbstractionWifiPhy")
+{
+}
+
+double
+LinkAbstractionWifiPhyPsrTest::MeasurePsr(const std::string& typeId, dBm_u rxPowerDbm)
+{
+    const uint32_t nPpdus = 400;
+    CreatePhy(typeId);
+    m_phy->AssignStreams(1);
+    for (uint32_t i = 0; i < nPpdus; ++i)
+    {
+        Simulator::Schedule(MilliSeconds(i),
+                            &LinkAbstractionWifiPhyPsrTest::Receive,
+                            this,
+                            OfdmPhy::GetOfdmRate54Mbps(),
+                            rxPowerDbm);
+    }
+    Simulator::Run();
+    NS_TEST_EXPECT_MSG_EQ(m_rxSuccess + m_rxFailure, nPpdus, "Some PPDUs have not been received");
+    return static_cast<double>(m_rxSuccess) / nPpdus;
+}
+
+void
+LinkAbstractionWifiPhyPsrTest::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    for (dBm_u rxPowerDbm = -80; rxPowerDbm <= -60; rxPowerDbm += 2)
+    {
+        const auto yans = MeasurePsr("ns3::YansWifiPhy", rxPowerDbm);
+        const auto abstraction = MeasurePsr("ns3::LinkAbstractionWifiPhy", rxPowerDbm);
+        NS_LOG_DEBUG("rxPower=" << rxPowerDbm << "dBm yans=" << yans
+                                << " abstraction=" << abstraction);
+        NS_TEST_EXPECT_MSG_EQ_TOL(abstraction,
+                                  yans,
+                                  0.1,
+                                  "Packet success rate mismatch at " << rxPowerDbm << " dBm");
+    }
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Check the collision model of LinkAbstractionWifiPhy
+ *
+ * Two 6 Mbps PPDUs overlap: the PHY synchronizes on the first one and the second one is
+ * only interference. The first PPDU is received if it is much stronger than the second
+ * one and lost otherwise; the second PPDU is never received (no frame capture).
+ */
+class LinkAbstractionWifiPhyCollisionTest : public LinkAbstractionWifiPhyTestBase
+{
+  public:
+    LinkAbstractionWifiPhyCollisionTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Receive two overlapping PPDUs and check the outcome.
+     *
+     * \param firstPowerDbm the received power of the first PPDU (dBm)
+     * \param secondPowerDbm the received power of the second PPDU (dBm)
+     * \param expectedSuccess the expected number of successfully received PPDUs
+     * \param expectedFailure the expected number of PPDUs received with errors
+     */
+    void CheckCollision(dBm_u firstPowerDbm,
+                        dBm_u secondPowerDbm,
+                        uint32_t expectedSuccess,
+                        uint32_t expectedFailure);
+};
+
+LinkAbstractionWifiPhyCollisionTest::LinkAbstractionWifiPhyCollisionTest()
+    : LinkAbstractionWifiPhyTestBase("Check the collision model of LinkAbstractionWifiPhy")
+{
+}
+
+void
+LinkAbstractionWifiPhyCollisionTest::CheckCollision(dBm_u firstPowerDbm,
+                                                    dBm_u secondPowerDbm,
+                                                    uint32_t expectedSuccess,
+                                                    uint32_t expectedFailure)
+{
+    CreatePhy("ns3::LinkAbstractionWifiPhy");
+    Simulator::Schedule(MicroSeconds(100),
+                        &LinkAbstractionWifiPhyCollisionTest::Receive,
+                        this,
+                        OfdmPhy::GetOfdmRate6Mbps(),
+                        firstPowerDbm);
+    Simulator::Schedule(MicroSeconds(200),
+                        &LinkAbstractionWifiPhyCollisionTest::Receive,
+                        this,
+                        OfdmPhy::GetOfdmRate6Mbps(),
+                        secondPowerDbm);
+    Simulator::Run();
+    NS_TEST_EXPECT_MSG_EQ(m_rxSuccess,
+                          expectedSuccess,
+                          "Unexpected number of successful receptions (" << firstPowerDbm << ", "
+                                                                         << secondPowerDbm << ")");
+    NS_TEST_EXPECT_MSG_EQ(m_rxFailure,
+                          expectedFailure,
+                          "Unexpected number of failed receptions (" << firstPowerDbm << ", "
+                                                                     << secondPowerDbm << ")");
+}
+
+void
+LinkAbstractionWifiPhyCollisionTest::DoRun()
+{
+    // strong first PPDU: it is received despite the interference
+    CheckCollision(-50, -80, 1, 0);
+    // PPDUs of equal power: the SINR of the first one is about 0 dB
+    CheckCollision(-60, -60, 0, 1);
+    // strong second PPDU: the first one is lost and the second one is not captured
+    CheckCollision(-80, -50, 0, 1);
+    // the first PPDU is below the noise floor: the PHY synchronizes on the second one
+    CheckCollision(-98, -60, 1, 0);
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Check that LinkAbstractionWifiPhy handles the background interference
+ *
+ * A weak 6 Mbps PPDU, received below the BackgroundInterferenceThreshold, is added to the
+ * background interference: it is neither received nor does it make the CCA busy. Its power,
+ * averaged over the first window, is about 10 dB below the one of a 54 Mbps PPDU received
+ * in the second window, which is therefore lost. The same PPDU is received successfully
+ * once the background interference has vanished.
+ */
+class LinkAbstractionWifiPhyBackgroundTest : public LinkAbstractionWifiPhyTestBase
+{
+  public:
+    LinkAbstractionWifiPhyBackgroundTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check the state of the PHY and the number of received PSDUs.
+     *
+     * \param expectedState the expected state of the PHY
+     * \param expectedSuccess the expected number of successfully received PSDUs
+     * \param expectedFailure the expected number of PSDUs received with errors
+     */
+    void CheckRx(WifiPhyState expectedState, uint32_t expectedSuccess, uint32_t expectedFailure);
+};
+
+LinkAbstractionWifiPhyBackgroundTest::LinkAbstractionWifiPhyBackgroundTest()
+    : LinkAbstractionWifiPhyTestBase(
+          "Check the background interference handling of LinkAbstractionWifiPhy")
+{
+}
+
+void
+LinkAbstractionWifiPhyBackgroundTest::CheckRx(WifiPhyState expectedState,
+                                              uint32_t expectedSuccess,
+                                              uint32_t expectedFailure)
+{
+    NS_TEST_EXPECT_MSG_EQ(m_phy->GetState()->GetState(),
+                          expectedState,
+                          "Unexpected PHY state at " << Simulator::Now().As(Time::US));
+    NS_TEST_EXPECT_MSG_EQ(m_rxSuccess,
+                          expectedSuccess,
+                          "Unexpected number of successful receptions at "
+                              << Simulator::Now().As(Time::US));
+    NS_TEST_EXPECT_MSG_EQ(m_rxFailure,
+                          expectedFailure,
+                          "Unexpected number of failed receptions at "
+                              << Simulator::Now().As(Time::US));
+}
+
+void
+LinkAbstractionWifiPhyBackgroundTest::DoRun()
+{
+    CreatePhy("ns3::LinkAbstractionWifiPhy");
+    m_phy->SetAttribute("BackgroundInterferenceThreshold", DoubleValue(-70));
+
+    Simulator::Schedule(MicroSeconds(100),
+                        &LinkAbstractionWifiPhyBackgroundTest::Receive,
+                        this,
+                        OfdmPhy::GetOfdmRate6Mbps(),
+                        -72);
+    Simulator::Schedule(MicroSeconds(200),
+                        &LinkAbstractionWifiPhyBackgroundTest::CheckRx,
+                        this,
+                        WifiPhyState::IDLE,
+                        0,
+                        0);
+    Simulator::Schedule(MicroSeconds(1500),
+                        &LinkAbstractionWifiPhyBackgroundTest::Receive,
+                        this,
+                        OfdmPhy::GetOfdmRate54Mbps(),
+                        -60);
+    Simulator::Schedule(MicroSeconds(2000),
+                        &LinkAbstractionWifiPhyBackgroundTest::CheckRx,
+                        this,
+                        WifiPhyState::IDLE,
+                        0,
+                        1);
+    Simulator::Schedule(MicroSeconds(3500),
+                        &LinkAbstractionWifiPhyBackgroundTest::Receive,
+                        this,
+                        OfdmPhy::GetOfdmRate54Mbps(),
+                        -60);
+    Simulator::Schedule(MicroSeconds(4000),
+                        &LinkAbstractionWifiPhyBackgroundTest::CheckRx,
+                        this,
+                        WifiPhyState::IDLE,
+                        1,
+                        1);
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief LinkAbstractionWifiPhy Test Suite
+ */
+class LinkAbstractionWifiPhyTestSuite : public TestSuite
+{
+  public:
+    LinkAbstractionWifiPhyTestSuite();
+};
+
+LinkAbstractionWifiPhyTestSuite::LinkAbstractionWifiPhyTestSuite()
+    : TestSuite("wifi-link-abstraction-phy", Type::UNIT)
+{
+    AddTestCase(new LinkAbstractionWifiPhyPsrTest, TestCase::Duration::QUICK);
+    AddTestCase(new LinkAbstractionWifiPhyCollisionTest, TestCase::Duration::QUICK);
+    AddTestCase(new LinkAbstractionWifiPhyBackgroundTest, TestCase::Duration::QUICK);
+}
+
+static LinkAbstractionWifiPhyTestSuite g_linkAbstractionWifiPhyTestSuite; ///< the test suite
@@ -100,6 +100,19 @@ class ExtInterferenceHelper : public InterferenceHelper
         }
         return false;
     }
+
+    /**
+     * \return the total number of NI changes stored for all the tracked bands
+     */
+    std::size_t GetNumNiChanges() const
+    {
+        std::size_t count = 0;
+        for (const auto& [band, nis] : m_niChanges)
+        {
+            count += nis.size();
+        }
+        return count;
+    }
 };
 
 NS_OBJECT_ENSURE_REGISTERED(ExtInterferenceHelper);
@@ -2771,6 +2784,64 @@ SpectrumWifiPhyInterfacesHelperTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Interference helper pruning test
+ *
+ * This test checks that the NI changes stored by the interference helper do not grow
+ * without bounds when signals keep overlapping while a reception is ongoing.
+ */
+class InterferenceHelperPruningTest : public TestCase
+{
+  public:
+    InterferenceHelperPruningTest();
+
+  private:
+    void DoRun() override;
+};
+
+InterferenceHelperPruningTest::InterferenceHelperPruningTest()
+    : TestCase("Check the pruning of old NI changes in the interference helper")
+{
+}
+
+void
+InterferenceHelperPruningTest::DoRun()
+{
+    auto interferenceHelper = CreateObject<ExtInterferenceHelper>();
+    const WifiSpectrumBandInfo band{{{1, 256}}, {{5170e6, 5190e6}}};
+    interferenceHelper->AddBand(band);
+    interferenceHelper->NotifyRxStart(WHOLE_WIFI_SPECTRUM);
+
+    // 1 ms long signals start every 100 us, hence about 10 signals always overlap
+    const uint32_t nSignals = 1000;
+    for (uint32_t i = 0; i < nSignals; ++i)
+    {
+        Simulator::Schedule(MicroSeconds(100 * i), [=]() {
+            RxPowerWattPerChannelBand rxPower{{band, 1e-10}};
+            interferenceHelper->AddForeignSignal(MilliSeconds(1), rxPower, WHOLE_WIFI_SPECTRUM);
+        });
+    }
+    Simulator::Stop(MicroSeconds(100 * (nSignals - 1)) + NanoSeconds(1));
+    Simulator::Run();
+
+    // Without pruning, there would be two NI changes per signal
+    NS_TEST_EXPECT_MSG_LT(interferenceHelper->GetNumNiChanges(),
+                          100,
+                          "Old NI changes have not been pruned");
+    // 10 overlapping signals are being received: the energy drops below the threshold when
+    // only 4 of them are left, i.e., when the signal started 500 us ago ends
+    NS_TEST_EXPECT_MSG_EQ_TOL(interferenceHelper->GetEnergyDuration(4.5e-10, band),
+                              MicroSeconds(600),
+                              MicroSeconds(1),
+                              "Unexpected duration of the energy above the threshold");
+
+    interferenceHelper->Dispose();
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -2805,6 +2876,7 @@ SpectrumWifiPhyTestSuite::SpectrumWifiPhyTestSuite()
                     SpectrumWifiPhyMultipleInterfacesTest::ChannelSwitchScenario::BETWEEN_TX_RX),
                 TestCase::Duration::QUICK);
     AddTestCase(new SpectrumWifiPhyInterfacesHelperTest, TestCase::Duration::QUICK);
+    AddTestCase(new InterferenceHelperPruningTest, TestCase::Duration::QUICK);
 }
 
 static SpectrumWifiPhyTestSuite spectrumWifiPhyTestSuite; ///< the test suite
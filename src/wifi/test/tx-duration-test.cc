@@ -1925,6 +1925,110 @@ PhyHeaderSectionsTest::DoRun()
     CheckPhyHeaderSections(phyEntity->GetPhyHeaderSections(txVector, ppduStart), sections);
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the cache of TX durations of WifiPhy
+ *
+ * The TX durations returned by WifiPhy::CalculateTxDuration for a range of PSDU sizes and
+ * TXVECTORs are compared with the ones computed by the PHY entities, both when they are
+ * inserted in the cache and when they are found in the cache.
+ */
+class TxDurationCacheTest : public TestCase
+{
+  public:
+    TxDurationCacheTest();
+
+  private:
+    void DoRun() override;
+};
+
+TxDurationCacheTest::TxDurationCacheTest()
+    : TestCase("Check the cache of TX durations")
+{
+}
+
+void
+TxDurationCacheTest::DoRun()
+{
+    WifiPhy::ResetTxDurationCache();
+
+    std::list<WifiTxVector> txVectors;
+    WifiTxVector txVector;
+    txVector.SetMode(OfdmPhy::GetOfdmRate54Mbps());
+    txVector.SetPreambleType(WIFI_PREAMBLE_LONG);
+    txVector.SetChannelWidth(MHz_u{20});
+    txVectors.push_back(txVector);
+    txVector.SetMode(HtPhy::GetHtMcs7());
+    txVector.SetPreambleType(WIFI_PREAMBLE_HT_MF);
+    txVector.SetGuardInterval(NanoSeconds(400));
+    txVectors.push_back(txVector);
+    txVector.SetGuardInterval(NanoSeconds(800));
+    txVector.SetStbc(true);
+    txVectors.push_back(txVector);
+    txVector.SetStbc(false);
+    txVector.SetMode(VhtPhy::GetVhtMcs8());
+    txVector.SetPreambleType(WIFI_PREAMBLE_VHT_SU);
+    txVector.SetChannelWidth(MHz_u{80});
+    txVector.SetNss(2);
+    txVectors.push_back(txVector);
+    txVector.SetMode(HePhy::GetHeMcs11());
+    txVector.SetPreambleType(WIFI_PREAMBLE_HE_SU);
+    txVector.SetGuardInterval(NanoSeconds(3200));
+    txVectors.push_back(txVector);
+    txVector.SetGuardInterval(NanoSeconds(800));
+    txVectors.push_back(txVector);
+    txVector.SetMode(EhtPhy::GetEhtMcs13());
+    txVector.SetPreambleType(WIFI_PREAMBLE_EHT_MU);
+    txVector.SetEhtPpduType(1);
+    txVector.SetChannelWidth(MHz_u{160});
+    txVectors.push_back(txVector);
+
+    const std::list<uint32_t> sizes{14, 1536, 10000, 65535};
+    uint64_t nDurations = 0;
+    for (auto round = 0; round < 2; ++round)
+    {
+        for (const auto& vector : txVectors)
+        {
+            for (const auto size : sizes)
+            {
+                const auto expected =
+                    WifiPhy::CalculatePhyPreambleAndHeaderDuration(vector) +
+                    WifiPhy::GetPayloadDuration(size, vector, WIFI_PHY_BAND_5GHZ);
+                NS_TEST_EXPECT_MSG_EQ(
+                    WifiPhy::CalculateTxDuration(size, vector, WIFI_PHY_BAND_5GHZ),
+                    expected,
+                    "Unexpected TX duration for " << size << " bytes and " << vector);
+                ++nDurations;
+            }
+        }
+        const auto stats = WifiPhy::GetTxDurationCacheStats();
+        NS_TEST_EXPECT_MSG_EQ(stats.misses,
+                              txVectors.size() * sizes.size(),
+                              "Every TX duration should be computed once");
+        NS_TEST_EXPECT_MSG_EQ(stats.hits,
+                              nDurations - stats.misses,
+                              "TX durations should be found in the cache after the first round");
+        NS_TEST_EXPECT_MSG_EQ(stats.size, stats.misses, "Unexpected number of cached entries");
+    }
+
+    // the TX durations of MU PPDUs are not cached
+    WifiTxVector muTxVector;
+    muTxVector.SetPreambleType(WIFI_PREAMBLE_HE_MU);
+    muTxVector.SetChannelWidth(MHz_u{20});
+    muTxVector.SetGuardInterval(NanoSeconds(800));
+    muTxVector.SetHeMuUserInfo(1, {{HeRu::RU_242_TONE, 1, true}, 11, 1});
+    WifiPhy::CalculateTxDuration(1536, muTxVector, WIFI_PHY_BAND_5GHZ, 1);
+    NS_TEST_EXPECT_MSG_EQ(WifiPhy::GetTxDurationCacheStats().size,
+                          txVectors.size() * sizes.size(),
+                          "The TX duration of MU PPDUs should not be cached");
+
+    WifiPhy::ResetTxDurationCache();
+    const auto stats = WifiPhy::GetTxDurationCacheStats();
+    NS_TEST_EXPECT_MSG_EQ(stats.hits + stats.misses + stats.size, 0, "The cache was not reset");
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -1944,6 +2048,8 @@ TxDurationTestSuite::TxDurationTestSuite()
 
     AddTestCase(new PhyHeaderSectionsTest, TestCase::Duration::QUICK);
 
+    AddTestCase(new TxDurationCacheTest, TestCase::Duration::QUICK);
+
     // 20 MHz band, HeSigBDurationTest::OFDMA, even number of users per HE-SIG-B content channel
     AddTestCase(new HeSigBDurationTest(
                     {{{HeRu::RU_106_TONE, 1, true}, 11, 1}, {{HeRu::RU_106_TONE, 2, true}, 10, 4}},
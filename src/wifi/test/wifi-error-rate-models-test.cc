@@ -14,17 +14,21 @@
 #include <gsl/gsl_sf_bessel.h>
 #endif
 
+#include "ns3/boolean.h"
 #include "ns3/dsss-error-rate-model.h"
 #include "ns3/he-phy.h" //includes HT and VHT
 #include "ns3/interference-helper.h"
 #include "ns3/log.h"
 #include "ns3/nist-error-rate-model.h"
+#include "ns3/string.h"
 #include "ns3/table-based-error-rate-model.h"
 #include "ns3/test.h"
 #include "ns3/wifi-phy.h"
 #include "ns3/wifi-utils.h"
 #include "ns3/yans-error-rate-model.h"
 
+#include <fstream>
+
 using namespace ns3;
 
 NS_LOG_COMPONENT_DEFINE("WifiErrorRateModelsTest");
@@ -1025,6 +1029,104 @@ TableBasedErrorRateTestCase::DoRun()
     }
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the lookup tables of the error rate models
+ *
+ * The chunk success rates interpolated from the lookup tables are compared with the ones
+ * computed by the models, for a range of modes, SNR values and chunk sizes. Then, the tables
+ * are saved into a file and loaded by another model, which must return the same values.
+ */
+class ErrorRateLookupTableTestCase : public TestCase
+{
+  public:
+    ErrorRateLookupTableTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check that the model using lookup tables returns the same chunk success rates as the
+     * model computing them, within a tolerance.
+     *
+     * \param model the model computing the chunk success rates
+     * \param lookup the model using lookup tables
+     */
+    void CheckModels(Ptr<ErrorRateModel> model, Ptr<ErrorRateModel> lookup);
+};
+
+ErrorRateLookupTableTestCase::ErrorRateLookupTableTestCase()
+    : TestCase("WifiErrorRateModel lookup tables")
+{
+}
+
+void
+ErrorRateLookupTableTestCase::CheckModels(Ptr<ErrorRateModel> model, Ptr<ErrorRateModel> lookup)
+{
+    for (const auto& mode : {OfdmPhy::GetOfdmRate6Mbps(),
+                             OfdmPhy::GetOfdmRate54Mbps(),
+                             HtPhy::GetHtMcs0(),
+                             VhtPhy::GetVhtMcs8()})
+    {
+        WifiTxVector txVector;
+        txVector.SetMode(mode);
+        for (dB_u snr = -5; snr <= dB_u{35}; snr += dB_u{0.37})
+        {
+            for (uint64_t nbits : {1, 24, 100, 1000, 12000, 65535})
+            {
+                const auto expected =
+                    model->GetChunkSuccessRate(mode, txVector, DbToRatio(snr), nbits);
+                const auto actual =
+                    lookup->GetChunkSuccessRate(mode, txVector, DbToRatio(snr), nbits);
+                NS_TEST_ASSERT_MSG_EQ_TOL(actual,
+                                          expected,
+                                          0.01,
+                                          "Wrong chunk success rate for mode "
+                                              << mode << ", SNR " << snr << " dB and " << nbits
+                                              << " bits");
+            }
+        }
+    }
+}
+
+void
+ErrorRateLookupTableTestCase::DoRun()
+{
+    const auto filename = CreateTempDirFilename("error-rate-lookup-tables.txt");
+
+    auto nist = CreateObject<NistErrorRateModel>();
+    auto nistLookup = CreateObject<NistErrorRateModel>();
+    nistLookup->SetAttribute("UseLookupTable", BooleanValue(true));
+    nistLookup->SetAttribute("LookupTableFile", StringValue(filename));
+    CheckModels(nist, nistLookup);
+
+    auto yans = CreateObject<YansErrorRateModel>();
+    auto yansLookup = CreateObject<YansErrorRateModel>();
+    yansLookup->SetAttribute("UseLookupTable", BooleanValue(true));
+    CheckModels(yans, yansLookup);
+
+    // save the tables and load them into another model
+    const auto mode = HtPhy::GetHtMcs0();
+    WifiTxVector txVector;
+    txVector.SetMode(mode);
+    const auto snr = DbToRatio(dB_u{3.3});
+    const auto expected = nistLookup->GetChunkSuccessRate(mode, txVector, snr, 1234);
+    nistLookup->Dispose();
+    std::ifstream file(filename);
+    NS_TEST_ASSERT_MSG_EQ(file.is_open(), true, "The lookup tables have not been saved");
+
+    auto loaded = CreateObject<NistErrorRateModel>();
+    loaded->SetAttribute("UseLookupTable", BooleanValue(true));
+    loaded->SetAttribute("LookupTableFile", StringValue(filename));
+    NS_TEST_ASSERT_MSG_EQ_TOL(loaded->GetChunkSuccessRate(mode, txVector, snr, 1234),
+                              expected,
+                              1e-12,
+                              "The loaded lookup tables differ from the saved ones");
+    CheckModels(nist, loaded);
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -1043,6 +1145,7 @@ WifiErrorRateModelsTestSuite::WifiErrorRateModelsTestSuite()
     AddTestCase(new WifiErrorRateModelsTestCaseDsss, TestCase::Duration::QUICK);
     AddTestCase(new WifiErrorRateModelsTestCaseNist, TestCase::Duration::QUICK);
     AddTestCase(new WifiErrorRateModelsTestCaseMimo, TestCase::Duration::QUICK);
+    AddTestCase(new ErrorRateLookupTableTestCase, TestCase::Duration::QUICK);
     AddTestCase(new TableBasedErrorRateTestCase("DefaultTableBasedHtMcs0-1458bytes",
                                                 HtPhy::GetHtMcs0(),
                                                 1458),
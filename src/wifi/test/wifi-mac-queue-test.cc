@@ -417,6 +417,268 @@ WifiExtractExpiredMpdusTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the expiry index of the MAC queue container
+ *
+ * This test verifies that the container queues that are skipped by ExtractAllExpiredMpdus
+ * because none of their MPDUs can be extracted yet are scanned again when an MPDU that was
+ * inflight is no longer inflight or when an MPDU is inserted at the head of the queue.
+ */
+class WifiMacQueueExpiryIndexTest : public TestCase
+{
+  public:
+    WifiMacQueueExpiryIndexTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Insert a new MPDU into the container.
+     *
+     * \param rxAddr Receiver Address of the MPDU
+     * \param atHead whether to insert the MPDU at the head of the container queue
+     * \param inflight whether the MPDU is inflight
+     * \param expiryTime the expiry time for the MPDU
+     * \return an iterator to the inserted element
+     */
+    WifiMacQueueContainer::iterator Insert(Mac48Address rxAddr,
+                                           bool atHead,
+                                           bool inflight,
+                                           Time expiryTime);
+
+    /**
+     * Extract all the MPDUs with expired lifetime and check their sequence numbers.
+     *
+     * \param expectedSeqNo the sequence numbers of the MPDUs expected to be extracted
+     */
+    void CheckExtracted(std::set<uint16_t> expectedSeqNo);
+
+    WifiMacQueueContainer m_container; //!< MAC queue container
+    uint16_t m_currentSeqNo{0};        //!< sequence number of current MPDU
+};
+
+WifiMacQueueExpiryIndexTest::WifiMacQueueExpiryIndexTest()
+    : TestCase("Test the expiry index of the MAC queue container")
+{
+}
+
+WifiMacQueueContainer::iterator
+WifiMacQueueExpiryIndexTest::Insert(Mac48Address rxAddr,
+                                    bool atHead,
+                                    bool inflight,
+                                    Time expiryTime)
+{
+    WifiMacHeader header(WIFI_MAC_QOSDATA);
+    header.SetAddr1(rxAddr);
+    header.SetQosTid(0);
+    header.SetSequenceNumber(m_currentSeqNo++);
+    auto mpdu = Create<WifiMpdu>(Create<Packet>(), header);
+
+    const auto& queue = m_container.GetQueue(WifiMacQueueContainer::GetQueueId(mpdu));
+    auto elemIt = m_container.insert(atHead ? queue.cbegin() : queue.cend(), mpdu);
+    elemIt->expiryTime = expiryTime;
+    if (inflight)
+    {
+        elemIt->inflights.emplace(0, mpdu);
+    }
+    elemIt->deleter = [](auto mpdu) {};
+    return elemIt;
+}
+
+void
+WifiMacQueueExpiryIndexTest::CheckExtracted(std::set<uint16_t> expectedSeqNo)
+{
+    auto [first, last] = m_container.ExtractAllExpiredMpdus();
+    std::set<uint16_t> actualSeqNo;
+    std::transform(first, last, std::inserter(actualSeqNo, actualSeqNo.end()), [](auto& elem) {
+        return elem.mpdu->GetHeader().GetSequenceNumber();
+    });
+    NS_TEST_EXPECT_MSG_EQ((actualSeqNo == expectedSeqNo),
+                          true,
+                          "Unexpected MPDUs extracted at " << Simulator::Now().As(Time::MS));
+}
+
+void
+WifiMacQueueExpiryIndexTest::DoRun()
+{
+    auto rxAddr1 = Mac48Address::Allocate();
+    auto rxAddr2 = Mac48Address::Allocate();
+    WifiContainerQueueId queueId1{WIFI_QOSDATA_QUEUE, WIFI_UNICAST, rxAddr1, 0};
+
+    // queue 1: MPDU 0 is inflight and expires at 30ms, MPDU 1 expires at 40ms
+    auto inflightIt = Insert(rxAddr1, false, true, MilliSeconds(30));
+    Insert(rxAddr1, false, false, MilliSeconds(40));
+    // queue 2: MPDU 2 expires at 100ms
+    Insert(rxAddr2, false, false, MilliSeconds(100));
+
+    Simulator::Schedule(MilliSeconds(20), [&]() { CheckExtracted({}); });
+    Simulator::Schedule(MilliSeconds(25), [&]() { inflightIt->inflights.clear(); });
+    // MPDU 0 is no longer inflight and it is expired
+    Simulator::Schedule(MilliSeconds(35), [&]() {
+        CheckExtracted({0});
+        NS_TEST_EXPECT_MSG_EQ(m_container.GetQueue(queueId1).size(),
+                              1,
+                              "Unexpected number of MPDUs in queue 1");
+    });
+    Simulator::Schedule(MilliSeconds(45), [&]() {
+        CheckExtracted({1});
+        NS_TEST_EXPECT_MSG_EQ(m_container.GetNBytes(queueId1), 0, "Queue 1 should be empty");
+    });
+    // MPDU 3, expiring at 60ms, is inserted at the head of queue 2
+    Simulator::Schedule(MilliSeconds(50), [&]() {
+        CheckExtracted({});
+        Insert(rxAddr2, true, false, MilliSeconds(60));
+    });
+    Simulator::Schedule(MilliSeconds(65), [&]() { CheckExtracted({3}); });
+    Simulator::Schedule(MilliSeconds(105), [&]() { CheckExtracted({2}); });
+
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the per-link sorted lists of the MAC queue scheduler
+ *
+ * This test verifies that the sequence of container queues returned by the scheduler for a
+ * given link matches the sequence of all the container queues, sorted by priority, from
+ * which the queues that cannot be sent on that link are filtered out, as queues are blocked,
+ * unblocked, emptied and refilled.
+ */
+class WifiMacQueueSchedulerLinkIndexTest : public TestCase
+{
+  public:
+    WifiMacQueueSchedulerLinkIndexTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Enqueue an MPDU addressed to the given receiver.
+     *
+     * \param rxAddr Receiver Address of the MPDU
+     */
+    void Enqueue(Mac48Address rxAddr);
+
+    /**
+     * Check the sequence of container queues returned by the scheduler for link 0.
+     *
+     * \param expected the expected receivers of the container queues, in order
+     */
+    void CheckQueues(const std::vector<Mac48Address>& expected);
+
+    Ptr<WifiMacQueue> m_queue;               //!< the MAC queue
+    Ptr<FcfsWifiQueueScheduler> m_scheduler; //!< the MAC queue scheduler
+    Mac48Address m_txAddr;                   //!< Transmitter Address of MPDUs
+};
+
+WifiMacQueueSchedulerLinkIndexTest::WifiMacQueueSchedulerLinkIndexTest()
+    : TestCase("Test the per-link sorted lists of the MAC queue scheduler")
+{
+}
+
+void
+WifiMacQueueSchedulerLinkIndexTest::Enqueue(Mac48Address rxAddr)
+{
+    WifiMacHeader header(WIFI_MAC_QOSDATA);
+    header.SetAddr1(rxAddr);
+    header.SetAddr2(m_txAddr);
+    header.SetQosTid(0);
+    m_queue->Enqueue(Create<WifiMpdu>(Create<Packet>(), header));
+}
+
+void
+WifiMacQueueSchedulerLinkIndexTest::CheckQueues(const std::vector<Mac48Address>& expected)
+{
+    // the container queues sorted by priority that can be sent on link 0
+    std::vector<Mac48Address> filtered;
+    for (auto queueId = m_scheduler->GetNext(AC_BE, std::nullopt); queueId.has_value();
+         queueId = m_scheduler->GetNext(AC_BE, std::nullopt, *queueId))
+    {
+        if (auto mask = m_scheduler->GetQueueLinkMask(AC_BE, *queueId, 0); mask && mask->none())
+        {
+            filtered.push_back(std::get<Mac48Address>(*queueId));
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ((filtered == expected), true, "Unexpected filtered sorted list");
+
+    std::vector<Mac48Address> actual;
+    for (auto queueId = m_scheduler->GetNext(AC_BE, 0); queueId.has_value();
+         queueId = m_scheduler->GetNext(AC_BE, 0, *queueId))
+    {
+        actual.push_back(std::get<Mac48Address>(*queueId));
+    }
+    NS_TEST_EXPECT_MSG_EQ((actual == expected), true, "Unexpected per-link sorted list");
+}
+
+void
+WifiMacQueueSchedulerLinkIndexTest::DoRun()
+{
+    m_queue = CreateObject<WifiMacQueue>(AC_BE);
+    m_scheduler = CreateObject<FcfsWifiQueueScheduler>();
+    m_scheduler->m_perAcInfo[AC_BE].wifiMacQueue = m_queue;
+    m_queue->SetScheduler(m_scheduler);
+    m_txAddr = Mac48Address::Allocate();
+
+    std::vector<Mac48Address> rxAddr;
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+        rxAddr.push_back(Mac48Address::Allocate());
+        // all the MPDUs have the same timestamp, hence queues are sorted by insertion order
+        Enqueue(rxAddr.back());
+    }
+    CheckQueues(rxAddr);
+
+    auto block = [&](std::size_t i) {
+        m_scheduler->BlockQueues(WifiQueueBlockedReason::POWER_SAVE_MODE,
+                                 AC_BE,
+                                 {WIFI_QOSDATA_QUEUE},
+                                 rxAddr[i],
+                                 m_txAddr,
+                                 {0},
+                                 {0});
+    };
+    auto unblock = [&](std::size_t i) {
+        m_scheduler->UnblockQueues(WifiQueueBlockedReason::POWER_SAVE_MODE,
+                                   AC_BE,
+                                   {WIFI_QOSDATA_QUEUE},
+                                   rxAddr[i],
+                                   m_txAddr,
+                                   {0},
+                                   {0});
+    };
+
+    block(1);
+    block(3);
+    CheckQueues({rxAddr[0], rxAddr[2], rxAddr[4]});
+
+    // an unblocked queue is back in its position
+    unblock(1);
+    CheckQueues({rxAddr[0], rxAddr[1], rxAddr[2], rxAddr[4]});
+
+    // the first queue becomes empty
+    m_queue->Remove(m_queue->PeekByTidAndAddress(0, rxAddr[0]));
+    CheckQueues({rxAddr[1], rxAddr[2], rxAddr[4]});
+
+    // the first queue is refilled later and becomes the last one
+    Simulator::Schedule(MilliSeconds(1), [&]() { Enqueue(rxAddr[0]); });
+    Simulator::Run();
+    CheckQueues({rxAddr[1], rxAddr[2], rxAddr[4], rxAddr[0]});
+
+    unblock(3);
+    CheckQueues({rxAddr[1], rxAddr[2], rxAddr[3], rxAddr[4], rxAddr[0]});
+
+    m_scheduler->Dispose();
+    m_queue = nullptr;
+    m_scheduler = nullptr;
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -434,6 +696,8 @@ WifiMacQueueTestSuite::WifiMacQueueTestSuite()
 {
     AddTestCase(new WifiMacQueueDropOldestTest, TestCase::Duration::QUICK);
     AddTestCase(new WifiExtractExpiredMpdusTest, TestCase::Duration::QUICK);
+    AddTestCase(new WifiMacQueueExpiryIndexTest, TestCase::Duration::QUICK);
+    AddTestCase(new WifiMacQueueSchedulerLinkIndexTest, TestCase::Duration::QUICK);
 }
 
 static WifiMacQueueTestSuite g_wifiMacQueueTestSuite; ///< the test suite
@@ -6,6 +6,7 @@
  * Author: Sébastien Deronne <sebastien.deronne@gmail.com>
  */
 
+#include "ns3/double.h"
 #include "ns3/interference-helper.h"
 #include "ns3/log.h"
 #include "ns3/multi-model-spectrum-channel.h"
@@ -462,6 +463,70 @@ WifiPhyThresholdsStrongForeignSignalTest::DoRun()
                           "State should have moved to CCA-BUSY then back to IDLE");
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Wifi Phy Threshold Background Interference Test
+ *
+ * This test makes sure PHY does not process Wi-Fi signals with a received power
+ * lower than BackgroundInterferenceThreshold, but adds their energy to the background
+ * interference. The background interference is the average power over the last complete
+ * window, hence it prevents the reception of a Wi-Fi signal in the next window only.
+ */
+class WifiPhyThresholdsBackgroundInterferenceTest : public WifiPhyThresholdsTest
+{
+  public:
+    WifiPhyThresholdsBackgroundInterferenceTest();
+    void DoRun() override;
+};
+
+WifiPhyThresholdsBackgroundInterferenceTest::WifiPhyThresholdsBackgroundInterferenceTest()
+    : WifiPhyThresholdsTest("WifiPhy reception thresholds: test background interference")
+{
+}
+
+void
+WifiPhyThresholdsBackgroundInterferenceTest::DoRun()
+{
+    m_phy->SetAttribute("BackgroundInterferenceThreshold", DoubleValue(-70));
+    m_phy->SetBackgroundInterferenceWindow(MilliSeconds(10));
+
+    // 10 overlapping signals below the threshold in the window starting at 1s: their
+    // average power over the window is about -69.5 dBm
+    for (std::size_t i = 0; i < 10; ++i)
+    {
+        Simulator::Schedule(Seconds(1),
+                            &WifiPhyThresholdsBackgroundInterferenceTest::SendSignal,
+                            this,
+                            DbmToW(-71),
+                            true);
+    }
+    // the background interference of the previous window is null
+    Simulator::Schedule(Seconds(1) + MilliSeconds(2),
+                        &WifiPhyThresholdsBackgroundInterferenceTest::SendSignal,
+                        this,
+                        DbmToW(-69),
+                        true);
+    // the background interference of the previous window prevents the reception
+    Simulator::Schedule(Seconds(1) + MilliSeconds(12),
+                        &WifiPhyThresholdsBackgroundInterferenceTest::SendSignal,
+                        this,
+                        DbmToW(-69),
+                        true);
+
+    Simulator::Run();
+    Simulator::Destroy();
+
+    NS_TEST_ASSERT_MSG_EQ(m_rxSuccess, 1, "Only the first packet should have been received");
+    NS_TEST_ASSERT_MSG_EQ(m_rxDropped + m_rxFailure,
+                          1,
+                          "Only the second packet should have been dropped or received in error");
+    NS_TEST_ASSERT_MSG_EQ(m_rxStateCount,
+                          1,
+                          "Signals weaker than the threshold should not have been received");
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -481,6 +546,7 @@ WifiPhyThresholdsTestSuite::WifiPhyThresholdsTestSuite()
     AddTestCase(new WifiPhyThresholdsWeakForeignSignalTest, TestCase::Duration::QUICK);
     AddTestCase(new WifiPhyThresholdsStrongWifiSignalTest, TestCase::Duration::QUICK);
     AddTestCase(new WifiPhyThresholdsStrongForeignSignalTest, TestCase::Duration::QUICK);
+    AddTestCase(new WifiPhyThresholdsBackgroundInterferenceTest, TestCase::Duration::QUICK);
 }
 
 static WifiPhyThresholdsTestSuite wifiPhyThresholdsTestSuite; ///< the test suite
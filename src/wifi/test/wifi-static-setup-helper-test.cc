@@ -0,0 +1,287 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/ap-wifi-mac.h"
+#include "ns3/config.h"
+#include "ns3/log.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/packet-socket-client.h"
+#include "ns3/packet-socket-helper.h"
+#include "ns3/packet-socket-server.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/sta-wifi-mac.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/wifi-mac-header.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/wifi-psdu.h"
+#include "ns3/wifi-static-setup-helper.h"
+#include "ns3/yans-wifi-helper.h"
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("WifiStaticSetupHelperTest");
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the static association and Block Ack agreement setup
+ *
+ * An AP and a few stations are statically associated and Block Ack agreements are
+ * statically established in both directions for TID 0. Downlink and uplink traffic
+ * starts shortly after the beginning of the simulation. The test checks that the
+ * stations are associated and the agreements are established at the start of the
+ * traffic, that all the packets are received and that no management frame other
+ * than Beacon frames (if beacons are not suppressed) is transmitted.
+ */
+class WifiStaticSetupHelperTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param suppressBeacons whether beacons are suppressed
+     */
+    WifiStaticSetupHelperTest(bool suppressBeacons);
+
+  private:
+    void DoSetup() override;
+    void DoRun() override;
+
+    /**
+     * Callback invoked when a PHY starts transmitting a PSDU.
+     *
+     * \param psduMap the PSDU map
+     * \param txVector the TX vector
+     * \param txPowerW the TX power in Watts
+     */
+    void Transmit(WifiConstPsduMap psduMap, WifiTxVector txVector, double txPowerW);
+
+    /**
+     * Callback invoked when a packet is received by a packet socket server.
+     *
+     * \param packet the received packet
+     * \param from the address of the sender
+     */
+    void Receive(Ptr<const Packet> packet, const Address& from);
+
+    /// Check that the stations are associated and the agreements established
+    void CheckSetup();
+
+    const std::size_t m_nStations{4}; ///< number of stations
+    const std::size_t m_nPackets{20}; ///< number of packets sent in each direction per station
+    bool m_suppressBeacons;           ///< whether beacons are suppressed
+    Ptr<WifiNetDevice> m_apDevice;    ///< AP device
+    NetDeviceContainer m_staDevices;  ///< station devices
+    std::size_t m_nBeacons{0};        ///< number of transmitted Beacon frames
+    std::size_t m_nOtherMgt{0};       ///< number of other transmitted management frames
+    std::size_t m_nBlockAcks{0};      ///< number of transmitted BlockAck frames
+    std::size_t m_nRxPackets{0};      ///< number of packets received by the servers
+};
+
+WifiStaticSetupHelperTest::WifiStaticSetupHelperTest(bool suppressBeacons)
+    : TestCase(std::string("Check static association and Block Ack setup (beacons ") +
+               (suppressBeacons ? "suppressed)" : "enabled)")),
+      m_suppressBeacons(suppressBeacons)
+{
+}
+
+void
+WifiStaticSetupHelperTest::Transmit(WifiConstPsduMap psduMap,
+                                    WifiTxVector txVector,
+                                    double txPowerW)
+{
+    for (const auto& mpdu : *psduMap.begin()->second)
+    {
+        const auto& hdr = mpdu->GetHeader();
+        if (hdr.IsBeacon())
+        {
+            ++m_nBeacons;
+        }
+        else if (hdr.IsMgt())
+        {
+            NS_LOG_DEBUG("Management frame transmitted: " << hdr);
+            ++m_nOtherMgt;
+        }
+        else if (hdr.IsBlockAck())
+        {
+            ++m_nBlockAcks;
+        }
+    }
+}
+
+void
+WifiStaticSetupHelperTest::Receive(Ptr<const Packet> packet, const Address& from)
+{
+    ++m_nRxPackets;
+}
+
+void
+WifiStaticSetupHelperTest::CheckSetup()
+{
+    auto apMac = DynamicCast<ApWifiMac>(m_apDevice->GetMac());
+    NS_TEST_EXPECT_MSG_EQ(apMac->GetStaList(SINGLE_LINK_OP_ID).size(),
+                          m_nStations,
+                          "Unexpected number of stations associated with the AP");
+
+    for (std::size_t i = 0; i < m_nStations; ++i)
+    {
+        auto staMac = DynamicCast<StaWifiMac>(
+            DynamicCast<WifiNetDevice>(m_staDevices.Get(i))->GetMac());
+        NS_TEST_EXPECT_MSG_EQ(staMac->IsAssociated(), true, "Station " << i << " not associated");
+        NS_TEST_EXPECT_MSG_EQ(staMac->GetAssociationId(),
+                              i + 1,
+                              "Unexpected AID for station " << i);
+        NS_TEST_EXPECT_MSG_EQ(
+            apMac->GetWifiRemoteStationManager()->IsAssociated(staMac->GetAddress()),
+            true,
+            "Station " << i << " not associated at the AP remote station manager");
+        NS_TEST_EXPECT_MSG_EQ(
+            apMac->GetBaAgreementEstablishedAsOriginator(staMac->GetAddress(), 0).has_value(),
+            true,
+            "No downlink agreement established with station " << i);
+        NS_TEST_EXPECT_MSG_EQ(
+            staMac->GetBaAgreementEstablishedAsOriginator(apMac->GetAddress(), 0).has_value(),
+            true,
+            "No uplink agreement established by station " << i);
+        NS_TEST_EXPECT_MSG_EQ(
+            staMac->GetBaAgreementEstablishedAsRecipient(apMac->GetAddress(), 0).has_value(),
+            true,
+            "No downlink agreement at station " << i);
+    }
+}
+
+void
+WifiStaticSetupHelperTest::DoSetup()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    int64_t streamNumber = 100;
+
+    NodeContainer apNode(1);
+    NodeContainer staNodes(m_nStations);
+
+    auto channel = YansWifiChannelHelper::Default();
+    YansWifiPhyHelper phy;
+    phy.SetChannel(channel.Create());
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211ax);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue("HeMcs7"),
+                                 "ControlMode",
+                                 StringValue("OfdmRate24Mbps"));
+
+    WifiMacHelper mac;
+    mac.SetType("ns3::StaWifiMac");
+    m_staDevices = wifi.Install(phy, mac, staNodes);
+    mac.SetType("ns3::ApWifiMac");
+    m_apDevice = DynamicCast<WifiNetDevice>(wifi.Install(phy, mac, apNode).Get(0));
+
+    streamNumber += WifiHelper::AssignStreams(m_staDevices, streamNumber);
+    streamNumber += WifiHelper::AssignStreams(NetDeviceContainer(m_apDevice), streamNumber);
+
+    MobilityHelper mobility;
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(apNode);
+    mobility.Install(staNodes);
+
+    WifiStaticSetupHelper::SetStaticAssociation(m_apDevice, m_staDevices, m_suppressBeacons);
+    WifiStaticSetupHelper::SetStaticBlockAck(m_apDevice, m_staDevices, {0});
+
+    Config::ConnectWithoutContext(
+        "/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Phys/*/PhyTxPsduBegin",
+        MakeCallback(&WifiStaticSetupHelperTest::Transmit, this));
+
+    PacketSocketHelper packetSocket;
+    packetSocket.Install(apNode);
+    packetSocket.Install(staNodes);
+
+    // lambda to install a client sending packets from a device to another one
+    auto installClient = [&](Ptr<NetDevice> txDev, Ptr<NetDevice> rxDev) {
+        PacketSocketAddress socket;
+        socket.SetSingleDevice(txDev->GetIfIndex());
+        socket.SetPhysicalAddress(rxDev->GetAddress());
+        socket.SetProtocol(1);
+
+        auto client = CreateObject<PacketSocketClient>();
+        client->SetAttribute("PacketSize", UintegerValue(1000));
+        client->SetAttribute("MaxPackets", UintegerValue(m_nPackets));
+        client->SetAttribute("Interval", TimeValue(Time{0}));
+        client->SetRemote(socket);
+        txDev->GetNode()->AddApplication(client);
+        client->SetStartTime(MilliSeconds(10));
+    };
+
+    // lambda to install a server receiving the packets sent to a device
+    auto installServer = [&](Ptr<NetDevice> rxDev) {
+        PacketSocketAddress socket;
+        socket.SetSingleDevice(rxDev->GetIfIndex());
+        socket.SetProtocol(1);
+
+        auto server = CreateObject<PacketSocketServer>();
+        server->SetLocal(socket);
+        rxDev->GetNode()->AddApplication(server);
+        server->SetStartTime(Seconds(0));
+        server->TraceConnectWithoutContext(
+            "Rx",
+            MakeCallback(&WifiStaticSetupHelperTest::Receive, this));
+    };
+
+    installServer(m_apDevice);
+    for (std::size_t i = 0; i < m_nStations; ++i)
+    {
+        installServer(m_staDevices.Get(i));
+        installClient(m_apDevice, m_staDevices.Get(i));
+        installClient(m_staDevices.Get(i), m_apDevice);
+    }
+
+    Simulator::Schedule(MilliSeconds(10), &WifiStaticSetupHelperTest::CheckSetup, this);
+}
+
+void
+WifiStaticSetupHelperTest::DoRun()
+{
+    Simulator::Stop(Seconds(1));
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_EQ(m_nRxPackets,
+                          2 * m_nStations * m_nPackets,
+                          "Unexpected number of received packets");
+    NS_TEST_EXPECT_MSG_GT(m_nBlockAcks, 0, "Expected the transmission of BlockAck frames");
+    NS_TEST_EXPECT_MSG_EQ(m_nOtherMgt, 0, "Unexpected transmission of management frames");
+    if (m_suppressBeacons)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_nBeacons, 0, "Unexpected transmission of Beacon frames");
+    }
+    else
+    {
+        NS_TEST_EXPECT_MSG_GT(m_nBeacons, 0, "Expected the transmission of Beacon frames");
+    }
+
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Wifi static setup helper Test Suite
+ */
+class WifiStaticSetupHelperTestSuite : public TestSuite
+{
+  public:
+    WifiStaticSetupHelperTestSuite();
+};
+
+WifiStaticSetupHelperTestSuite::WifiStaticSetupHelperTestSuite()
+    : TestSuite("wifi-static-setup-helper", Type::UNIT)
+{
+    AddTestCase(new WifiStaticSetupHelperTest(true), TestCase::Duration::QUICK);
+    AddTestCase(new WifiStaticSetupHelperTest(false), TestCase::Duration::QUICK);
+}
+
+static WifiStaticSetupHelperTestSuite g_wifiStaticSetupHelperTestSuite; ///< the test suite
@@ -0,0 +1,175 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/global-route-manager.h"
+#include "ns3/global-router-interface.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/ipv4-global-routing-helper.h"
+#include "ns3/ipv4-global-routing.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-helper.h"
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup internet
+ * Benchmark of the global route computation for grids of point-to-point routers.
+ *
+ * For every grid size, the program reports the time needed to populate the routing tables
+ * and the time needed to recompute them after an interface of the router at the center of
+ * the grid goes down, split into its three steps: deleting the global routes, building the
+ * link state database and running the SPF calculation of every router (which also installs
+ * the routes). It also reports how many routers changed their next hop toward the address
+ * of some interface, other than the interfaces of the link that went down, and how many
+ * (router, address) pairs changed.
+ */
+
+using namespace ns3;
+
+/**
+ * Measure the duration of a function call.
+ *
+ * \param f the function
+ * \return the duration of the call in milliseconds
+ */
+double
+Measure(const std::function<void()>& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/**
+ * Get the next hop of every node toward every destination.
+ *
+ * \param nodes the nodes
+ * \param destinations the destinations
+ * \return the gateways, by node and destination (the any address if there is no route)
+ */
+std::vector<std::vector<Ipv4Address>>
+GetNextHops(const NodeContainer& nodes, const std::vector<Ipv4Address>& destinations)
+{
+    std::vector<std::vector<Ipv4Address>> nextHops;
+    Ipv4Header header;
+    Socket::SocketErrno sockerr;
+    for (auto it = nodes.Begin(); it != nodes.End(); ++it)
+    {
+        auto routing = (*it)->GetObject<GlobalRouter>()->GetRoutingProtocol();
+        auto& nodeNextHops = nextHops.emplace_back();
+        for (const auto& destination : destinations)
+        {
+            header.SetDestination(destination);
+            auto route = routing->RouteOutput(nullptr, header, nullptr, sockerr);
+            nodeNextHops.push_back(route ? route->GetGateway() : Ipv4Address::GetAny());
+        }
+    }
+    return nextHops;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t minSide = 10;
+    uint32_t maxSide = 30;
+    uint32_t step = 10;
+    bool compactRoutes = false;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("minSide", "Number of rows and columns of the smallest grid", minSide);
+    cmd.AddValue("maxSide", "Number of rows and columns of the largest grid", maxSide);
+    cmd.AddValue("step", "Increment of the number of rows and columns", step);
+    cmd.AddValue("compactRoutes", "Store the routes as compact routes", compactRoutes);
+    cmd.Parse(argc, argv);
+
+    Config::SetDefault("ns3::Ipv4GlobalRouting::CompactRoutes", BooleanValue(compactRoutes));
+
+    std::cout << "Time in milliseconds" << std::endl;
+    std::cout << std::setw(8) << "routers" << std::setw(8) << "links" << std::setw(12)
+              << "populate" << std::setw(12) << "delete" << std::setw(12) << "database"
+              << std::setw(12) << "spf" << std::setw(12) << "recompute" << std::setw(10)
+              << "routers" << std::setw(10) << "routes" << std::endl;
+
+    for (uint32_t side = minSide; side <= maxSide; side += step)
+    {
+        NodeContainer nodes;
+        nodes.Create(side * side);
+        InternetStackHelper stack;
+        stack.Install(nodes);
+
+        // connect every router to its right and bottom neighbors
+        PointToPointHelper p2p;
+        Ipv4AddressHelper address("10.0.0.0", "255.255.255.252");
+        std::vector<Ipv4Address> destinations;
+        auto connect = [&](Ptr<Node> a, Ptr<Node> b) {
+            auto interfaces = address.Assign(p2p.Install(a, b));
+            address.NewNetwork();
+            destinations.push_back(interfaces.GetAddress(0));
+            destinations.push_back(interfaces.GetAddress(1));
+        };
+        for (uint32_t row = 0; row < side; ++row)
+        {
+            for (uint32_t col = 0; col < side; ++col)
+            {
+                auto node = nodes.Get(row * side + col);
+                if (col + 1 < side)
+                {
+                    connect(node, nodes.Get(row * side + col + 1));
+                }
+                if (row + 1 < side)
+                {
+                    connect(node, nodes.Get((row + 1) * side + col));
+                }
+            }
+        }
+
+        auto populate = Measure([] { Ipv4GlobalRoutingHelper::PopulateRoutingTables(); });
+
+        // take down the first link of the router at the center of the grid; the routing
+        // tables are not recomputed automatically at time zero
+        auto ipv4 = nodes.Get((side / 2) * side + side / 2)->GetObject<Ipv4>();
+        const auto ifAddress = ipv4->GetAddress(1, 0);
+        const auto before = GetNextHops(nodes, destinations);
+        ipv4->SetDown(1);
+
+        auto remove = Measure([] { GlobalRouteManager::DeleteGlobalRoutes(); });
+        auto database = Measure([] { GlobalRouteManager::BuildGlobalRoutingDatabase(); });
+        auto spf = Measure([] { GlobalRouteManager::InitializeRoutes(); });
+
+        const auto after = GetNextHops(nodes, destinations);
+        uint32_t changedRouters = 0;
+        uint32_t changedRoutes = 0;
+        for (std::size_t i = 0; i < before.size(); ++i)
+        {
+            uint32_t changed = 0;
+            for (std::size_t j = 0; j < destinations.size(); ++j)
+            {
+                if (before[i][j] != after[i][j] &&
+                    !ifAddress.GetMask().IsMatch(destinations[j], ifAddress.GetLocal()))
+                {
+                    ++changed;
+                }
+            }
+            changedRouters += (changed > 0) ? 1 : 0;
+            changedRoutes += changed;
+        }
+
+        std::cout << std::setw(8) << side * side << std::setw(8) << 2 * side * (side - 1)
+                  << std::setw(12) << populate << std::setw(12) << remove << std::setw(12)
+                  << database << std::setw(12) << spf << std::setw(12)
+                  << remove + database + spf << std::setw(10) << changedRouters
+                  << std::setw(10) << changedRoutes << std::endl;
+
+        Simulator::Destroy();
+    }
+    return 0;
+}
@@ -0,0 +1,166 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-global-routing.h"
+#include "ns3/ipv4-static-routing-helper.h"
+#include "ns3/ipv4-static-routing.h"
+#include "ns3/network-module.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup internet
+ * Benchmark of the route lookups of Ipv4StaticRouting and Ipv4GlobalRouting with large
+ * routing tables.
+ *
+ * The given number of network routes (to random prefixes with random lengths) is added
+ * to a static routing and to a global routing instance. The program reports the time
+ * needed to add the routes and the average time of a RouteOutput() call for random
+ * destinations, both without output interface (the lookup uses the prefix index) and
+ * with an output interface (the lookup scans the routing table).
+ */
+
+using namespace ns3;
+
+/**
+ * Measure the average duration of the route lookups for the given destinations.
+ *
+ * \param routing the routing protocol
+ * \param destinations the destinations
+ * \param oif the output interface to request, if any
+ * \param found incremented by the number of destinations for which a route is found
+ * \return the average duration of a lookup in microseconds
+ */
+double
+MeasureLookups(Ptr<Ipv4RoutingProtocol> routing,
+               const std::vector<Ipv4Address>& destinations,
+               Ptr<NetDevice> oif,
+               std::size_t& found)
+{
+    auto packet = Create<Packet>();
+    Ipv4Header header;
+    Socket::SocketErrno sockerr;
+
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& dest : destinations)
+    {
+        header.SetDestination(dest);
+        if (routing->RouteOutput(packet, header, oif, sockerr))
+        {
+            ++found;
+        }
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / destinations.size();
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t nRoutes = 100000;
+    uint32_t nLookups = 10000;
+    uint32_t nScanLookups = 200;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("nRoutes", "Number of network routes", nRoutes);
+    cmd.AddValue("nLookups", "Number of lookups without output interface", nLookups);
+    cmd.AddValue("nScanLookups", "Number of lookups with output interface", nScanLookups);
+    cmd.Parse(argc, argv);
+
+    const uint32_t nInterfaces = 4;
+    auto node = CreateObject<Node>();
+    InternetStackHelper internet;
+    internet.Install(node);
+    auto ipv4 = node->GetObject<Ipv4>();
+    for (uint32_t i = 1; i <= nInterfaces; ++i)
+    {
+        auto device = CreateObject<SimpleNetDevice>();
+        device->SetAddress(Mac48Address::Allocate());
+        node->AddDevice(device);
+        auto ifIndex = ipv4->AddInterface(device);
+        ipv4->AddAddress(ifIndex,
+                         Ipv4InterfaceAddress(Ipv4Address(0xc0a80001 + (i << 8)),
+                                              Ipv4Mask("/24")));
+        ipv4->SetUp(ifIndex);
+    }
+
+    auto random = CreateObject<UniformRandomVariable>();
+    random->SetStream(1);
+
+    struct Route
+    {
+        Ipv4Address network;
+        Ipv4Mask mask;
+        uint32_t interface;
+    };
+
+    std::vector<Route> routes;
+    for (uint32_t i = 0; i < nRoutes; ++i)
+    {
+        // prefix lengths as in BGP tables: mostly /16 to /24
+        auto length = random->GetInteger(0, 9) == 0 ? random->GetInteger(8, 32)
+                                                    : random->GetInteger(16, 24);
+        Ipv4Mask mask(length == 32 ? 0xffffffff : ~(0xffffffff >> length));
+        Ipv4Address network(random->GetInteger(0x01000000, 0xdfffffff) & mask.Get());
+        routes.push_back({network, mask, random->GetInteger(1, nInterfaces)});
+    }
+
+    std::vector<Ipv4Address> destinations;
+    for (uint32_t i = 0; i < nLookups; ++i)
+    {
+        destinations.emplace_back(random->GetInteger(0x01000000, 0xdfffffff));
+    }
+    std::vector<Ipv4Address> scanDestinations(destinations.begin(),
+                                              destinations.begin() +
+                                                  std::min(nScanLookups, nLookups));
+    auto oif = ipv4->GetNetDevice(1);
+
+    Ipv4StaticRoutingHelper staticHelper;
+    auto staticRouting = staticHelper.GetStaticRouting(ipv4);
+    auto globalRouting = CreateObject<Ipv4GlobalRouting>();
+    globalRouting->SetIpv4(ipv4);
+
+    std::cout << nRoutes << " network routes" << std::endl;
+    std::cout << std::setw(10) << "routing" << std::setw(16) << "add (us/route)" << std::setw(18)
+              << "lookup (us)" << std::setw(18) << "scan (us)" << std::setw(10) << "found"
+              << std::endl;
+
+    for (Ptr<Ipv4RoutingProtocol> routing : {Ptr<Ipv4RoutingProtocol>(staticRouting),
+                                             Ptr<Ipv4RoutingProtocol>(globalRouting)})
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (const auto& route : routes)
+        {
+            if (routing == staticRouting)
+            {
+                staticRouting->AddNetworkRouteTo(route.network, route.mask, route.interface);
+            }
+            else
+            {
+                globalRouting->AddNetworkRouteTo(route.network, route.mask, route.interface);
+            }
+        }
+        std::chrono::duration<double, std::micro> elapsed =
+            std::chrono::steady_clock::now() - start;
+
+        std::size_t found = 0;
+        auto lookup = MeasureLookups(routing, destinations, nullptr, found);
+        std::size_t scanFound = 0;
+        auto scan = MeasureLookups(routing, scanDestinations, oif, scanFound);
+
+        std::cout << std::setw(10) << (routing == staticRouting ? "static" : "global")
+                  << std::setw(16) << elapsed.count() / nRoutes << std::setw(18) << lookup
+                  << std::setw(18) << scan << std::setw(10) << found << std::endl;
+    }
+
+    globalRouting->Dispose();
+    Simulator::Destroy();
+    return 0;
+}
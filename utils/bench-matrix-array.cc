@@ -0,0 +1,197 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/core-module.h"
+
+#ifdef HAVE_EIGEN3
+#include <Eigen/Dense>
+#endif
+
+#ifdef HAVE_BLAS
+#include <cblas.h>
+#endif
+
+#include <chrono>
+#include <complex>
+#include <iomanip>
+#include <iostream>
+
+/**
+ * \file
+ * \ingroup core-tests
+ * Microbenchmark of the MatrixArray operations used by the MIMO and
+ * 3GPP channel computations.
+ *
+ * For each matrix size, the program reports the time per page of the
+ * page-wise matrix product computed with each of the available kernels (a
+ * generic triple loop, Eigen and BLAS, when ns-3 is configured with them) and
+ * with MatrixArray, which picks one of them depending on the size of the
+ * pages, followed by the times of the product by the Hermitian transpose, of
+ * the matrix inversion and of the determinant.
+ */
+
+using namespace ns3;
+
+/**
+ * Time the execution of a function.
+ * \param [in] reps The number of repetitions.
+ * \param [in] f The function to execute.
+ * \return The average execution time of f, in microseconds.
+ */
+template <class F>
+double
+TimeIt(uint32_t reps, F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < reps; ++i)
+    {
+        f();
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / reps;
+}
+
+/**
+ * Fill a ComplexMatrixArray with random values.
+ * \param [in] m The ComplexMatrixArray to fill.
+ * \param [in] rng The random variable used to draw the values.
+ */
+void
+Fill(ComplexMatrixArray& m, Ptr<UniformRandomVariable> rng)
+{
+    std::complex<double>* values = m.GetPagePtr(0);
+    for (size_t i = 0; i < m.GetSize(); ++i)
+    {
+        values[i] = std::complex<double>(rng->GetValue(-1, 1), rng->GetValue(-1, 1));
+    }
+}
+
+/**
+ * Compute the page-wise product of two ComplexMatrixArrays with a generic triple loop.
+ * \param [in] a The left ComplexMatrixArray.
+ * \param [in] b The right ComplexMatrixArray.
+ * \param [out] res The product, which must have the right dimensions.
+ */
+void
+LoopMultiply(const ComplexMatrixArray& a, const ComplexMatrixArray& b, ComplexMatrixArray& res)
+{
+    for (size_t page = 0; page < a.GetNumPages(); ++page)
+    {
+        for (size_t i = 0; i < a.GetNumRows(); ++i)
+        {
+            for (size_t j = 0; j < b.GetNumCols(); ++j)
+            {
+                std::complex<double> sum{0};
+                for (size_t k = 0; k < a.GetNumCols(); ++k)
+                {
+                    sum += a(i, k, page) * b(k, j, page);
+                }
+                res(i, j, page) = sum;
+            }
+        }
+    }
+}
+
+#ifdef HAVE_EIGEN3
+/**
+ * Compute the page-wise product of two ComplexMatrixArrays with Eigen.
+ * \param [in] a The left ComplexMatrixArray.
+ * \param [in] b The right ComplexMatrixArray.
+ * \param [out] res The product, which must have the right dimensions.
+ */
+void
+EigenMultiply(const ComplexMatrixArray& a, const ComplexMatrixArray& b, ComplexMatrixArray& res)
+{
+    using ConstMap = Eigen::Map<const Eigen::MatrixXcd>;
+    for (size_t page = 0; page < a.GetNumPages(); ++page)
+    {
+        Eigen::Map<Eigen::MatrixXcd> r(res.GetPagePtr(page), res.GetNumRows(), res.GetNumCols());
+        r = ConstMap(a.GetPagePtr(page), a.GetNumRows(), a.GetNumCols()) *
+            ConstMap(b.GetPagePtr(page), b.GetNumRows(), b.GetNumCols());
+    }
+}
+#endif
+
+#ifdef HAVE_BLAS
+/**
+ * Compute the page-wise product of two ComplexMatrixArrays with BLAS.
+ * \param [in] a The left ComplexMatrixArray.
+ * \param [in] b The right ComplexMatrixArray.
+ * \param [out] res The product, which must have the right dimensions.
+ */
+void
+BlasMultiply(const ComplexMatrixArray& a, const ComplexMatrixArray& b, ComplexMatrixArray& res)
+{
+    const std::complex<double> alpha{1.0};
+    const std::complex<double> beta{0.0};
+    for (size_t page = 0; page < a.GetNumPages(); ++page)
+    {
+        cblas_zgemm(CblasColMajor,
+                    CblasNoTrans,
+                    CblasNoTrans,
+                    a.GetNumRows(),
+                    b.GetNumCols(),
+                    a.GetNumCols(),
+                    &alpha,
+                    a.GetPagePtr(page),
+                    a.GetNumRows(),
+                    b.GetPagePtr(page),
+                    b.GetNumRows(),
+                    &beta,
+                    res.GetPagePtr(page),
+                    res.GetNumRows());
+    }
+}
+#endif
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t numPages = 64;
+    uint32_t reps = 20;
+    uint32_t maxSize = 64;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("pages", "Number of pages of each MatrixArray", numPages);
+    cmd.AddValue("reps", "Number of repetitions of each operation", reps);
+    cmd.AddValue("maxSize", "Largest (square) matrix size", maxSize);
+    cmd.Parse(argc, argv);
+
+    auto rng = CreateObject<UniformRandomVariable>();
+
+    std::cout << "Time per page in microseconds (" << numPages << " pages, " << reps
+              << " repetitions)" << std::endl;
+    std::cout << std::setw(6) << "size" << std::setw(12) << "Loop" << std::setw(12) << "Eigen"
+              << std::setw(12) << "BLAS" << std::setw(12) << "A*B" << std::setw(12) << "A^H*B"
+              << std::setw(12) << "Inverse" << std::setw(12) << "Det" << std::endl;
+
+    for (uint32_t size = 2; size <= maxSize; size *= 2)
+    {
+        ComplexMatrixArray a{size, size, numPages};
+        ComplexMatrixArray b{size, size, numPages};
+        ComplexMatrixArray r{size, size, numPages};
+        Fill(a, rng);
+        Fill(b, rng);
+
+        std::cout << std::setw(6) << size << std::setw(12)
+                  << TimeIt(reps, [&]() { LoopMultiply(a, b, r); }) / numPages;
+#ifdef HAVE_EIGEN3
+        std::cout << std::setw(12) << TimeIt(reps, [&]() { EigenMultiply(a, b, r); }) / numPages;
+#else
+        std::cout << std::setw(12) << "-";
+#endif
+#ifdef HAVE_BLAS
+        std::cout << std::setw(12) << TimeIt(reps, [&]() { BlasMultiply(a, b, r); }) / numPages;
+#else
+        std::cout << std::setw(12) << "-";
+#endif
+        std::cout << std::setw(12) << TimeIt(reps, [&]() { r = a * b; }) / numPages
+                  << std::setw(12)
+                  << TimeIt(reps, [&]() { r = a.HermitianTransposeMultiply(b); }) / numPages
+                  << std::setw(12) << TimeIt(reps, [&]() { r = a.Inverse(); }) / numPages
+                  << std::setw(12) << TimeIt(reps, [&]() { auto d = a.Determinant(); }) / numPages
+                  << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,145 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/tcp-header.h"
+#include "ns3/tcp-rx-buffer.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup tcp
+ * Benchmark of the reassembly of TCP segments by TcpRxBuffer.
+ *
+ * For every window size, full windows of segments are added to a TcpRxBuffer and the
+ * available data is extracted at the end of every window, either in order or with the
+ * first segment of every window arriving last (hence the rest of the window is stored out
+ * of order and becomes available at once). The program reports the average time per
+ * segment spent in Add() and in Extract(), and, as a reference, the time needed to copy
+ * the payload of the segments into a contiguous buffer, which is the minimum work of a
+ * reassembly queue storing the data contiguously instead of one Packet per segment.
+ */
+
+using namespace ns3;
+
+/// Time spent per segment, in nanoseconds
+struct Result
+{
+    double add;     //!< time spent in TcpRxBuffer::Add
+    double extract; //!< time spent in TcpRxBuffer::Extract
+    double copy;    //!< time spent copying the payload into a contiguous buffer
+};
+
+/**
+ * Reassemble windows of segments.
+ *
+ * \param segments the segments of a window, whose payload is reused for every window
+ * \param nWindows the number of windows
+ * \param outOfOrder whether the first segment of every window arrives last
+ * \return the time spent per segment
+ */
+Result
+Reassemble(const std::vector<Ptr<Packet>>& segments, uint32_t nWindows, bool outOfOrder)
+{
+    const uint32_t segmentSize = segments.front()->GetSize();
+    const uint32_t windowSize = segments.size();
+    TcpRxBuffer buffer(1);
+    buffer.SetMaxBufferSize(windowSize * segmentSize);
+    std::vector<uint8_t> contiguous(windowSize * segmentSize);
+
+    std::vector<uint32_t> order(windowSize);
+    for (uint32_t i = 0; i < windowSize; ++i)
+    {
+        order[i] = outOfOrder ? (i + 1) % windowSize : i;
+    }
+
+    std::chrono::duration<double, std::nano> add{0};
+    std::chrono::duration<double, std::nano> extract{0};
+    std::chrono::duration<double, std::nano> copy{0};
+    TcpHeader header;
+    SequenceNumber32 windowStart(1);
+    for (uint32_t w = 0; w < nWindows; ++w)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (auto i : order)
+        {
+            header.SetSequenceNumber(windowStart + i * segmentSize);
+            buffer.Add(segments[i]->Copy(), header);
+        }
+        auto end = std::chrono::steady_clock::now();
+        add += end - start;
+
+        start = end;
+        auto data = buffer.Extract(windowSize * segmentSize);
+        end = std::chrono::steady_clock::now();
+        extract += end - start;
+        NS_ABORT_MSG_IF(!data || data->GetSize() != windowSize * segmentSize,
+                        "Wrong amount of data extracted");
+
+        start = end;
+        for (auto i : order)
+        {
+            segments[i]->CopyData(contiguous.data() + i * segmentSize, segmentSize);
+        }
+        copy += std::chrono::steady_clock::now() - start;
+
+        windowStart += windowSize * segmentSize;
+    }
+    const double nSegments = static_cast<double>(windowSize) * nWindows;
+    return {add.count() / nSegments, extract.count() / nSegments, copy.count() / nSegments};
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t segmentSize = 1448;
+    uint32_t maxWindow = 16384;
+    uint32_t nSegments = 1 << 18;
+    bool zeroPayload = false;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("segmentSize", "Size of the segments in bytes", segmentSize);
+    cmd.AddValue("maxWindow", "Largest window size in segments", maxWindow);
+    cmd.AddValue("nSegments", "Number of segments reassembled for every window size", nSegments);
+    cmd.AddValue("zeroPayload",
+                 "Use zero-filled payloads (as most applications do) instead of actual bytes",
+                 zeroPayload);
+    cmd.Parse(argc, argv);
+
+    std::cout << "Time per segment in nanoseconds (" << segmentSize << "-byte segments, "
+              << (zeroPayload ? "zero-filled" : "actual") << " payload)" << std::endl;
+    std::cout << std::setw(8) << "window" << std::setw(14) << "order" << std::setw(12) << "add"
+              << std::setw(12) << "extract" << std::setw(12) << "copy" << std::endl;
+
+    std::vector<uint8_t> payload(segmentSize);
+    for (uint32_t i = 0; i < segmentSize; ++i)
+    {
+        payload[i] = i % 251;
+    }
+
+    for (uint32_t window = 4; window <= maxWindow; window *= 4)
+    {
+        std::vector<Ptr<Packet>> segments;
+        for (uint32_t i = 0; i < window; ++i)
+        {
+            segments.push_back(zeroPayload ? Create<Packet>(segmentSize)
+                                           : Create<Packet>(payload.data(), segmentSize));
+        }
+        const auto nWindows = std::max(nSegments / window, 1U);
+        for (bool outOfOrder : {false, true})
+        {
+            auto result = Reassemble(segments, nWindows, outOfOrder);
+            std::cout << std::setw(8) << window << std::setw(14)
+                      << (outOfOrder ? "first last" : "in order") << std::setw(12) << result.add
+                      << std::setw(12) << result.extract << std::setw(12) << result.copy
+                      << std::endl;
+        }
+    }
+    return 0;
+}
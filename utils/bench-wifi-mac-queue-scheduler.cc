@@ -0,0 +1,125 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-mac-queue-scheduler.h"
+#include "ns3/wifi-mac-queue.h"
+#include "ns3/wifi-mac.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/yans-wifi-helper.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup wifi
+ * Microbenchmark of the selection of the container queue to serve by the
+ * wifi MAC queue scheduler of an AP, versus the number of associated stations.
+ *
+ * For each number of stations, one MPDU per station is queued in the BE queue
+ * of the AP and the queues of a given fraction of the stations (the ones with the
+ * oldest MPDUs) are blocked, as if the stations were in power save mode. The
+ * program reports the time taken to select the first queue to serve on the link
+ * and the time per queue to iterate over all the queues that can be served.
+ */
+
+using namespace ns3;
+
+/**
+ * Time the execution of a function.
+ * \param [in] reps The number of repetitions.
+ * \param [in] f The function to execute.
+ * \return The average execution time of f, in microseconds.
+ */
+template <class F>
+double
+TimeIt(uint32_t reps, F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < reps; ++i)
+    {
+        f();
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / reps;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t maxStations = 4096;
+    double blockedFraction = 0.9;
+    uint32_t reps = 1000;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("maxStations", "Largest number of stations", maxStations);
+    cmd.AddValue("blocked", "Fraction of the stations whose queues are blocked", blockedFraction);
+    cmd.AddValue("reps", "Number of repetitions of each operation", reps);
+    cmd.Parse(argc, argv);
+
+    std::cout << "Time in microseconds (" << blockedFraction * 100 << "% of blocked queues, "
+              << reps << " repetitions)" << std::endl;
+    std::cout << std::setw(10) << "stations" << std::setw(14) << "GetNext" << std::setw(18)
+              << "Iterate/queue" << std::endl;
+
+    for (uint32_t nStations = 16; nStations <= maxStations; nStations *= 4)
+    {
+        auto node = CreateObject<Node>();
+        auto channel = YansWifiChannelHelper::Default();
+        YansWifiPhyHelper phy;
+        phy.SetChannel(channel.Create());
+        WifiMacHelper mac;
+        mac.SetType("ns3::ApWifiMac");
+        WifiHelper wifi;
+        wifi.SetStandard(WIFI_STANDARD_80211ax);
+        auto device = DynamicCast<WifiNetDevice>(wifi.Install(phy, mac, node).Get(0));
+
+        auto apMac = device->GetMac();
+        auto queue = apMac->GetTxopQueue(AC_BE);
+        auto scheduler = apMac->GetMacQueueScheduler();
+        queue->SetMaxSize(QueueSize(QueueSizeUnit::PACKETS, nStations));
+
+        std::vector<Mac48Address> stations;
+        for (uint32_t i = 0; i < nStations; ++i)
+        {
+            stations.push_back(Mac48Address::Allocate());
+            WifiMacHeader hdr(WIFI_MAC_QOSDATA);
+            hdr.SetAddr1(stations.back());
+            hdr.SetAddr2(apMac->GetAddress());
+            hdr.SetQosTid(0);
+            queue->Enqueue(Create<WifiMpdu>(Create<Packet>(100), hdr));
+        }
+        for (uint32_t i = 0; i < nStations * blockedFraction; ++i)
+        {
+            scheduler->BlockQueues(WifiQueueBlockedReason::POWER_SAVE_MODE,
+                                   AC_BE,
+                                   {WIFI_QOSDATA_QUEUE},
+                                   stations[i],
+                                   apMac->GetAddress(),
+                                   {0},
+                                   {SINGLE_LINK_OP_ID});
+        }
+
+        double getNext = TimeIt(reps, [&]() { scheduler->GetNext(AC_BE, SINGLE_LINK_OP_ID); });
+        uint32_t nQueues = 0;
+        double iterate = TimeIt(reps, [&]() {
+            nQueues = 0;
+            for (auto queueId = scheduler->GetNext(AC_BE, SINGLE_LINK_OP_ID); queueId;
+                 queueId = scheduler->GetNext(AC_BE, SINGLE_LINK_OP_ID, *queueId))
+            {
+                ++nQueues;
+            }
+        });
+
+        std::cout << std::setw(10) << nStations << std::setw(14) << getNext << std::setw(18)
+                  << (nQueues > 0 ? iterate / nQueues : 0) << std::endl;
+
+        Simulator::Destroy();
+    }
+    return 0;
+}
@@ -0,0 +1,105 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-mac.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/wifi-remote-station-manager.h"
+#include "ns3/yans-wifi-helper.h"
+
+#include <iomanip>
+#include <iostream>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+/**
+ * \file
+ * \ingroup wifi
+ * Report of the memory used by the remote station manager of an AP for each
+ * associated station.
+ *
+ * The given number of HE stations is associated with the remote station manager
+ * of an AP (all the stations advertise the capabilities of the AP) and a data
+ * TXVECTOR is requested for each station, so that the rate control algorithm
+ * initializes its per-station state. The program reports the heap memory allocated
+ * per station, which is only available with the GNU C library.
+ */
+
+using namespace ns3;
+
+/**
+ * \return the number of bytes currently allocated on the heap, or zero if unknown
+ */
+std::size_t
+GetHeapUsage()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t nStations = 1000;
+    std::string manager = "ns3::MinstrelHtWifiManager";
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("nStations", "Number of associated stations", nStations);
+    cmd.AddValue("manager", "Remote station manager of the AP", manager);
+    cmd.Parse(argc, argv);
+
+    auto node = CreateObject<Node>();
+    auto channel = YansWifiChannelHelper::Default();
+    YansWifiPhyHelper phy;
+    phy.SetChannel(channel.Create());
+    WifiMacHelper mac;
+    mac.SetType("ns3::ApWifiMac");
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211ax);
+    wifi.SetRemoteStationManager(manager);
+    auto device = DynamicCast<WifiNetDevice>(wifi.Install(phy, mac, node).Get(0));
+
+    auto apMac = device->GetMac();
+    auto stationManager = device->GetRemoteStationManager();
+    auto width = device->GetPhy()->GetChannelWidth();
+
+    auto before = GetHeapUsage();
+
+    for (uint32_t i = 0; i < nStations; ++i)
+    {
+        auto address = Mac48Address::Allocate();
+        stationManager->AddAllSupportedModes(address);
+        stationManager->AddStationHtCapabilities(address, apMac->GetHtCapabilities(0));
+        stationManager->AddStationVhtCapabilities(address, apMac->GetVhtCapabilities(0));
+        stationManager->AddStationHeCapabilities(address, apMac->GetHeCapabilities(0));
+        stationManager->RecordGotAssocTxOk(address);
+
+        WifiMacHeader hdr(WIFI_MAC_QOSDATA);
+        hdr.SetAddr1(address);
+        hdr.SetAddr2(apMac->GetAddress());
+        stationManager->GetDataTxVector(hdr, width);
+    }
+
+    auto after = GetHeapUsage();
+
+    std::cout << manager << ", " << nStations << " stations" << std::endl;
+    if (after == 0)
+    {
+        std::cout << "Heap usage is not available on this platform" << std::endl;
+    }
+    else
+    {
+        std::cout << std::setw(20) << "bytes per station" << std::setw(14)
+                  << (after - before) / nStations << std::endl;
+    }
+
+    Simulator::Destroy();
+    return 0;
+}